@@ -201,6 +201,20 @@ namespace Apache
       }
 
 
+      TimeSpan Pool::ServerSnapshotInterval::get()
+      {
+        try
+        {
+          return TimeUtils::DurationToTimeSpan(m_nativeptr->get()->getServerSnapshotInterval());
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+
+      }
+
+
       TimeSpan Pool::StatisticInterval::get()
       {
         try
@@ -257,6 +271,48 @@ namespace Apache
       }
 
 
+      Boolean Pool::AdaptiveSizingEnabled::get()
+      {
+        try
+        {
+          return m_nativeptr->get()->getAdaptiveSizingEnabled();
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+
+      }
+
+
+      Int32 Pool::PrefillParallelism::get()
+      {
+        try
+        {
+          return m_nativeptr->get()->getPrefillParallelism();
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+
+      }
+
+
+      TimeSpan Pool::PrefillTimeout::get()
+      {
+        try
+        {
+          return TimeUtils::DurationToTimeSpan(m_nativeptr->get()->getPrefillTimeout());
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+
+      }
+
+
       Int32 Pool::SubscriptionRedundancy::get()
       {
         try
@@ -146,6 +146,14 @@ namespace Apache
           TimeSpan get();
         }
 
+        /// <summary>
+        /// Get the maximum age of the cached server list for this pool.
+        /// </summary>
+        property TimeSpan ServerSnapshotInterval
+        {
+          TimeSpan get();
+        }
+
         /// <summary>
         /// Get the statistic interval for this pool.
         /// </summary>
@@ -178,6 +186,31 @@ namespace Apache
           Boolean get();
         }
 
+        /// <summary>
+        /// Returns true if adaptive sizing is enabled on this pool.
+        /// </summary>
+        property Boolean AdaptiveSizingEnabled
+        {
+          Boolean get();
+        }
+
+        /// <summary>
+        /// Returns how many connections this pool opens at the same time while
+        /// filling up to its minimum connections.
+        /// </summary>
+        property Int32 PrefillParallelism
+        {
+          Int32 get();
+        }
+
+        /// <summary>
+        /// Returns how long creating this pool waits for its minimum connections.
+        /// </summary>
+        property TimeSpan PrefillTimeout
+        {
+          TimeSpan get();
+        }
+
         /// <summary>
         /// Returns the subscription redundancy level of this pool.
         /// </summary>
@@ -215,6 +215,24 @@ namespace Apache
 		  }
 
 
+		  PoolFactory^ PoolFactory::SetServerSnapshotInterval( TimeSpan serverSnapshotInterval )
+      {
+			  _GF_MG_EXCEPTION_TRY2/* due to auto replace */
+
+			  try
+			  {
+			    m_nativeptr->get()->setServerSnapshotInterval( TimeUtils::TimeSpanToDurationCeil<std::chrono::milliseconds>(serverSnapshotInterval) );
+			  }
+			  finally
+			  {
+			    GC::KeepAlive(m_nativeptr);
+			  }
+
+			  _GF_MG_EXCEPTION_CATCH_ALL2/* due to auto replace */
+          return this;
+		  }
+
+
       PoolFactory^ PoolFactory::SetStatisticInterval( TimeSpan statisticInterval )
       {
 			  _GF_MG_EXCEPTION_TRY2/* due to auto replace */
@@ -333,6 +351,57 @@ namespace Apache
                 GC::KeepAlive(m_nativeptr);
               }
 
+             _GF_MG_EXCEPTION_CATCH_ALL2/* due to auto replace */
+               return this;
+          }
+
+          PoolFactory^ PoolFactory::SetAdaptiveSizingEnabled( Boolean enabled )
+          {
+            _GF_MG_EXCEPTION_TRY2/* due to auto replace */
+
+              try
+              {
+                m_nativeptr->get()->setAdaptiveSizingEnabled(enabled);
+              }
+              finally
+              {
+                GC::KeepAlive(m_nativeptr);
+              }
+
+             _GF_MG_EXCEPTION_CATCH_ALL2/* due to auto replace */
+               return this;
+          }
+
+          PoolFactory^ PoolFactory::SetPrefillParallelism( Int32 parallelism )
+          {
+            _GF_MG_EXCEPTION_TRY2/* due to auto replace */
+
+              try
+              {
+                m_nativeptr->get()->setPrefillParallelism(parallelism);
+              }
+              finally
+              {
+                GC::KeepAlive(m_nativeptr);
+              }
+
+             _GF_MG_EXCEPTION_CATCH_ALL2/* due to auto replace */
+               return this;
+          }
+
+          PoolFactory^ PoolFactory::SetPrefillTimeout( TimeSpan timeout )
+          {
+            _GF_MG_EXCEPTION_TRY2/* due to auto replace */
+
+              try
+              {
+                m_nativeptr->get()->setPrefillTimeout( TimeUtils::TimeSpanToDurationCeil<std::chrono::milliseconds>(timeout) );
+              }
+              finally
+              {
+                GC::KeepAlive(m_nativeptr);
+              }
+
              _GF_MG_EXCEPTION_CATCH_ALL2/* due to auto replace */
                return this;
           }
@@ -208,6 +208,19 @@ namespace Apache
         /// </returns>
         PoolFactory^ SetUpdateLocatorListInterval(TimeSpan updateLocatorListInterval);
 
+        /// <summary>
+        /// Set how long new connections may be placed using the cached server list
+        /// before it is fetched from a locator again.
+        /// </summary>
+        /// <param>
+        /// serverSnapshotInterval The maximum age of the cached server list. If its
+        /// set to 0 then every new connection asks a locator for a server.
+        /// </param>
+        /// <returns>
+        /// a instance of <c>CacheFactory</c> 
+        /// </returns>
+        PoolFactory^ SetServerSnapshotInterval(TimeSpan serverSnapshotInterval);
+
         /// <summary>
         /// Set how often to send client statistics to the server.
         /// </summary>
@@ -318,6 +331,41 @@ namespace Apache
         /// </remarks>
         PoolFactory^ SetPRSingleHopEnabled(Boolean enabled);
 
+        /// <summary>
+        /// By default SetAdaptiveSizingEnabled is false.
+        /// </summary>
+        /// <remarks>
+        /// If true, the pool samples connection checkout waits, in-flight operations
+        /// and round-trip times per server about once a second, and opens or closes
+        /// connections to each server to match, within the minimum and maximum
+        /// connections of the pool.
+        /// </remarks>
+        PoolFactory^ SetAdaptiveSizingEnabled(Boolean enabled);
+
+        /// <summary>
+        /// Sets how many connections the pool opens at the same time while filling
+        /// up to its minimum connections.
+        /// </summary>
+        /// <param>
+        /// parallelism the number of connections opened at the same time
+        /// </param>
+        /// <exception>
+        /// IllegalArgumentException if parallelism is less than 1.
+        /// </exception>
+        PoolFactory^ SetPrefillParallelism(Int32 parallelism);
+
+        /// <summary>
+        /// Sets how long creating the pool waits for its minimum connections.
+        /// </summary>
+        /// <param>
+        /// timeout the maximum time to wait. If its set to 0 then pool creation
+        /// does not wait.
+        /// </param>
+        /// <exception>
+        /// IllegalArgumentException if timeout is less than 0.
+        /// </exception>
+        PoolFactory^ SetPrefillTimeout(TimeSpan timeout);
+
         /// <summary>
         /// Sets the redundancy level for this pools server-to-client subscriptions.
         /// </summary>
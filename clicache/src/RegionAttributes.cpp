@@ -587,6 +587,19 @@ namespace Apache
         }
       }
 
+      generic <class TKey, class TValue>
+      bool Client::RegionAttributes<TKey, TValue>::LruAdmissionEnabled::get()
+      {
+        try
+        {
+          return m_nativeptr->get()->getLruAdmissionEnabled( );
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+      }
+
       generic <class TKey, class TValue>
       Properties<String^, String^>^Client::RegionAttributes<TKey, TValue>::PersistenceProperties::get()
       {
@@ -432,6 +432,16 @@ namespace Apache
           bool get();
         }
 
+        /// <summary>
+        /// Returns the LRU admission enabled flag of the region
+        /// </summary>
+        /// <returns>the LRU admission enabled flag</returns>
+        /// <seealso cref="RegionAttributesFactory" />
+        property bool LruAdmissionEnabled
+        {
+          bool get();
+        }
+
         /// <summary>
         /// Serializes this Properties object.
         /// </summary>
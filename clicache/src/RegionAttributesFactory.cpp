@@ -480,6 +480,20 @@ namespace Apache
         }
         return this;
       }
+
+      generic<class TKey, class TValue>
+      RegionAttributesFactory<TKey, TValue>^  RegionAttributesFactory<TKey, TValue>::SetLruAdmissionEnabled( bool lruAdmissionEnabled )
+      {
+        try
+        {
+          m_nativeptr->get()->setLruAdmissionEnabled( lruAdmissionEnabled );
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+        return this;
+      }
       // FACTORY METHOD
 
       generic<class TKey, class TValue>
@@ -493,6 +493,23 @@ namespace Apache
         /// if true, version checks for region entries will occur.
         /// </param>
         RegionAttributesFactory<TKey, TValue>^ SetConcurrencyChecksEnabled( bool concurrencyChecksEnabled );
+
+        /// <summary>
+        /// Sets the LRU admission enabled flag for this region.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// If set to true, once the LRU entries limit is reached a new entry is
+        /// only kept if its key has been accessed more often than the least
+        /// recently used entry.
+        /// </para><para>
+        /// The default if not set is 'false'
+        /// </para>
+        /// </remarks>
+        /// <param name="lruAdmissionEnabled">
+        /// if true, entries are filtered by access frequency before LRU eviction.
+        /// </param>
+        RegionAttributesFactory<TKey, TValue>^ SetLruAdmissionEnabled( bool lruAdmissionEnabled );
         // FACTORY METHOD
 
         /// <summary>
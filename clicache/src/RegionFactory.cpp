@@ -350,6 +350,19 @@ namespace Apache
         }
         return this;
       }
+
+      RegionFactory^ RegionFactory::SetLruAdmissionEnabled( bool lruAdmissionEnabled )
+      {
+        try
+        {
+          m_nativeptr->get()->setLruAdmissionEnabled( lruAdmissionEnabled );
+        }
+        finally
+        {
+          GC::KeepAlive(m_nativeptr);
+        }
+        return this;
+      }
       // NEW GENERIC APIs:
 
       generic <class TKey, class TValue>
@@ -19,11 +19,14 @@
 
 #include <geode/CacheableString.hpp>
 
+#include "util/JavaModifiedUtf8.hpp"
 #include "util/string.hpp"
 
+using apache::geode::client::ascii_length;
 using apache::geode::client::to_utf16;
 using apache::geode::client::to_utf8;
 using apache::geode::client::internal::geode_hash;
+using apache::geode::client::internal::JavaModifiedUtf8;
 
 template <class ToString, class FromString>
 ToString convert(const FromString& from);
@@ -47,6 +50,60 @@ void GeodeHashBM(benchmark::State& state) {
     int hashcode;
     benchmark::DoNotOptimize(hashcode = geode_hash<String>{}(string));
   }
+  state.SetBytesProcessed(state.iterations() * string.length() *
+                          sizeof(typename String::value_type));
+}
+
+template <class String, char32_t UnicodeChar>
+void AsciiLengthBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const String string = convert<String>(u32String);
+
+  for (auto _ : state) {
+    size_t length;
+    benchmark::DoNotOptimize(
+        length = ascii_length(string.data(), string.length()));
+  }
+  state.SetBytesProcessed(state.iterations() * string.length() *
+                          sizeof(typename String::value_type));
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8EncodedLengthBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const auto string = convert<std::u16string>(u32String);
+
+  for (auto _ : state) {
+    size_t length;
+    benchmark::DoNotOptimize(length = JavaModifiedUtf8::encodedLength(string));
+  }
+  state.SetBytesProcessed(state.iterations() * string.length() *
+                          sizeof(char16_t));
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8EncodeBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const auto string = convert<std::u16string>(u32String);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::fromString(string));
+  }
+  state.SetBytesProcessed(state.iterations() * string.length() *
+                          sizeof(char16_t));
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8DecodeBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const auto encoded =
+      JavaModifiedUtf8::fromString(convert<std::u16string>(u32String));
+  const auto length = static_cast<uint16_t>(encoded.length());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::decode(encoded.data(), length));
+  }
+  state.SetBytesProcessed(state.iterations() * length);
 }
 
 constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
@@ -70,3 +127,22 @@ BENCHMARK_TEMPLATE(GeodeHashBM, std::string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
 BENCHMARK_TEMPLATE(GeodeHashBM, std::u16string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
+
+BENCHMARK_TEMPLATE(AsciiLengthBM, std::string, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(AsciiLengthBM, std::u16string, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodedLengthBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodedLengthBM,
+                   SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxReader.hpp>
+#include <geode/PdxSchema.hpp>
+#include <geode/PdxWriter.hpp>
+#include <geode/TypeRegistry.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxReader;
+using apache::geode::client::PdxSchemaSerializable;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriter;
+using apache::geode::client::PdxWriterWithTypeCollector;
+using apache::geode::client::Serializable;
+
+class PdxSchemaBMPlainOrder : public PdxSerializable {
+ public:
+  int32_t orderId = 42;
+  std::string name = "order name";
+  double amount = 12.5;
+  std::vector<int64_t> lines = {1, 2, 3, 4};
+  bool shipped = true;
+
+  void toData(PdxWriter& output) const override {
+    output.writeInt("orderId", orderId)
+        .writeString("name", name)
+        .writeDouble("amount", amount)
+        .writeLongArray("lines", lines)
+        .writeBoolean("shipped", shipped);
+  }
+
+  void fromData(PdxReader& input) override {
+    orderId = input.readInt("orderId");
+    name = input.readString("name");
+    amount = input.readDouble("amount");
+    lines = input.readLongArray("lines");
+    shipped = input.readBoolean("shipped");
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "PdxSchemaBM.PlainOrder";
+    return className;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<PdxSchemaBMPlainOrder>();
+  }
+};
+
+class PdxSchemaBMSchemaOrder
+    : public PdxSchemaSerializable<PdxSchemaBMSchemaOrder> {
+ public:
+  int32_t orderId = 42;
+  std::string name = "order name";
+  double amount = 12.5;
+  std::vector<int64_t> lines = {1, 2, 3, 4};
+  bool shipped = true;
+
+  template <class Schema>
+  void pdxSchema(Schema& schema) {
+    schema.field("orderId", orderId)
+        .field("name", name)
+        .field("amount", amount)
+        .field("lines", lines)
+        .field("shipped", shipped);
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "PdxSchemaBM.SchemaOrder";
+    return className;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<PdxSchemaBMSchemaOrder>();
+  }
+};
+
+// registers the type locally, as the server would, since there is no pool
+template <class T>
+static std::shared_ptr<T> registerType(Cache& cache) {
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  cache.getTypeRegistry().registerPdxType(T::createDeserializable);
+
+  auto object = std::make_shared<T>();
+  auto output = cache.createDataOutput();
+  PdxWriterWithTypeCollector collector(output, object->getClassName(),
+                                       registry);
+  static_cast<const PdxSerializable&>(*object).toData(collector);
+  auto type = collector.getPdxLocalType();
+  type->InitializeType();
+  type->setTypeId(1);
+  registry->addLocalPdxType(object->getClassName(), type);
+  registry->addPdxType(1, type);
+  return object;
+}
+
+template <class T>
+static void PdxSchemaBM_serialize(benchmark::State& state) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto object = registerType<T>(cache);
+
+  for (auto _ : state) {
+    auto output = cache.createDataOutput();
+    output.writeObject(object);
+    benchmark::DoNotOptimize(output.getBufferLength());
+  }
+
+  cache.close();
+}
+
+template <class T>
+static void PdxSchemaBM_deserialize(benchmark::State& state) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto object = registerType<T>(cache);
+
+  auto output = cache.createDataOutput();
+  output.writeObject(object);
+
+  for (auto _ : state) {
+    auto input =
+        cache.createDataInput(output.getBuffer(), output.getBufferLength());
+    std::shared_ptr<Serializable> result;
+    input.readObject(result);
+    benchmark::DoNotOptimize(result);
+  }
+
+  cache.close();
+}
+
+BENCHMARK_TEMPLATE(PdxSchemaBM_serialize, PdxSchemaBMPlainOrder);
+BENCHMARK_TEMPLATE(PdxSchemaBM_serialize, PdxSchemaBMSchemaOrder);
+BENCHMARK_TEMPLATE(PdxSchemaBM_deserialize, PdxSchemaBMPlainOrder);
+BENCHMARK_TEMPLATE(PdxSchemaBM_deserialize, PdxSchemaBMSchemaOrder);
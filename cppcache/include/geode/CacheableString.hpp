@@ -135,7 +135,7 @@ class APACHE_GEODE_EXPORT CacheableString
 
 template <>
 inline std::shared_ptr<CacheableKey> CacheableKey::create(std::string value) {
-  return CacheableString::create(value);
+  return CacheableString::create(std::move(value));
 }
 
 template <>
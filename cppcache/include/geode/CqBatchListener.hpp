@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef GEODE_CQBATCHLISTENER_H_
+#define GEODE_CQBATCHLISTENER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <vector>
+
+#include "CqListener.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Extension of CqListener for continuous queries with high event rates.
+ * Events that arrive together are delivered to onEvents in one call per CQ,
+ * in the order they were received, instead of one onEvent call per event.
+ * Errors are still delivered through onError, after any events received
+ * before them.
+ */
+class APACHE_GEODE_EXPORT CqBatchListener : public CqListener {
+ public:
+  /**
+   * Called with the events that satisfied the query condition of this CQ.
+   * The events are only valid for the duration of the call, so listeners
+   * must copy anything they want to keep.
+   *
+   * The default implementation calls onEvent for each event.
+   */
+  virtual void onEvents(
+      const std::vector<std::reference_wrapper<const CqEvent>>& events);
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CQBATCHLISTENER_H_
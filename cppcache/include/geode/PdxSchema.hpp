@@ -0,0 +1,546 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXSCHEMA_H_
+#define GEODE_PDXSCHEMA_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CacheableDate.hpp"
+#include "DataInput.hpp"
+#include "DataOutput.hpp"
+#include "PdxReader.hpp"
+#include "PdxSerializable.hpp"
+#include "PdxWriter.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Writes the fields of a PdxSchemaSerializable straight to a DataOutput in
+ * the layout PdxWriter would produce for the registered type, without
+ * looking at field names.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaWriter {
+ public:
+  PdxSchemaWriter(DataOutput& output, int32_t typeId);
+
+  PdxSchemaWriter(const PdxSchemaWriter&) = delete;
+  PdxSchemaWriter& operator=(const PdxSchemaWriter&) = delete;
+
+  PdxSchemaWriter& field(const char*, bool value) {
+    output_.writeBoolean(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, char16_t value) {
+    output_.writeChar(static_cast<uint16_t>(value));
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, int8_t value) {
+    output_.write(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, int16_t value) {
+    output_.writeInt(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, int32_t value) {
+    output_.writeInt(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, int64_t value) {
+    output_.writeInt(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, float value) {
+    output_.writeFloat(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, double value) {
+    output_.writeDouble(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*,
+                         const std::shared_ptr<CacheableDate>& value) {
+    if (value != nullptr) {
+      value->toData(output_);
+    } else {
+      output_.writeInt(static_cast<uint64_t>(-1L));
+    }
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*, const std::string& value) {
+    addOffset();
+    output_.writeString(value);
+    return *this;
+  }
+
+  PdxSchemaWriter& field(const char*,
+                         const std::vector<std::string>& value) {
+    addOffset();
+    output_.writeArrayLen(static_cast<int32_t>(value.size()));
+    for (const auto& element : value) {
+      output_.writeString(element);
+    }
+    return *this;
+  }
+
+  template <class T>
+  PdxSchemaWriter& field(const char*, const std::vector<T>& value) {
+    addOffset();
+    output_.writeArrayLen(static_cast<int32_t>(value.size()));
+    for (const auto& element : value) {
+      writeElement(element);
+    }
+    return *this;
+  }
+
+  /**
+   * Writes the header and the offsets of the variable length fields.
+   * Returns the length of the serialized fields and offsets.
+   */
+  int32_t end();
+
+ private:
+  static const size_t INLINE_OFFSETS = 16;
+
+  void writeElement(bool value) { output_.writeBoolean(value); }
+  void writeElement(char16_t value) {
+    output_.writeInt(static_cast<uint16_t>(value));
+  }
+  void writeElement(int8_t value) { output_.write(value); }
+  void writeElement(int16_t value) { output_.writeInt(value); }
+  void writeElement(int32_t value) { output_.writeInt(value); }
+  void writeElement(int64_t value) { output_.writeInt(value); }
+  void writeElement(float value) { output_.writeFloat(value); }
+  void writeElement(double value) { output_.writeDouble(value); }
+
+  void addOffset();
+  int32_t offset(size_t index) const;
+
+  DataOutput& output_;
+  int32_t typeId_;
+  size_t start_;
+  size_t offsetCount_;
+  int32_t offsets_[INLINE_OFFSETS];
+  std::vector<int32_t> moreOffsets_;
+};
+
+/**
+ * Reads the fields of a PdxSchemaSerializable straight from a DataInput
+ * holding an object of the type registered for it.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaReader {
+ public:
+  explicit PdxSchemaReader(DataInput& input) : input_(input) {}
+
+  PdxSchemaReader(const PdxSchemaReader&) = delete;
+  PdxSchemaReader& operator=(const PdxSchemaReader&) = delete;
+
+  PdxSchemaReader& field(const char*, bool& value) {
+    value = input_.readBoolean();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, char16_t& value) {
+    value = static_cast<char16_t>(input_.readInt16());
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, int8_t& value) {
+    value = input_.read();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, int16_t& value) {
+    value = input_.readInt16();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, int32_t& value) {
+    value = input_.readInt32();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, int64_t& value) {
+    value = input_.readInt64();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, float& value) {
+    value = input_.readFloat();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, double& value) {
+    value = input_.readDouble();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*,
+                         std::shared_ptr<CacheableDate>& value) {
+    value = CacheableDate::create();
+    value->fromData(input_);
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::string& value) {
+    value = input_.readString();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<std::string>& value) {
+    value = input_.readStringArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<bool>& value) {
+    value = input_.readBooleanArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<char16_t>& value) {
+    value = input_.readCharArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<int8_t>& value) {
+    value = input_.readByteArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<int16_t>& value) {
+    value = input_.readShortArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<int32_t>& value) {
+    value = input_.readIntArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<int64_t>& value) {
+    value = input_.readLongArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<float>& value) {
+    value = input_.readFloatArray();
+    return *this;
+  }
+
+  PdxSchemaReader& field(const char*, std::vector<double>& value) {
+    value = input_.readDoubleArray();
+    return *this;
+  }
+
+ private:
+  DataInput& input_;
+};
+
+/**
+ * Non-template part of PdxSchemaSerializable, used by the library to find
+ * the schema of an object.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaSerializableBase : public PdxSerializable {
+ public:
+  ~PdxSchemaSerializableBase() noexcept override = default;
+
+  /**
+   * Returns the id of the PDX type registered for this class with the
+   * registry of the given generation, or -1 if it is not known yet.
+   */
+  int32_t getCachedTypeId(uint32_t generation) const {
+    auto cached = typeIdCache().load(std::memory_order_acquire);
+    return static_cast<uint32_t>(cached >> 32) == generation
+               ? static_cast<int32_t>(cached & 0xffffffff)
+               : -1;
+  }
+
+  void setCachedTypeId(uint32_t generation, int32_t typeId) const {
+    typeIdCache().store((static_cast<uint64_t>(generation) << 32) |
+                            static_cast<uint32_t>(typeId),
+                        std::memory_order_release);
+  }
+
+  /**
+   * True if this object was read with a type other than the one registered
+   * for its class, which may have left unread fields to preserve.
+   */
+  bool isReadFromOtherType() const { return readFromOtherType_; }
+
+  virtual void toData(PdxSchemaWriter& output) const = 0;
+
+  virtual void fromData(PdxSchemaReader& input) = 0;
+
+  using PdxSerializable::fromData;
+  using PdxSerializable::toData;
+
+ protected:
+  virtual std::atomic<uint64_t>& typeIdCache() const = 0;
+
+  bool readFromOtherType_ = false;
+};
+
+/**
+ * Base for classes whose PDX fields are declared once, in a member function
+ * template, instead of in hand written toData and fromData methods:
+ *
+ * <pre>
+ * class Order : public PdxSchemaSerializable<Order> {
+ *  public:
+ *   template <class Schema>
+ *   void pdxSchema(Schema& schema) {
+ *     schema.field("orderId", orderId).field("name", name);
+ *   }
+ *   ...
+ * };
+ * </pre>
+ *
+ * Fields may be bool, char16_t, int8_t, int16_t, int32_t, int64_t, float,
+ * double, std::string, std::shared_ptr<CacheableDate>, or std::vector of any
+ * of the first nine. The first time a class is serialized it goes through
+ * PdxWriter to register its type; after that the type id is cached in a
+ * static and fields are written and read without name lookups or virtual
+ * calls per field. The bytes are the same either way. Field names are
+ * taken as const char*, so declaring a field with a literal name builds no
+ * string on that fast path.
+ */
+template <class T>
+class PdxSchemaSerializable : public PdxSchemaSerializableBase {
+ public:
+  ~PdxSchemaSerializable() noexcept override = default;
+
+  void toData(PdxWriter& output) const override {
+    Writer writer{output};
+    self().pdxSchema(writer);
+  }
+
+  void fromData(PdxReader& input) override {
+    Reader reader{input};
+    static_cast<T&>(*this).pdxSchema(reader);
+    readFromOtherType_ = true;
+  }
+
+  void toData(PdxSchemaWriter& output) const override {
+    self().pdxSchema(output);
+  }
+
+  void fromData(PdxSchemaReader& input) override {
+    static_cast<T&>(*this).pdxSchema(input);
+    readFromOtherType_ = false;
+  }
+
+ protected:
+  std::atomic<uint64_t>& typeIdCache() const override {
+    static std::atomic<uint64_t> typeIdCache{0};
+    return typeIdCache;
+  }
+
+ private:
+  // pdxSchema only reads the fields when given a writer
+  T& self() const { return const_cast<T&>(static_cast<const T&>(*this)); }
+
+  struct Writer {
+    PdxWriter& output;
+
+    Writer& field(const char* name, bool value) {
+      output.writeBoolean(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, char16_t value) {
+      output.writeChar(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, int8_t value) {
+      output.writeByte(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, int16_t value) {
+      output.writeShort(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, int32_t value) {
+      output.writeInt(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, int64_t value) {
+      output.writeLong(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, float value) {
+      output.writeFloat(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, double value) {
+      output.writeDouble(name, value);
+      return *this;
+    }
+    Writer& field(const char* name,
+                  const std::shared_ptr<CacheableDate>& value) {
+      output.writeDate(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::string& value) {
+      output.writeString(name, value);
+      return *this;
+    }
+    Writer& field(const char* name,
+                  const std::vector<std::string>& value) {
+      output.writeStringArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<bool>& value) {
+      output.writeBooleanArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name,
+                  const std::vector<char16_t>& value) {
+      output.writeCharArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<int8_t>& value) {
+      output.writeByteArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<int16_t>& value) {
+      output.writeShortArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<int32_t>& value) {
+      output.writeIntArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<int64_t>& value) {
+      output.writeLongArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<float>& value) {
+      output.writeFloatArray(name, value);
+      return *this;
+    }
+    Writer& field(const char* name, const std::vector<double>& value) {
+      output.writeDoubleArray(name, value);
+      return *this;
+    }
+  };
+
+  struct Reader {
+    PdxReader& input;
+
+    Reader& field(const char* name, bool& value) {
+      value = input.readBoolean(name);
+      return *this;
+    }
+    Reader& field(const char* name, char16_t& value) {
+      value = input.readChar(name);
+      return *this;
+    }
+    Reader& field(const char* name, int8_t& value) {
+      value = input.readByte(name);
+      return *this;
+    }
+    Reader& field(const char* name, int16_t& value) {
+      value = input.readShort(name);
+      return *this;
+    }
+    Reader& field(const char* name, int32_t& value) {
+      value = input.readInt(name);
+      return *this;
+    }
+    Reader& field(const char* name, int64_t& value) {
+      value = input.readLong(name);
+      return *this;
+    }
+    Reader& field(const char* name, float& value) {
+      value = input.readFloat(name);
+      return *this;
+    }
+    Reader& field(const char* name, double& value) {
+      value = input.readDouble(name);
+      return *this;
+    }
+    Reader& field(const char* name,
+                  std::shared_ptr<CacheableDate>& value) {
+      value = input.readDate(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::string& value) {
+      value = input.readString(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<std::string>& value) {
+      value = input.readStringArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<bool>& value) {
+      value = input.readBooleanArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<char16_t>& value) {
+      value = input.readCharArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<int8_t>& value) {
+      value = input.readByteArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<int16_t>& value) {
+      value = input.readShortArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<int32_t>& value) {
+      value = input.readIntArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<int64_t>& value) {
+      value = input.readLongArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<float>& value) {
+      value = input.readFloatArray(name);
+      return *this;
+    }
+    Reader& field(const char* name, std::vector<double>& value) {
+      value = input.readDoubleArray(name);
+      return *this;
+    }
+  };
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXSCHEMA_H_
@@ -132,6 +132,12 @@ class APACHE_GEODE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   std::chrono::milliseconds getUpdateLocatorListInterval() const;
 
+  /**
+   * Gets the maximum age of the cached server list for this pool.
+   * @see PoolFactory#setServerSnapshotInterval
+   */
+  std::chrono::milliseconds getServerSnapshotInterval() const;
+
   /**
    * Gets the statistic interval for this pool.
    * @see PoolFactory#setStatisticInterval(int)
@@ -195,6 +201,25 @@ class APACHE_GEODE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   bool getPRSingleHopEnabled() const;
 
+  /**
+   * Returns true if adaptive sizing is enabled on this pool.
+   * @see PoolFactory#setAdaptiveSizingEnabled
+   */
+  bool getAdaptiveSizingEnabled() const;
+
+  /**
+   * Returns how many connections this pool opens at the same time while
+   * filling up to its minimum connections.
+   * @see PoolFactory#setPrefillParallelism
+   */
+  int getPrefillParallelism() const;
+
+  /**
+   * Returns how long creating this pool waits for its minimum connections.
+   * @see PoolFactory#setPrefillTimeout
+   */
+  std::chrono::milliseconds getPrefillTimeout() const;
+
   /**
    * If this pool was configured to use <code>threadlocalconnections</code>,
    * then this method will release the connection cached for the calling thread.
@@ -132,6 +132,12 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   static const std::chrono::milliseconds DEFAULT_UPDATE_LOCATOR_LIST_INTERVAL;
 
+  /**
+   * The default maximum age of the locally cached server list.
+   * <p>Current value: <code>0</code>, which disables the cache.
+   */
+  static const std::chrono::milliseconds DEFAULT_SERVER_SNAPSHOT_INTERVAL;
+
   /**
    * The default frequency that client statistics are sent to the server.
    * <p>Current value: <code>std::chrono::milliseconds::zero()</code>
@@ -191,6 +197,25 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   static constexpr bool DEFAULT_PR_SINGLE_HOP_ENABLED = true;
 
+  /**
+   * The default value for whether the pool sizes itself adaptively.
+   * <p>Current value: <code>false</code>.
+   */
+  static constexpr bool DEFAULT_ADAPTIVE_SIZING_ENABLED = false;
+
+  /**
+   * The default number of connections opened at the same time while filling
+   * the pool up to its minimum connections.
+   * <p>Current value: <code>4</code>.
+   */
+  static constexpr int DEFAULT_PREFILL_PARALLELISM = 4;
+
+  /**
+   * The default time pool creation waits for the minimum connections.
+   * <p>Current value: <code>0</code>, which does not wait.
+   */
+  static const std::chrono::milliseconds DEFAULT_PREFILL_TIMEOUT;
+
   /**
    * Sets the free connection timeout for this pool.
    * If the pool has a max connections setting, operations will block
@@ -364,6 +389,24 @@ class APACHE_GEODE_EXPORT PoolFactory {
   PoolFactory& setUpdateLocatorListInterval(
       std::chrono::milliseconds updateLocatorListInterval);
 
+  /**
+   * How long the pool may place new connections using its cached list of
+   * servers before asking a locator for that list again. While the list is
+   * fresh, new connections go to a server picked at random, favoring servers
+   * this client has fewer connections to, instead of to the server a locator
+   * picks for each connection. Replacement connections made for load
+   * conditioning still ask a locator. To disable this set its value to
+   * std::chrono::milliseconds::zero(), which is the default.
+   *
+   * @param serverSnapshotInterval is the maximum age of the cached server
+   * list.
+   * @return a reference to <code>this</code>
+   * @throws IllegalArgumentException if <code>serverSnapshotInterval</code>
+   * is less than <code>0</code>.
+   */
+  PoolFactory& setServerSnapshotInterval(
+      std::chrono::milliseconds serverSnapshotInterval);
+
   /**
    * The frequency with which the client statistics must be sent to the server.
    * Doing this allows <code>GFMon</code> to monitor clients.
@@ -536,6 +579,49 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   PoolFactory& setPRSingleHopEnabled(bool enabled);
 
+  /**
+   * By default setAdaptiveSizingEnabled is false.<br>
+   * If true, the pool samples how long operations wait to check out a
+   * connection, how many operations are in flight per server and how long
+   * they take, about once a second, and opens or closes connections to each
+   * server to match. Connections are only opened up to
+   * {@link PoolFactory#setMaxConnections(int)} and only closed down to
+   * {@link PoolFactory#setMinConnections(int)}; idle timeout and load
+   * conditioning still apply.
+   * @param enabled is a boolean indicating whether adaptive sizing should be
+   * enabled or not.
+   * @return a reference to <code>this</code>
+   */
+  PoolFactory& setAdaptiveSizingEnabled(bool enabled);
+
+  /**
+   * Sets how many connections the pool opens at the same time when it fills
+   * up to its minimum connections, at startup and after connections are
+   * lost. Each connection may need a locator request, a TCP connect, a TLS
+   * handshake and the server handshake, so opening several at once shortens
+   * the time until a pool with many minimum connections is ready.
+   *
+   * @param parallelism is the number of connections opened at the same time.
+   * @return a reference to <code>this</code>
+   * @throws IllegalArgumentException if <code>parallelism</code> is less than
+   * <code>1</code>.
+   */
+  PoolFactory& setPrefillParallelism(int parallelism);
+
+  /**
+   * Sets how long creating the pool waits for it to hold its minimum
+   * connections. Connections are opened in the background either way; if the
+   * timeout passes first the pool is returned anyway and keeps filling. To
+   * not wait set its value to std::chrono::milliseconds::zero(), which is the
+   * default.
+   *
+   * @param timeout is the maximum time to wait.
+   * @return a reference to <code>this</code>
+   * @throws IllegalArgumentException if <code>timeout</code> is less than
+   * <code>0</code>.
+   */
+  PoolFactory& setPrefillTimeout(std::chrono::milliseconds timeout);
+
   ~PoolFactory() = default;
 
   PoolFactory(const PoolFactory&) = default;
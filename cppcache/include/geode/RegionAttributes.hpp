@@ -310,6 +310,15 @@ class APACHE_GEODE_EXPORT RegionAttributes
   bool getConcurrencyChecksEnabled() const {
     return m_isConcurrencyChecksEnabled;
   }
+
+  /**
+   * Returns true if entries must be accessed more often than the least
+   * recently used entry to be kept in this region once its LRU limit is
+   * reached.
+   * @return true if the LRU admission filter is turned on
+   */
+  bool getLruAdmissionEnabled() const { return m_isLruAdmissionEnabled; }
+
   RegionAttributes& operator=(const RegionAttributes&) = default;
 
  private:
@@ -330,6 +339,7 @@ class APACHE_GEODE_EXPORT RegionAttributes
   void setLruEntriesLimit(int limit);
   void setDiskPolicy(DiskPolicyType diskPolicy);
   void setConcurrencyChecksEnabled(bool enable);
+  void setLruAdmissionEnabled(bool enable);
 
   inline bool getEntryExpiryEnabled() const {
     return (m_entryTimeToLive > std::chrono::seconds::zero() ||
@@ -378,6 +388,7 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  bool m_isLruAdmissionEnabled;
   friend class RegionAttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -138,6 +138,12 @@ namespace client {
  *         {@link #setConcurrencyLevel} {@link
  * RegionAttributes#getConcurrencyLevel}</dd>
  *
+ * <dt>LruAdmissionEnabled [<em>default:</em> <code>false</code>]</dt>
+ *     <dd>Whether a new entry has to be accessed more often than the least
+ *         recently used entry to replace it once the LRU limit is reached.<br>
+ *         {@link #setLruAdmissionEnabled} {@link
+ * RegionAttributes#getLruAdmissionEnabled}</dd>
+ *
  * <dt>StatisticsEnabled [<em>default:</em> <code>false</code>]</dt>
  *     <dd>Whether statistics are enabled for this region. The default
  *     is disabled, which conserves on memory.<br>
@@ -427,6 +433,18 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setConcurrencyChecksEnabled(
       bool concurrencyChecksEnabled);
 
+  /**
+   * Enables or disables the frequency based admission filter in front of LRU
+   * eviction. When enabled, an entry that would make the region exceed its
+   * LRU entries limit is only kept if its key has been accessed more often
+   * recently than the least recently used entry; otherwise it is the one
+   * evicted. This keeps a scan over many keys from flushing the frequently
+   * used entries. Has no effect unless an LRU entries limit is set.
+   * @param lruAdmissionEnabled whether to filter entries admitted to the LRU
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setLruAdmissionEnabled(bool lruAdmissionEnabled);
+
   // FACTORY METHOD
 
   /**
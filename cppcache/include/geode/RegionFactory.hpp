@@ -262,6 +262,15 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Enables or disables the frequency based admission filter in front of LRU
+   * eviction.
+   * @param enable whether to filter entries admitted to the LRU
+   * @return a reference to <code>this</code>
+   * @see RegionAttributesFactory#setLruAdmissionEnabled
+   */
+  RegionFactory& setLruAdmissionEnabled(bool enable);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
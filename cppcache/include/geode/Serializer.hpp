@@ -262,7 +262,18 @@ template <typename TObj,
           typename std::enable_if<!std::is_base_of<Serializable, TObj>::value,
                                   Serializable>::type* = nullptr>
 inline size_t objectArraySize(const std::vector<TObj>& array) {
-  return sizeof(TObj) * array.size();
+  return sizeof(TObj) * array.capacity();
+}
+
+template <typename TObj>
+inline size_t objectArraySize(const std::vector<std::shared_ptr<TObj>>& array) {
+  size_t size = sizeof(std::shared_ptr<TObj>) * array.capacity();
+  for (const auto& obj : array) {
+    if (obj) {
+      size += obj->objectSize();
+    }
+  }
+  return size;
 }
 
 template <typename TObj,
@@ -318,7 +329,7 @@ inline size_t objectSize(const std::vector<std::shared_ptr<Cacheable>>& value) {
       objectSize += iter->objectSize();
     }
   }
-  objectSize += sizeof(std::shared_ptr<Cacheable>) * value.size();
+  objectSize += sizeof(std::shared_ptr<Cacheable>) * value.capacity();
   return objectSize;
 }
 
@@ -348,9 +359,11 @@ inline void writeObject(
 }
 
 inline size_t objectSize(const HashMapOfCacheable& value) {
-  auto objectSize = (sizeof(std::shared_ptr<CacheableKey>) +
-                     sizeof(std::shared_ptr<Cacheable>)) *
-                    value.size();
+  // each node holds a next pointer and the cached hash besides the pair
+  auto objectSize = (sizeof(HashMapOfCacheable::value_type) +
+                     sizeof(void*) + sizeof(size_t)) *
+                        value.size() +
+                    sizeof(void*) * value.bucket_count();
   for (const auto& iter : value) {
     objectSize += iter.first->objectSize();
     if (iter.second) {
@@ -389,7 +402,10 @@ inline void writeObject(
 }
 
 inline size_t objectSize(const HashSetOfCacheableKey& value) {
-  auto objectSize = sizeof(std::shared_ptr<CacheableKey>) * value.size();
+  auto objectSize = (sizeof(HashSetOfCacheableKey::value_type) +
+                     sizeof(void*) + sizeof(size_t)) *
+                        value.size() +
+                    sizeof(void*) * value.bucket_count();
   for (const auto& iter : value) {
     if (iter) {
       objectSize += iter->objectSize();
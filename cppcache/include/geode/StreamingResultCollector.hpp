@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "CacheableBuiltins.hpp"
+#include "ResultCollector.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A ResultCollector that hands each function result to a handler as soon as
+ * the chunk holding it is read, instead of keeping the results until
+ * getResult is called.
+ *
+ * The handler is called without any lock held, concurrently from the threads
+ * reading the replies of different servers, so it must be thread safe. It
+ * returns false once the caller has all the results it needs; results still
+ * arriving are then skipped without being deserialized, and requests not yet
+ * sent to their servers are not sent. cancel() does the same from any other
+ * thread.
+ *
+ * Since results are not kept, getResult returns an empty vector once the
+ * execution has ended. When a function is executed again for high
+ * availability, results already handed over may be handed over again.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  using ResultHandler = std::function<bool(const std::shared_ptr<Cacheable>&)>;
+
+  explicit StreamingResultCollector(ResultHandler handler);
+  ~StreamingResultCollector() noexcept override;
+
+  /**
+   * Waits for the execution to end, returning an empty vector.
+   * @throws FunctionException if it did not end within timeout
+   */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  void clearResults() override;
+
+  /**
+   * Stops handing over results and skips the ones not received yet.
+   */
+  void cancel();
+
+  bool isCancelled() const;
+
+ private:
+  ResultHandler handler_;
+  std::atomic<bool> cancelled_;
+  bool ready_;
+  std::condition_variable readyCondition_;
+  std::mutex readyMutex_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
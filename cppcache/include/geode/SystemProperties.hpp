@@ -225,11 +225,48 @@ class APACHE_GEODE_EXPORT SystemProperties {
     return m_bucketWaitTimeout;
   }
 
+  /**
+   * Returns how long resolved server and locator addresses are cached.
+   */
+  const std::chrono::milliseconds& dnsCacheTtl() const {
+    return m_dnsCacheTtl;
+  }
+
+  /**
+   * Returns how long a failure to resolve a host name is cached.
+   */
+  const std::chrono::milliseconds& dnsNegativeCacheTtl() const {
+    return m_dnsNegativeCacheTtl;
+  }
+
+  /**
+   * Returns true if built-in objects decoded from getAll, query and function
+   * results are allocated together per response. Any one of them still
+   * referenced keeps the memory of its whole response alive.
+   */
+  bool deserializationArenaEnabled() const {
+    return m_deserializationArenaEnabled;
+  }
+
   /**
    * Returns client Queueconflation option
    */
   const std::string& conflateEvents() const { return m_conflateEvents; }
 
+  /**
+   * Returns true if subscription events waiting to be applied are conflated
+   * by the client, keeping only the latest pending update of each key.
+   */
+  bool clientConflateEvents() const { return m_clientConflateEvents; }
+
+  /**
+   * Returns how many events from a subscription endpoint may wait to be
+   * applied before the client stops reading more from it.
+   */
+  uint32_t clientConflateEventsQueueSize() const {
+    return m_clientConflateEventsQueueSize;
+  }
+
   const std::string& name() const { return m_name; }
 
   const std::string& cacheXMLFile() const { return m_cacheXMLFile; }
@@ -394,6 +431,9 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::milliseconds m_connectTimeout;
   std::chrono::milliseconds m_connectWaitTimeout;
   std::chrono::milliseconds m_bucketWaitTimeout;
+  std::chrono::milliseconds m_dnsCacheTtl;
+  std::chrono::milliseconds m_dnsNegativeCacheTtl;
+  bool m_deserializationArenaEnabled;
 
   bool m_autoReadyForEvents;
 
@@ -405,6 +445,8 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::string m_sslKeystorePassword;
 
   std::string m_conflateEvents;
+  bool m_clientConflateEvents;
+  uint32_t m_clientConflateEventsQueueSize;
 
   uint32_t m_threadPoolSize;
   std::chrono::seconds m_suspendedTxTimeout;
@@ -107,8 +107,8 @@ class CacheableArrayPrimitive : public DataSerializablePrimitive {
   DSCode getDsCode() const override { return GeodeTypeId; }
 
   size_t objectSize() const override {
-    return static_cast<uint32_t>(
-        apache::geode::client::serializer::objectArraySize(m_value));
+    return sizeof(CacheableArrayPrimitive) +
+           apache::geode::client::serializer::objectArraySize(m_value);
   }
 
  private:
@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AdaptivePoolSizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Connections kept per connection in use on average.
+constexpr double kHeadroom = 1.25;
+
+}  // namespace
+
+AdaptivePoolSizer::AdaptivePoolSizer(int32_t minConnections,
+                                     int32_t maxConnections)
+    : minConnections_(std::max(minConnections, 0)),
+      maxConnections_(maxConnections < 0
+                          ? (std::numeric_limits<int32_t>::max)()
+                          : std::max(maxConnections, minConnections)) {}
+
+std::vector<int32_t> AdaptivePoolSizer::resize(
+    const std::vector<EndpointLoad>& endpoints,
+    std::chrono::nanoseconds interval,
+    std::chrono::nanoseconds waitTime) const {
+  const auto waited = waitTime > std::chrono::nanoseconds::zero();
+  const auto seconds =
+      std::max(std::chrono::duration<double>(interval).count(), 1e-9);
+
+  std::vector<int32_t> targets;
+  targets.reserve(endpoints.size());
+
+  int64_t total = 0;
+  for (const auto& endpoint : endpoints) {
+    const auto connections = endpoint.connections;
+    const auto inUse =
+        std::chrono::duration<double>(endpoint.busyTime).count() / seconds;
+
+    auto needed = std::max(static_cast<int32_t>(std::ceil(inUse * kHeadroom)),
+                           endpoint.peakInFlight);
+    if (waited && endpoint.peakInFlight >= connections) {
+      needed = std::max(needed, connections + 1);
+    }
+
+    auto target = connections;
+    if (needed > connections) {
+      target = std::min(needed, connections + std::max(1, connections / 2));
+    } else if (!waited && needed < connections) {
+      target = connections - 1;
+    }
+
+    targets.push_back(target);
+    total += target;
+  }
+
+  // Trim growth, then undo shrinking, to stay within the pool's bounds.
+  for (bool changed = true; total > maxConnections_ && changed;) {
+    changed = false;
+    for (size_t i = 0; i < targets.size() && total > maxConnections_; i++) {
+      if (targets[i] > endpoints[i].connections) {
+        --targets[i];
+        --total;
+        changed = true;
+      }
+    }
+  }
+
+  for (bool changed = true; total < minConnections_ && changed;) {
+    changed = false;
+    for (size_t i = 0; i < targets.size() && total < minConnections_; i++) {
+      if (targets[i] < endpoints[i].connections) {
+        ++targets[i];
+        ++total;
+        changed = true;
+      }
+    }
+  }
+
+  return targets;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_ADAPTIVEPOOLSIZER_H_
+#define GEODE_ADAPTIVEPOOLSIZER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Decides per-endpoint connection counts for a pool in adaptive sizing mode.
+ *
+ * Over each sampling interval the pool reports, for every endpoint, how many
+ * connections it has, the most operations that were in flight at once and
+ * the total time operations held a connection. By Little's law the busy time
+ * divided by the interval is the mean number of connections in use; the
+ * sizer keeps some headroom above that and above the peak. Time spent
+ * waiting to check out a connection signals that the pool is too small.
+ * Growth is bounded per interval, shrinking happens one connection at a
+ * time and only when nobody waited, and the total stays within the pool's
+ * minimum and maximum connections.
+ */
+class AdaptivePoolSizer {
+ public:
+  struct EndpointLoad {
+    int32_t connections;
+    int32_t peakInFlight;
+    std::chrono::nanoseconds busyTime;
+  };
+
+  AdaptivePoolSizer(int32_t minConnections, int32_t maxConnections);
+
+  /**
+   * Returns the desired number of connections for each endpoint, in the
+   * same order as endpoints.
+   */
+  std::vector<int32_t> resize(const std::vector<EndpointLoad>& endpoints,
+                              std::chrono::nanoseconds interval,
+                              std::chrono::nanoseconds waitTime) const;
+
+ private:
+  int32_t minConnections_;
+  int32_t maxConnections_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_ADAPTIVEPOOLSIZER_H_
@@ -33,6 +33,7 @@
 #include "LocalRegion.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "SerializationRegistry.hpp"
+#include "SslContext.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
 #include "TcrMessage.hpp"
@@ -73,6 +74,9 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
       m_serializationRegistry(std::make_shared<SerializationRegistry>()),
       m_pdxTypeRegistry(nullptr),
       m_threadPool(m_distributedSystem.getSystemProperties().threadPoolSize()),
+      m_dnsResolver(m_distributedSystem.getSystemProperties().dnsCacheTtl(),
+                    m_distributedSystem.getSystemProperties()
+                        .dnsNegativeCacheTtl()),
       m_authInitialize(authInitialize),
       m_keepAlive(false) {
   using apache::geode::statistics::StatisticsManager;
@@ -103,6 +107,9 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
             prop.statsFileSizeLimit(), prop.statsDiskSpaceLimit()));
     m_cacheStats =
         new CachePerfStats(m_statisticsManager->getStatisticsFactory());
+    m_threadPool.setCachePerfStats(m_cacheStats);
+    m_dnsResolver.setCachePerfStats(m_cacheStats);
+    m_pdxTypeRegistry->setCachePerfStats(m_cacheStats);
   } catch (const NullPointerException&) {
     Log::close();
     throw;
@@ -295,6 +302,13 @@ void CacheImpl::close(bool keepAlive) {
     m_evictionController->stop();
   }
 
+  // Pool and resolver threads record into the cache stats, so stop them
+  // first. Work not yet started runs on the thread awaiting its result.
+  m_threadPool.shutDown();
+  m_threadPool.setCachePerfStats(nullptr);
+  m_dnsResolver.shutDown();
+  m_dnsResolver.setCachePerfStats(nullptr);
+
   // Close CachePef Stats
   if (m_cacheStats) {
     m_cacheStats->close();
@@ -309,6 +323,7 @@ void CacheImpl::close(bool keepAlive) {
 
   // Close CachePef Stats
   if (m_cacheStats) {
+    m_pdxTypeRegistry->setCachePerfStats(nullptr);
     _GEODE_SAFE_DELETE(m_cacheStats);
   }
 
@@ -324,8 +339,6 @@ void CacheImpl::close(bool keepAlive) {
 
   m_expiryTaskManager->stop();
 
-  m_threadPool.shutDown();
-
   try {
     getDistributedSystem().disconnect();
   } catch (const apache::geode::client::NotConnectedException&) {
@@ -780,6 +793,16 @@ std::shared_ptr<SerializationRegistry> CacheImpl::getSerializationRegistry()
 
 ThreadPool& CacheImpl::getThreadPool() { return m_threadPool; }
 
+SslContext& CacheImpl::getSslContext() {
+  std::call_once(m_sslContextOnce, [this] {
+    const auto& sysProp = m_distributedSystem.getSystemProperties();
+    m_sslContext = std::unique_ptr<SslContext>(
+        new SslContext(sysProp.sslTrustStore(), sysProp.sslKeyStore(),
+                       sysProp.sslKeystorePassword()));
+  });
+  return *m_sslContext;
+}
+
 std::shared_ptr<CacheTransactionManager>
 CacheImpl::getCacheTransactionManager() {
   this->throwIfClosed();
@@ -33,6 +33,7 @@
 #include "CachePerfStats.hpp"
 #include "ClientProxyMembershipIDFactory.hpp"
 #include "DistributedSystem.hpp"
+#include "DnsResolver.hpp"
 #include "MemberListForVersionStamp.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "RemoteQueryService.hpp"
@@ -59,6 +60,7 @@ class PdxTypeRegistry;
 class Pool;
 class RegionAttributes;
 class SerializationRegistry;
+class SslContext;
 class ThreadPool;
 class EvictionController;
 class TcrConnectionManager;
@@ -288,6 +290,14 @@ class APACHE_GEODE_EXPORT CacheImpl {
 
   ThreadPool& getThreadPool();
 
+  DnsResolver& getDnsResolver() { return m_dnsResolver; }
+
+  /**
+   * TLS context shared by the cache's connections, created from the ssl-*
+   * system properties on first use.
+   */
+  SslContext& getSslContext();
+
   inline const std::shared_ptr<AuthInitialize>& getAuthInitialize() {
     return m_authInitialize;
   }
@@ -379,9 +389,12 @@ class APACHE_GEODE_EXPORT CacheImpl {
   std::shared_ptr<SerializationRegistry> m_serializationRegistry;
   std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
   ThreadPool m_threadPool;
+  DnsResolver m_dnsResolver;
   const std::shared_ptr<AuthInitialize> m_authInitialize;
   std::unique_ptr<TypeRegistry> m_typeRegistry;
   bool m_keepAlive;
+  std::once_flag m_sslContextOnce;
+  std::unique_ptr<SslContext> m_sslContext;
 
   inline void throwIfClosed() const {
     if (m_closed) {
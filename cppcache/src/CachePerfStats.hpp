@@ -42,7 +42,7 @@ class CachePerfStats {
 
     if (statsType == nullptr) {
       const bool largerIsBetter = true;
-      std::vector<std::shared_ptr<StatisticDescriptor>> statDescArr(24);
+      std::vector<std::shared_ptr<StatisticDescriptor>> statDescArr(37);
 
       statDescArr[0] = factory->createIntCounter(
           "creates", "The total number of cache creates", "entries",
@@ -136,6 +136,61 @@ class CachePerfStats {
           "pdxDeserializedBytes",
           "Total number of bytes read by pdx deserialization.", "entries",
           !largerIsBetter);
+      statDescArr[24] = factory->createIntCounter(
+          "threadPoolTasks",
+          "Total number of tasks run by the cache thread pool workers.",
+          "operations", largerIsBetter);
+      statDescArr[25] = factory->createLongCounter(
+          "threadPoolQueueTime",
+          "Total time, in nanoseconds, tasks waited in the cache thread pool "
+          "before a worker started them.",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[26] = factory->createIntCounter(
+          "dnsCacheHits",
+          "Total number of host name lookups answered from the DNS cache.",
+          "operations", largerIsBetter);
+      statDescArr[27] = factory->createIntCounter(
+          "dnsCacheMisses",
+          "Total number of host name lookups that waited for DNS.",
+          "operations", !largerIsBetter);
+      statDescArr[28] = factory->createIntCounter(
+          "dnsResolves", "Total number of DNS queries, including refreshes.",
+          "operations", !largerIsBetter);
+      statDescArr[29] = factory->createIntCounter(
+          "dnsResolveFailures", "Total number of DNS queries that failed.",
+          "operations", !largerIsBetter);
+      statDescArr[30] = factory->createLongCounter(
+          "dnsResolveTime",
+          "Total time, in nanoseconds, spent in DNS queries.", "nanoseconds",
+          !largerIsBetter);
+      statDescArr[31] = factory->createIntCounter(
+          "heapLruEvictions",
+          "Total number of entries evicted to keep the heap under "
+          "heap-lru-limit.",
+          "entries", !largerIsBetter);
+      statDescArr[32] = factory->createLongCounter(
+          "heapLruEvictionTime",
+          "Total time, in nanoseconds, the eviction controller spent "
+          "evicting entries.",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[33] = factory->createIntCounter(
+          "heapLruAssists",
+          "Total number of writes that evicted entries themselves because "
+          "the heap was over heap-lru-limit.",
+          "operations", !largerIsBetter);
+      statDescArr[34] = factory->createLongCounter(
+          "heapLruAssistTime",
+          "Total time, in nanoseconds, writes were paused evicting entries.",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[35] = factory->createIntCounter(
+          "pdxTypeCacheHits",
+          "Total number of pdx type lookups answered from a thread's type "
+          "cache.",
+          "operations", largerIsBetter);
+      statDescArr[36] = factory->createIntCounter(
+          "pdxTypeCacheMisses",
+          "Total number of pdx type lookups that searched the type registry.",
+          "operations", !largerIsBetter);
 
       statsType = factory->createType("CachePerfStats",
                                       "Statistics about native client cache",
@@ -173,6 +228,19 @@ class CachePerfStats {
     m_pdxSerializedBytesId = statsType->nameToId("pdxSerializedBytes");
     m_pdxDeserializationsId = statsType->nameToId("pdxDeserializations");
     m_pdxDeserializedBytesId = statsType->nameToId("pdxDeserializedBytes");
+    m_threadPoolTasksId = statsType->nameToId("threadPoolTasks");
+    m_threadPoolQueueTimeId = statsType->nameToId("threadPoolQueueTime");
+    m_dnsCacheHitsId = statsType->nameToId("dnsCacheHits");
+    m_dnsCacheMissesId = statsType->nameToId("dnsCacheMisses");
+    m_dnsResolvesId = statsType->nameToId("dnsResolves");
+    m_dnsResolveFailuresId = statsType->nameToId("dnsResolveFailures");
+    m_dnsResolveTimeId = statsType->nameToId("dnsResolveTime");
+    m_heapLruEvictionsId = statsType->nameToId("heapLruEvictions");
+    m_heapLruEvictionTimeId = statsType->nameToId("heapLruEvictionTime");
+    m_heapLruAssistsId = statsType->nameToId("heapLruAssists");
+    m_heapLruAssistTimeId = statsType->nameToId("heapLruAssistTime");
+    m_pdxTypeCacheHitsId = statsType->nameToId("pdxTypeCacheHits");
+    m_pdxTypeCacheMissesId = statsType->nameToId("pdxTypeCacheMisses");
 
     // Set initial value
     m_cachePerfStats->setInt(m_destroysId, 0);
@@ -199,6 +267,19 @@ class CachePerfStats {
     m_cachePerfStats->setLong(m_pdxSerializedBytesId, 0);
     m_cachePerfStats->setInt(m_pdxDeserializationsId, 0);
     m_cachePerfStats->setLong(m_pdxDeserializedBytesId, 0);
+    m_cachePerfStats->setInt(m_threadPoolTasksId, 0);
+    m_cachePerfStats->setLong(m_threadPoolQueueTimeId, 0);
+    m_cachePerfStats->setInt(m_dnsCacheHitsId, 0);
+    m_cachePerfStats->setInt(m_dnsCacheMissesId, 0);
+    m_cachePerfStats->setInt(m_dnsResolvesId, 0);
+    m_cachePerfStats->setInt(m_dnsResolveFailuresId, 0);
+    m_cachePerfStats->setLong(m_dnsResolveTimeId, 0);
+    m_cachePerfStats->setInt(m_heapLruEvictionsId, 0);
+    m_cachePerfStats->setLong(m_heapLruEvictionTimeId, 0);
+    m_cachePerfStats->setInt(m_heapLruAssistsId, 0);
+    m_cachePerfStats->setLong(m_heapLruAssistTimeId, 0);
+    m_cachePerfStats->setInt(m_pdxTypeCacheHitsId, 0);
+    m_cachePerfStats->setInt(m_pdxTypeCacheMissesId, 0);
   }
 
   CachePerfStats(const CachePerfStats& other) = default;
@@ -323,6 +404,70 @@ class CachePerfStats {
     return m_cachePerfStats->getLong(m_pdxDeserializedBytesId);
   }
 
+  inline void incThreadPoolTasks(int64_t queueTime) {
+    m_cachePerfStats->incInt(m_threadPoolTasksId, 1);
+    m_cachePerfStats->incLong(m_threadPoolQueueTimeId, queueTime);
+  }
+
+  inline int32_t getThreadPoolTasks() {
+    return m_cachePerfStats->getInt(m_threadPoolTasksId);
+  }
+
+  inline int64_t getThreadPoolQueueTime() {
+    return m_cachePerfStats->getLong(m_threadPoolQueueTimeId);
+  }
+
+  inline void incDnsCacheHits() {
+    m_cachePerfStats->incInt(m_dnsCacheHitsId, 1);
+  }
+
+  inline void incDnsCacheMisses() {
+    m_cachePerfStats->incInt(m_dnsCacheMissesId, 1);
+  }
+
+  inline void incDnsResolves(int64_t resolveTime, bool failed) {
+    m_cachePerfStats->incInt(m_dnsResolvesId, 1);
+    if (failed) {
+      m_cachePerfStats->incInt(m_dnsResolveFailuresId, 1);
+    }
+    m_cachePerfStats->incLong(m_dnsResolveTimeId, resolveTime);
+  }
+
+  inline int32_t getDnsCacheHits() {
+    return m_cachePerfStats->getInt(m_dnsCacheHitsId);
+  }
+
+  inline int32_t getDnsCacheMisses() {
+    return m_cachePerfStats->getInt(m_dnsCacheMissesId);
+  }
+
+  inline void incHeapLruEvictions(int32_t evicted, int64_t evictionTime) {
+    m_cachePerfStats->incInt(m_heapLruEvictionsId, evicted);
+    m_cachePerfStats->incLong(m_heapLruEvictionTimeId, evictionTime);
+  }
+
+  inline void incHeapLruAssists(int32_t evicted, int64_t assistTime) {
+    m_cachePerfStats->incInt(m_heapLruAssistsId, 1);
+    m_cachePerfStats->incInt(m_heapLruEvictionsId, evicted);
+    m_cachePerfStats->incLong(m_heapLruAssistTimeId, assistTime);
+  }
+
+  inline void incPdxTypeCacheHits(int32_t hits) {
+    m_cachePerfStats->incInt(m_pdxTypeCacheHitsId, hits);
+  }
+
+  inline void incPdxTypeCacheMisses() {
+    m_cachePerfStats->incInt(m_pdxTypeCacheMissesId, 1);
+  }
+
+  inline int32_t getPdxTypeCacheHits() {
+    return m_cachePerfStats->getInt(m_pdxTypeCacheHitsId);
+  }
+
+  inline int32_t getPdxTypeCacheMisses() {
+    return m_cachePerfStats->getInt(m_pdxTypeCacheMissesId);
+  }
+
  private:
   Statistics* m_cachePerfStats;
 
@@ -350,6 +495,19 @@ class CachePerfStats {
   int32_t m_pdxSerializedBytesId;
   int32_t m_pdxDeserializationsId;
   int32_t m_pdxDeserializedBytesId;
+  int32_t m_threadPoolTasksId;
+  int32_t m_threadPoolQueueTimeId;
+  int32_t m_dnsCacheHitsId;
+  int32_t m_dnsCacheMissesId;
+  int32_t m_dnsResolvesId;
+  int32_t m_dnsResolveFailuresId;
+  int32_t m_dnsResolveTimeId;
+  int32_t m_heapLruEvictionsId;
+  int32_t m_heapLruEvictionTimeId;
+  int32_t m_heapLruAssistsId;
+  int32_t m_heapLruAssistTimeId;
+  int32_t m_pdxTypeCacheHitsId;
+  int32_t m_pdxTypeCacheMissesId;
 };
 }  // namespace client
 }  // namespace geode
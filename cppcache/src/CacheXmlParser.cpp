@@ -165,6 +165,8 @@ auto PROPERTY = "property";
 
 auto CONCURRENCY_CHECKS_ENABLED = "concurrency-checks-enabled";
 
+auto LRU_ADMISSION_ENABLED = "lru-admission-enabled";
+
 auto TOMBSTONE_TIMEOUT = "tombstone-timeout";
 
 /** Pool elements and attributes */
@@ -957,6 +959,25 @@ void CacheXmlParser::startRegionAttributes(const xercesc::Attributes &attrs) {
       }
       regionAttributesFactory->setConcurrencyChecksEnabled(flag);
     }
+
+    auto lruAdmissionEnabled =
+        getOptionalAttribute(attrs, LRU_ADMISSION_ENABLED);
+    if (!lruAdmissionEnabled.empty()) {
+      bool flag = false;
+      std::transform(lruAdmissionEnabled.begin(), lruAdmissionEnabled.end(),
+                     lruAdmissionEnabled.begin(), ::tolower);
+      if ("false" == lruAdmissionEnabled) {
+        flag = false;
+      } else if ("true" == lruAdmissionEnabled) {
+        flag = true;
+      } else {
+        throw CacheXmlException("XML: " + lruAdmissionEnabled +
+                                " is not a valid value for the attribute "
+                                "<" +
+                                std::string(LRU_ADMISSION_ENABLED) + ">");
+      }
+      regionAttributesFactory->setLruAdmissionEnabled(flag);
+    }
   }
 
   if (isDistributed && isTCR) {
@@ -18,6 +18,7 @@
 #include <codecvt>
 #include <cstdlib>
 #include <cwchar>
+#include <functional>
 #include <locale>
 
 #include <geode/CacheableString.hpp>
@@ -26,6 +27,7 @@
 #include <geode/ExceptionTypes.hpp>
 
 #include "DataOutputInternal.hpp"
+#include "MemoryAccounting.hpp"
 #include "SerializationRegistry.hpp"
 #include "Utils.hpp"
 #include "util/string.hpp"
@@ -95,6 +97,10 @@ std::shared_ptr<CacheableString> CacheableString::create(
 }
 
 bool CacheableString::operator==(const CacheableKey& other) const {
+  if (this == &other) {
+    return true;
+  }
+
   if (auto otherString = dynamic_cast<const CacheableString*>(&other)) {
     return m_str == otherString->m_str;
   }
@@ -110,17 +116,18 @@ int32_t CacheableString::hashcode() const {
 }
 
 bool CacheableString::isAscii(const std::string& str) {
-  for (auto&& c : str) {
-    if (c & 0x80) {
-      return false;
-    }
-  }
-  return true;
+  return ascii_length(str.data(), str.length()) == str.length();
 }
 
 size_t CacheableString::objectSize() const {
-  auto size = sizeof(CacheableString) +
-              sizeof(std::string::value_type) * m_str.capacity();
+  auto size = sizeof(CacheableString);
+  // short strings are kept inside the std::string object itself
+  auto data = static_cast<const void*>(m_str.data());
+  std::less<const void*> before;
+  if (before(data, &m_str) || !before(data, &m_str + 1)) {
+    size += MemoryAccounting::allocationSize(sizeof(std::string::value_type) *
+                                             (m_str.capacity() + 1));
+  }
   return size;
 }
 
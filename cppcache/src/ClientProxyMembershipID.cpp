@@ -33,7 +33,9 @@ constexpr int32_t kDcPort = 12334;
 constexpr int8_t kVmKind = kVmKindLoner;
 constexpr int32_t kRoleArrayLength = 0;
 
-static int32_t syncCounter = 2;
+constexpr int32_t kInitialSyncCounter = 2;
+
+static int32_t syncCounter = kInitialSyncCounter;
 }  // namespace
 
 namespace apache {
@@ -262,6 +264,10 @@ void ClientProxyMembershipID::readAdditionalData(DataInput& input) {
 
 void ClientProxyMembershipID::increaseSyncCounter() { ++syncCounter; }
 
+void ClientProxyMembershipID::resetSyncCounter() {
+  syncCounter = kInitialSyncCounter;
+}
+
 // Compares two membershipIds. This is based on the compareTo function
 // of InternalDistributedMember class of Java.
 // Any change to the java function should be reflected here as well.
@@ -60,6 +60,12 @@ class ClientProxyMembershipID : public DSMemberForVersionStamp {
 
   static void increaseSyncCounter();
 
+  /**
+   * for internal testing, restores the sync counter of a process that has
+   * created no pool
+   */
+  static void resetSyncCounter();
+
   static std::shared_ptr<Serializable> createDeserializable() {
     return std::make_shared<ClientProxyMembershipID>();
   }
@@ -0,0 +1,195 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_CONFLATINGQUEUE_H_
+#define GEODE_CONFLATINGQUEUE_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * FIFO queue of events that keeps at most one pending conflatable event per
+ * key.
+ *
+ * An event pushed for a key replaces the pending event for that key when
+ * conflates(pending, next) is true, and goes to the back of the queue like
+ * any other event. Otherwise it is queued after the pending one and becomes
+ * the event later ones are compared with, so for example an update is never
+ * conflated across a destroy of its key. Barriers are events for no single
+ * key; nothing queued after a barrier conflates with anything before it.
+ * Without conflates the queue never conflates.
+ *
+ * Pushing an event that does not replace a pending one waits while capacity
+ * events are queued, so a slow reader holds up the writer instead of letting
+ * the queue grow.
+ */
+template <class Key, class Event, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class ConflatingQueue {
+ public:
+  using Conflates =
+      std::function<bool(const Event& pending, const Event& next)>;
+
+  ConflatingQueue(Conflates conflates, size_t capacity)
+      : conflates_(std::move(conflates)),
+        capacity_(std::max<size_t>(capacity, 1)),
+        closed_(false) {}
+
+  ConflatingQueue(const ConflatingQueue&) = delete;
+  ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+
+  /**
+   * Queues event for key, returning true if it replaced a pending event.
+   */
+  bool push(const Key& key, Event event) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    auto conflated = false;
+    auto pending = pending_.find(key);
+    if (pending != pending_.end() && conflates_ &&
+        conflates_(pending->second->event, event)) {
+      events_.erase(pending->second);
+      conflated = true;
+    } else {
+      awaitSpace(lock);
+      // the pending event may have been taken while waiting
+      pending = pending_.find(key);
+    }
+
+    events_.emplace_back(key, std::move(event), true);
+    auto back = std::prev(events_.end());
+    if (pending != pending_.end()) {
+      pending->second = back;
+    } else {
+      pending_.emplace(key, back);
+    }
+
+    condition_.notify_one();
+    return conflated;
+  }
+
+  void pushBarrier(Event event) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    awaitSpace(lock);
+    pending_.clear();
+    events_.emplace_back(Key(), std::move(event), false);
+    condition_.notify_one();
+  }
+
+  /**
+   * Waits for the event at the front of the queue. Returns false once the
+   * queue is closed and empty.
+   */
+  bool pop(Event& event) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    condition_.wait(lock, [this] { return closed_ || !events_.empty(); });
+    if (events_.empty()) {
+      return false;
+    }
+
+    auto front = events_.begin();
+    if (front->keyed) {
+      auto pending = pending_.find(front->key);
+      if (pending != pending_.end() && pending->second == front) {
+        pending_.erase(pending);
+      }
+    }
+    event = std::move(front->event);
+    events_.pop_front();
+    notFull_.notify_all();
+    return true;
+  }
+
+  /**
+   * Waits for events and appends all of the queued ones to events, in order.
+   * Returns false once the queue is closed and empty.
+   */
+  bool popAll(std::vector<Event>& events) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    condition_.wait(lock, [this] { return closed_ || !events_.empty(); });
+    if (events_.empty()) {
+      return false;
+    }
+
+    for (auto& node : events_) {
+      events.push_back(std::move(node.event));
+    }
+    events_.clear();
+    pending_.clear();
+    notFull_.notify_all();
+    return true;
+  }
+
+  /**
+   * Lets pop() and popAll() return false once the queued events are taken.
+   * Pushes no longer wait for space.
+   */
+  void close() {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    closed_ = true;
+    condition_.notify_all();
+    notFull_.notify_all();
+  }
+
+  size_t size() const {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    return events_.size();
+  }
+
+ private:
+  void awaitSpace(std::unique_lock<std::mutex>& lock) {
+    notFull_.wait(lock,
+                  [this] { return closed_ || events_.size() < capacity_; });
+  }
+
+  struct Node {
+    Node(const Key& k, Event&& e, bool isKeyed)
+        : key(k), event(std::move(e)), keyed(isKeyed) {}
+
+    Key key;
+    Event event;
+    // false for barriers
+    bool keyed;
+  };
+
+  Conflates conflates_;
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::condition_variable notFull_;
+  std::list<Node> events_;
+  std::unordered_map<Key, typename std::list<Node>::iterator, Hash, KeyEqual>
+      pending_;
+  bool closed_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CONFLATINGQUEUE_H_
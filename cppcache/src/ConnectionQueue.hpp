@@ -20,7 +20,10 @@
 #ifndef GEODE_SYNCHRONIZEDQUEUE_H_
 #define GEODE_SYNCHRONIZEDQUEUE_H_
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 
@@ -33,7 +36,7 @@ namespace client {
 template <class T, class _Mutex = std::mutex>
 class ConnectionQueue {
  public:
-  ConnectionQueue() : closed_(false) {}
+  ConnectionQueue() : closed_(false), blockedNanos_(0) {}
 
   virtual ~ConnectionQueue() {}
 
@@ -107,9 +110,18 @@ class ConnectionQueue {
     closed_ = false;
   }
 
+  /**
+   * Returns the time callers spent blocked waiting for an object to be put
+   * since the last call. Gets served without waiting add nothing.
+   */
+  std::chrono::nanoseconds takeBlockedTime() {
+    return std::chrono::nanoseconds(blockedNanos_.exchange(0));
+  }
+
  private:
   std::condition_variable_any condition_;
   bool closed_;
+  std::atomic<int64_t> blockedNanos_;
 
   T* popLocked(bool& isClosed) {
     std::lock_guard<_Mutex> _guard(mutex_);
@@ -136,7 +148,8 @@ class ConnectionQueue {
   template <typename U>
   T* getLockedFor(const std::chrono::microseconds& duration, bool& isClosed,
                   U* excludeList = nullptr) {
-    const auto until = std::chrono::steady_clock::now() + duration;
+    const auto start = std::chrono::steady_clock::now();
+    const auto until = start + duration;
     T* mp = nullptr;
 
     std::unique_lock<_Mutex> lock(mutex_);
@@ -155,7 +168,11 @@ class ConnectionQueue {
 
       break;
     }
+    lock.unlock();
 
+    blockedNanos_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
     return mp;
   }
 
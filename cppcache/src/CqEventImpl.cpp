@@ -28,23 +28,41 @@
 namespace apache {
 namespace geode {
 namespace client {
-CqEventImpl::CqEventImpl(std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
-                         CqOperation cqOp, std::shared_ptr<CacheableKey>& key,
-                         std::shared_ptr<Cacheable>& value,
+CqEventImpl::CqEventImpl(const std::shared_ptr<CqQuery>& cQuery,
+                         CqOperation baseOp, CqOperation cqOp,
+                         const std::shared_ptr<CacheableKey>& key,
+                         const std::shared_ptr<Cacheable>& value,
                          ThinClientBaseDM* tcrdm,
-                         std::shared_ptr<CacheableBytes> deltaBytes,
-                         std::shared_ptr<EventId> eventId)
-    : m_error(false) {
+                         const std::shared_ptr<CacheableBytes>& deltaBytes,
+                         const std::shared_ptr<EventId>& eventId) {
+  reset(cQuery, baseOp, cqOp, key, value, tcrdm, deltaBytes, eventId);
+}
+
+void CqEventImpl::reset(const std::shared_ptr<CqQuery>& cQuery,
+                        CqOperation baseOp, CqOperation cqOp,
+                        const std::shared_ptr<CacheableKey>& key,
+                        const std::shared_ptr<Cacheable>& value,
+                        ThinClientBaseDM* tcrdm,
+                        const std::shared_ptr<CacheableBytes>& deltaBytes,
+                        const std::shared_ptr<EventId>& eventId) {
   m_cQuery = cQuery;
   m_queryOp = cqOp;
   m_baseOp = baseOp;
   m_key = key;
   m_newValue = value;
-  if (m_queryOp == CqOperation::OP_TYPE_INVALID) m_error = true;
+  m_error = (m_queryOp == CqOperation::OP_TYPE_INVALID);
   m_tcrdm = tcrdm;
   m_deltaValue = deltaBytes;
   m_eventId = eventId;
 }
+
+void CqEventImpl::clear() {
+  m_cQuery = nullptr;
+  m_key = nullptr;
+  m_newValue = nullptr;
+  m_deltaValue = nullptr;
+  m_eventId = nullptr;
+}
 std::shared_ptr<CqQuery> CqEventImpl::getCq() const { return m_cQuery; }
 
 CqOperation CqEventImpl::getBaseOperation() const { return m_baseOp; }
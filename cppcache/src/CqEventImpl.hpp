@@ -46,13 +46,28 @@ class EventId;
 class CqEventImpl : public CqEvent {
  public:
   CqEventImpl() = delete;
-  CqEventImpl(std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
-              CqOperation cqOp, std::shared_ptr<CacheableKey>& key,
-              std::shared_ptr<Cacheable>& value, ThinClientBaseDM* tcrdm,
-              std::shared_ptr<CacheableBytes> deltaBytes,
-              std::shared_ptr<EventId> eventId);
+  CqEventImpl(const std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
+              CqOperation cqOp, const std::shared_ptr<CacheableKey>& key,
+              const std::shared_ptr<Cacheable>& value, ThinClientBaseDM* tcrdm,
+              const std::shared_ptr<CacheableBytes>& deltaBytes,
+              const std::shared_ptr<EventId>& eventId);
   ~CqEventImpl() override = default;
 
+  /**
+   * Reinitializes this event, so that one instance can carry successive
+   * events.
+   */
+  void reset(const std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
+             CqOperation cqOp, const std::shared_ptr<CacheableKey>& key,
+             const std::shared_ptr<Cacheable>& value, ThinClientBaseDM* tcrdm,
+             const std::shared_ptr<CacheableBytes>& deltaBytes,
+             const std::shared_ptr<EventId>& eventId);
+
+  /**
+   * Releases the query, key and values this event refers to.
+   */
+  void clear();
+
   std::shared_ptr<CqQuery> getCq() const override;
 
   /**
@@ -19,6 +19,7 @@
 
 #include <sstream>
 
+#include <geode/CqBatchListener.hpp>
 #include <geode/CqServiceStatistics.hpp>
 #include <geode/CqStatusListener.hpp>
 #include <geode/ExceptionTypes.hpp>
@@ -35,6 +36,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+constexpr size_t CqService::kMaxPooledCqEvents;
+
 CqService::CqService(ThinClientBaseDM* tccdm,
                      StatisticsFactory* statisticsFactory)
     : m_tccdm(tccdm),
@@ -383,82 +386,189 @@ bool CqService::isCqExists(const std::string& cqName) {
 
   return m_cqQueryMap.find(cqName) != m_cqQueryMap.end();
 }
-void CqService::receiveNotification(TcrMessage& msg) {
-  invokeCqListeners(msg.getCqs(), msg.getMessageTypeForCq(), msg.getKey(),
-                    msg.getValue(), msg.getDeltaBytes(), msg.getEventId());
+void CqService::receiveNotifications(const std::vector<TcrMessage*>& msgs) {
+  invokeCqListeners(msgs);
   notification_semaphore_.release();
 }
 
+CqService::CqDispatch& CqService::getCqDispatch(
+    std::unordered_map<std::string, CqDispatch>& dispatches,
+    const std::string& cqName) {
+  auto found = dispatches.find(cqName);
+  if (found != dispatches.end()) {
+    return found->second;
+  }
+
+  auto& dispatch = dispatches[cqName];
+  dispatch.query = getCq(cqName);
+  auto cQueryImpl = std::dynamic_pointer_cast<CqQueryImpl>(dispatch.query);
+  if (cQueryImpl && cQueryImpl->isRunning()) {
+    dispatch.impl = cQueryImpl;
+    for (auto& l : cQueryImpl->getCqAttributes()->getCqListeners()) {
+      // Skip listeners that have been reset by the CqAttributeMutator.
+      if (auto batchListener = std::dynamic_pointer_cast<CqBatchListener>(l)) {
+        dispatch.batchListeners.push_back(batchListener);
+      } else if (l) {
+        dispatch.listeners.push_back(l);
+      }
+    }
+  }
+  return dispatch;
+}
+
+void CqService::flushBatchListeners(const std::string& cqName,
+                                    CqDispatch& dispatch) {
+  if (dispatch.pending.empty()) {
+    return;
+  }
+
+  for (auto& l : dispatch.batchListeners) {
+    try {
+      l->onEvents(dispatch.pending);
+    } catch (Exception& ex) {
+      LOGWARN(("Exception in the CqListener of the CQ named " + cqName +
+               ", error: " + ex.what())
+                  .c_str());
+    }
+  }
+  dispatch.pending.clear();
+}
+
 /**
- * Invokes the CqListeners for the given CQs.
- * @param cqs list of cqs with the cq operation from the Server.
- * @param messageType base operation
- * @param key key to notify for
- * @param value associated value
- * @param deltaValue if delta, contains delta bytes
- * @param eventId event to send
+ * Invokes the CqListeners for the CQs of each notification. The CQs and
+ * their listeners are looked up once per batch; plain listeners get each
+ * event as it is processed, batch listeners get the events of a CQ in one
+ * call at the end of the batch, or before an error or close of the CQ.
+ * @param msgs notifications with the cq operations from the Server.
  */
-void CqService::invokeCqListeners(const std::map<std::string, int>* cqs,
-                                  uint32_t messageType,
-                                  std::shared_ptr<CacheableKey> key,
-                                  std::shared_ptr<Cacheable> value,
-                                  std::shared_ptr<CacheableBytes> deltaValue,
-                                  std::shared_ptr<EventId> eventId) {
+void CqService::invokeCqListeners(const std::vector<TcrMessage*>& msgs) {
   LOGDEBUG("CqService::invokeCqListeners");
-  for (const auto& kv : *cqs) {
-    const auto cqName = kv.first;
-    auto cQuery = getCq(cqName);
-    auto cQueryImpl = std::dynamic_pointer_cast<CqQueryImpl>(cQuery);
-    if (!(cQueryImpl && cQueryImpl->isRunning())) {
-      LOGFINE("Unable to invoke CqListener, %s, CqName: %s",
-              cQueryImpl ? "CQ not found" : "CQ is Not running",
-              cqName.c_str());
-      continue;
-    }
+  std::unordered_map<std::string, CqDispatch> dispatches;
+  size_t eventsUsed = 0;
+
+  for (auto msg : msgs) {
+    const auto baseOp = getOperation(msg->getMessageTypeForCq());
+    const auto key = msg->getKey();
+    const auto value = msg->getValue();
+    const auto deltaValue = msg->getDeltaBytes();
+    const auto eventId = msg->getEventId();
+    for (const auto& kv : *msg->getCqs()) {
+      const auto& cqName = kv.first;
+      auto& dispatch = getCqDispatch(dispatches, cqName);
+      if (!dispatch.impl) {
+        LOGFINE("Unable to invoke CqListener, %s, CqName: %s",
+                dispatch.query ? "CQ is Not running" : "CQ not found",
+                cqName.c_str());
+        continue;
+      }
 
-    const auto cqOp = kv.second;
+      const auto cqOp = kv.second;
+
+      // If Region destroy event, close the cq.
+      if (cqOp == TcrMessage::DESTROY_REGION) {
+        flushBatchListeners(cqName, dispatch);
+        // The close will also invoke the listeners close().
+        try {
+          dispatch.impl->close(false);
+        } catch (Exception& ex) {
+          // handle?
+          LOGFINE("Exception while invoking CQ listeners: %s", ex.what());
+        }
+        dispatch.impl = nullptr;
+        continue;
+      }
 
-    // If Region destroy event, close the cq.
-    if (cqOp == TcrMessage::DESTROY_REGION) {
-      // The close will also invoke the listeners close().
-      try {
-        cQueryImpl->close(false);
-      } catch (Exception& ex) {
-        // handle?
-        LOGFINE("Exception while invoking CQ listeners: %s", ex.what());
+      // Construct CqEvent, reusing one from an earlier batch if possible.
+      if (eventsUsed == m_eventPool.size()) {
+        m_eventPool.emplace_back(new CqEventImpl(
+            dispatch.query, baseOp, getOperation(cqOp), key, value, m_tccdm,
+            deltaValue, eventId));
+      } else {
+        m_eventPool[eventsUsed]->reset(dispatch.query, baseOp,
+                                       getOperation(cqOp), key, value,
+                                       m_tccdm, deltaValue, eventId);
       }
-      continue;
-    }
+      auto& cqEvent = *m_eventPool[eventsUsed++];
 
-    // Construct CqEvent.
-    auto cqEvent =
-        new CqEventImpl(cQuery, getOperation(messageType), getOperation(cqOp),
-                        key, value, m_tccdm, deltaValue, eventId);
+      // Update statistics
+      dispatch.impl->updateStats(cqEvent);
 
-    // Update statistics
-    cQueryImpl->updateStats(*cqEvent);
+      const auto error = cqEvent.getError();
+      if (error) {
+        // Keep errors in order with the events received before them.
+        flushBatchListeners(cqName, dispatch);
+      } else {
+        dispatch.pending.push_back(cqEvent);
+      }
 
-    // invoke CQ Listeners.
-    for (auto l : cQueryImpl->getCqAttributes()->getCqListeners()) {
-      try {
-        // Check if the listener is not null, it could have been changed/reset
-        // by the CqAttributeMutator.
-        if (l) {
-          if (cqEvent->getError() == true) {
-            l->onError(*cqEvent);
+      // invoke CQ Listeners.
+      for (auto& l : dispatch.listeners) {
+        try {
+          if (error) {
+            l->onError(cqEvent);
           } else {
-            l->onEvent(*cqEvent);
+            l->onEvent(cqEvent);
           }
+          // Handle client side exceptions.
+        } catch (Exception& ex) {
+          LOGWARN(("Exception in the CqListener of the CQ named " + cqName +
+                   ", error: " + ex.what())
+                      .c_str());
         }
-        // Handle client side exceptions.
-      } catch (Exception& ex) {
-        LOGWARN(("Exception in the CqListener of the CQ named " + cqName +
-                 ", error: " + ex.what())
-                    .c_str());
+      }
+      if (error) {
+        for (auto& l : dispatch.batchListeners) {
+          try {
+            l->onError(cqEvent);
+          } catch (Exception& ex) {
+            LOGWARN(("Exception in the CqListener of the CQ named " + cqName +
+                     ", error: " + ex.what())
+                        .c_str());
+          }
+        }
+      }
+    }
+  }
+
+  for (auto& kv : dispatches) {
+    flushBatchListeners(kv.first, kv.second);
+  }
+
+  for (size_t i = 0; i < eventsUsed; ++i) {
+    m_eventPool[i]->clear();
+  }
+  if (m_eventPool.size() > kMaxPooledCqEvents) {
+    m_eventPool.resize(kMaxPooledCqEvents);
+  }
+}
+
+bool CqService::hasBatchListener(const TcrMessage& msg) {
+  auto cqs = msg.getCqs();
+  if (cqs == nullptr) {
+    return false;
+  }
+
+  auto&& lock = m_cqQueryMap.make_lock();
+  for (const auto& kv : *cqs) {
+    const auto& found = m_cqQueryMap.find(kv.first);
+    if (found == m_cqQueryMap.end()) {
+      continue;
+    }
+    auto cQueryImpl = std::dynamic_pointer_cast<CqQueryImpl>(found->second);
+    if (cQueryImpl == nullptr) {
+      continue;
+    }
+    for (auto& l : cQueryImpl->getCqAttributes()->getCqListeners()) {
+      if (std::dynamic_pointer_cast<CqBatchListener>(l)) {
+        return true;
       }
     }
-    delete cqEvent;
   }
+  return false;
+}
+
+size_t CqService::getPooledCqEventCount() const {
+  return m_eventPool.size();
 }
 
 void CqService::invokeCqConnectedListeners(const std::string& poolName,
@@ -20,11 +20,17 @@
 #ifndef GEODE_CQSERVICE_H_
 #define GEODE_CQSERVICE_H_
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <geode/CacheableKey.hpp>
+#include <geode/CqEvent.hpp>
+#include <geode/CqListener.hpp>
 #include <geode/CqOperation.hpp>
 #include <geode/CqQuery.hpp>
 #include <geode/internal/geode_globals.hpp>
@@ -43,6 +49,9 @@ namespace client {
 
 class ThinClientBaseDM;
 class TcrEndpoint;
+class CqBatchListener;
+class CqEventImpl;
+class CqQueryImpl;
 
 /**
  * @class CqService CqService.hpp
@@ -62,11 +71,37 @@ class CqService : public std::enable_shared_from_this<CqService> {
 
   std::shared_ptr<CqServiceStatistics> m_stats;
 
+  // CqEvents reused across notification batches, guarded by
+  // notification_semaphore_
+  std::vector<std::unique_ptr<CqEventImpl>> m_eventPool;
+
+  /**
+   * A CQ and its listeners, resolved once per batch of notifications.
+   */
+  struct CqDispatch {
+    std::shared_ptr<CqQuery> query;
+    // nullptr when the CQ is not running
+    std::shared_ptr<CqQueryImpl> impl;
+    std::vector<std::shared_ptr<CqListener>> listeners;
+    std::vector<std::shared_ptr<CqBatchListener>> batchListeners;
+    // events for the batch listeners
+    std::vector<std::reference_wrapper<const CqEvent>> pending;
+  };
+
   inline bool noCq() const { return m_cqQueryMap.empty(); }
 
+  CqDispatch& getCqDispatch(
+      std::unordered_map<std::string, CqDispatch>& dispatches,
+      const std::string& cqName);
+
+  void flushBatchListeners(const std::string& cqName, CqDispatch& dispatch);
+
  public:
   typedef std::vector<std::shared_ptr<CqQuery>> query_container_type;
 
+  // upper bound on the CqEvents kept for reuse between batches
+  static constexpr size_t kMaxPooledCqEvents = 1024;
+
   CqService(const CqService&) = delete;
   CqService& operator=(const CqService&) = delete;
   CqService(ThinClientBaseDM* tccdm,
@@ -75,7 +110,11 @@ class CqService : public std::enable_shared_from_this<CqService> {
 
   ThinClientBaseDM* getDM() { return m_tccdm; }
 
-  void receiveNotification(TcrMessage& msg);
+  /**
+   * Invokes the CqListeners for notifications received together, and
+   * releases the lock taken by checkAndAcquireLock().
+   */
+  void receiveNotifications(const std::vector<TcrMessage*>& msgs);
 
   /**
    * Returns the state of the cqService.
@@ -208,20 +247,21 @@ class CqService : public std::enable_shared_from_this<CqService> {
   bool isCqExists(const std::string& cqName);
 
   /**
-   * Invokes the CqListeners for the given CQs.
-   * @param cqs list of cqs with the cq operation from the Server.
-   * @param messageType base operation
-   * @param key to invoke listeners with
-   * @param value to invoke listeners with
-   * @param deltaValue to invoke listeners with
-   * @param eventId to invoke listeners with
-   */
-  void invokeCqListeners(const std::map<std::string, int>* cqs,
-                         uint32_t messageType,
-                         std::shared_ptr<CacheableKey> key,
-                         std::shared_ptr<Cacheable> value,
-                         std::shared_ptr<CacheableBytes> deltaValue,
-                         std::shared_ptr<EventId> eventId);
+   * Invokes the CqListeners for the CQs of each notification.
+   * @param msgs notifications with the cq operations from the Server.
+   */
+  void invokeCqListeners(const std::vector<TcrMessage*>& msgs);
+
+  /**
+   * Returns true if a CQ of msg has a CqBatchListener.
+   */
+  bool hasBatchListener(const TcrMessage& msg);
+
+  /**
+   * for internal testing, returns the number of CqEvents kept for reuse
+   */
+  size_t getPooledCqEventCount() const;
+
   /**
    * Returns the Operation for the given EnumListenerEvent type.
    * @param eventType to find the operation
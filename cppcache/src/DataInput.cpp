@@ -49,10 +49,17 @@ Cache* DataInput::getCache() const { return cache_->getCache(); }
 template <class _Traits, class _Allocator>
 void DataInput::readJavaModifiedUtf8(
     std::basic_string<char, _Traits, _Allocator>& value) {
-  // TODO string OPTIMIZE skip intermediate utf16 string
-  std::u16string utf16;
-  readJavaModifiedUtf8(utf16);
-  value = to_utf8(utf16);
+  uint16_t length = readInt16();
+  _GEODE_CHECK_BUFFER_SIZE(length);
+  auto data = reinterpret_cast<const char*>(buffer_);
+  if (ascii_length(data, length) == length) {
+    // ASCII encodes to itself in Java Modified UTF-8.
+    value.assign(data, length);
+  } else {
+    // TODO string OPTIMIZE skip intermediate utf16 string
+    value = to_utf8(internal::JavaModifiedUtf8::decode(data, length));
+  }
+  advanceCursor(length);
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataInput::readJavaModifiedUtf8(std::string&);
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <cstring>
+#include <limits>
 #include <vector>
 
 #include <geode/DataOutput.hpp>
@@ -142,6 +144,13 @@ void DataOutput::writeJavaModifiedUtf8(
    */
   if (value.empty()) {
     writeInt(static_cast<uint16_t>(0));
+  } else if (value.length() <= (std::numeric_limits<uint16_t>::max)() &&
+             ascii_length(value.data(), value.length()) == value.length() &&
+             std::memchr(value.data(), 0, value.length()) == nullptr) {
+    // ASCII without NUL encodes to itself in Java Modified UTF-8.
+    writeInt(static_cast<uint16_t>(value.length()));
+    writeBytesOnly(reinterpret_cast<const uint8_t*>(value.data()),
+                   value.length());
   } else {
     writeJavaModifiedUtf8(to_utf16(value));
   }
@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeserializationArena.hpp"
+
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+constexpr size_t DeserializationArena::DEFAULT_BLOCK_SIZE;
+
+thread_local const DataInput* DeserializationArena::currentInput_ = nullptr;
+thread_local DeserializationArena* DeserializationArena::currentArena_ =
+    nullptr;
+
+DeserializationArena::DeserializationArena(size_t blockSize)
+    : blockSize_(blockSize),
+      capacity_(0),
+      next_(nullptr),
+      available_(0),
+      finalizers_(nullptr) {}
+
+DeserializationArena::~DeserializationArena() noexcept {
+  for (auto finalizer = finalizers_; finalizer; finalizer = finalizer->next) {
+    finalizer->destroy(finalizer->object);
+  }
+}
+
+size_t DeserializationArena::capacity() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return capacity_;
+}
+
+DeserializationArena* DeserializationArena::current(const DataInput& input) {
+  return currentInput_ == &input ? currentArena_ : nullptr;
+}
+
+DeserializationArena::Scope::Scope(const DataInput& input,
+                                   DeserializationArena* arena)
+    : previousInput_(currentInput_), previousArena_(currentArena_) {
+  if (arena) {
+    currentInput_ = &input;
+    currentArena_ = arena;
+  }
+}
+
+DeserializationArena::Scope::~Scope() noexcept {
+  currentInput_ = previousInput_;
+  currentArena_ = previousArena_;
+}
+
+void* DeserializationArena::allocate(size_t size, size_t alignment) {
+  auto padding =
+      (alignment - reinterpret_cast<uintptr_t>(next_) % alignment) % alignment;
+
+  if (padding + size > available_) {
+    // Objects too large to share a block get one of their own, leaving the
+    // current block to be filled by the objects after them.
+    auto blockSize = size + alignment > blockSize_ / 4
+                         ? size + alignment
+                         : blockSize_;
+    std::unique_ptr<char[]> block(new char[blockSize]);
+    auto start = block.get();
+    blocks_.push_back(std::move(block));
+    capacity_ += blockSize;
+
+    padding = (alignment - reinterpret_cast<uintptr_t>(start) % alignment) %
+              alignment;
+    if (blockSize != blockSize_) {
+      return start + padding;
+    }
+
+    next_ = start;
+    available_ = blockSize;
+  }
+
+  auto result = next_ + padding;
+  next_ += padding + size;
+  available_ -= padding + size;
+  return result;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
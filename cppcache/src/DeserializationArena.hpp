@@ -0,0 +1,124 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DESERIALIZATIONARENA_H_
+#define GEODE_DESERIALIZATIONARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class DataInput;
+
+/**
+ * Monotonic arena that objects decoded from one bulk response are allocated
+ * in, instead of each getting its own heap block and control block.
+ *
+ * Objects are handed out as aliasing shared_ptrs that share ownership of the
+ * arena, so memory is released, and destructors run, only once every object
+ * from the arena is gone, so a single object kept by the application keeps
+ * the memory of the whole response alive. Only objects that hold no
+ * shared_ptr themselves may be placed in an arena, otherwise the arena would
+ * keep itself alive.
+ */
+class DeserializationArena
+    : public std::enable_shared_from_this<DeserializationArena> {
+ public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+  explicit DeserializationArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+  ~DeserializationArena() noexcept;
+
+  DeserializationArena(const DeserializationArena&) = delete;
+  DeserializationArena& operator=(const DeserializationArena&) = delete;
+
+  template <class T, class... Args>
+  std::shared_ptr<T> make(Args&&... args) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto memory = allocate(sizeof(Finalizer), alignof(Finalizer));
+    auto object = new (allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+    finalizers_ = new (memory) Finalizer{finalizers_, &destroy<T>, object};
+    return std::shared_ptr<T>(shared_from_this(), object);
+  }
+
+  /** Bytes taken from the heap for this arena. */
+  size_t capacity() const;
+
+  /**
+   * Returns the arena objects read from input on this thread are allocated
+   * in, or nullptr if they get their own heap block.
+   */
+  static DeserializationArena* current(const DataInput& input);
+
+  /**
+   * While alive, built-in objects read from input on this thread are
+   * allocated in arena, unless it is nullptr.
+   */
+  class Scope {
+   public:
+    Scope(const DataInput& input, DeserializationArena* arena);
+    ~Scope() noexcept;
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    const DataInput* previousInput_;
+    DeserializationArena* previousArena_;
+  };
+
+ private:
+  struct Finalizer {
+    Finalizer* next;
+    void (*destroy)(void*);
+    void* object;
+  };
+
+  template <class T>
+  static void destroy(void* object) {
+    static_cast<T*>(object)->~T();
+  }
+
+  void* allocate(size_t size, size_t alignment);
+
+  const size_t blockSize_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  size_t capacity_;
+  char* next_;
+  size_t available_;
+  Finalizer* finalizers_;
+
+  static thread_local const DataInput* currentInput_;
+  static thread_local DeserializationArena* currentArena_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DESERIALIZATIONARENA_H_
@@ -0,0 +1,253 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DnsResolver.hpp"
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/system/system_error.hpp>
+
+#include "CachePerfStats.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+DnsResolver::DnsResolver(std::chrono::milliseconds ttl,
+                         std::chrono::milliseconds negativeTtl)
+    : DnsResolver(ttl, negativeTtl, &DnsResolver::systemLookup) {}
+
+DnsResolver::DnsResolver(std::chrono::milliseconds ttl,
+                         std::chrono::milliseconds negativeTtl, Lookup lookup)
+    : ttl_(ttl),
+      negativeTtl_(negativeTtl),
+      lookup_(std::move(lookup)),
+      shutdown_(false),
+      stats_(nullptr) {}
+
+DnsResolver::~DnsResolver() noexcept { shutDown(); }
+
+DnsResolver::Endpoints DnsResolver::resolve(const std::string& host,
+                                            uint16_t port) {
+  boost::system::error_code error;
+
+  if (ttl_ <= std::chrono::milliseconds::zero()) {
+    auto endpoints = lookup(host, port, error);
+    if (error) {
+      throw boost::system::system_error{error};
+    }
+    return endpoints;
+  }
+
+  auto key = host + ':' + std::to_string(port);
+  std::unique_lock<decltype(mutex_)> lock(mutex_);
+  for (;;) {
+    auto& entry = entries_[key];
+    auto now = clock::now();
+    entry.lastUsed = now;
+
+    // Fresh entries are served as they are. Expired addresses are still
+    // served while the refresher fetches new ones.
+    if (entry.valid &&
+        (now < entry.expires || (!entry.error && !shutdown_))) {
+      if (now >= entry.refreshAt && !entry.resolving) {
+        queueRefresh(key, entry);
+      }
+      if (auto stats = stats_.load()) {
+        stats->incDnsCacheHits();
+      }
+      if (entry.error) {
+        throw boost::system::system_error{entry.error};
+      }
+      return entry.endpoints;
+    }
+
+    if (!entry.resolving) {
+      entry.host = host;
+      entry.port = port;
+      entry.resolving = true;
+      break;
+    }
+
+    resolved_.wait(lock);
+  }
+
+  if (auto stats = stats_.load()) {
+    stats->incDnsCacheMisses();
+  }
+
+  lock.unlock();
+  auto endpoints = lookup(host, port, error);
+  lock.lock();
+
+  store(key, endpoints, error);
+  if (error) {
+    throw boost::system::system_error{error};
+  }
+  return endpoints;
+}
+
+void DnsResolver::shutDown() {
+  {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    if (shutdown_) {
+      return;
+    }
+    shutdown_ = true;
+  }
+
+  refreshCondition_.notify_all();
+  if (refresher_.joinable()) {
+    refresher_.join();
+  }
+}
+
+void DnsResolver::setCachePerfStats(CachePerfStats* stats) { stats_ = stats; }
+
+DnsResolver::Endpoints DnsResolver::systemLookup(const std::string& host,
+                                                 uint16_t port) {
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::resolver resolver(io_context);
+  auto results = resolver.resolve(host, std::to_string(port));
+
+  Endpoints endpoints;
+  endpoints.reserve(results.size());
+  for (const auto& result : results) {
+    endpoints.push_back(result.endpoint());
+  }
+  return endpoints;
+}
+
+DnsResolver::Endpoints DnsResolver::lookup(const std::string& host,
+                                           uint16_t port,
+                                           boost::system::error_code& error) {
+  Endpoints endpoints;
+  auto start = clock::now();
+  try {
+    endpoints = lookup_(host, port);
+    if (endpoints.empty()) {
+      error = boost::asio::error::host_not_found;
+    }
+  } catch (const boost::system::system_error& e) {
+    error = e.code();
+  }
+
+  if (auto stats = stats_.load()) {
+    stats->incDnsResolves(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                             start)
+            .count(),
+        static_cast<bool>(error));
+  }
+
+  if (error) {
+    LOGDEBUG("Resolving %s:%d failed: %s", host.c_str(), port,
+             error.message().c_str());
+  }
+  return endpoints;
+}
+
+void DnsResolver::store(const std::string& key, Endpoints endpoints,
+                        boost::system::error_code error) {
+  auto& entry = entries_[key];
+  auto now = clock::now();
+
+  if (error && entry.valid && !entry.error) {
+    // Keep the addresses we have through a failed refresh; retry later.
+    entry.refreshAt = now + negativeTtl_;
+  } else if (error) {
+    entry.endpoints.clear();
+    entry.error = error;
+    entry.expires = entry.refreshAt = now + negativeTtl_;
+  } else {
+    entry.endpoints = std::move(endpoints);
+    entry.error.clear();
+    entry.expires = now + ttl_;
+    entry.refreshAt = now + ttl_ * 3 / 4;
+  }
+
+  entry.valid = true;
+  entry.resolving = false;
+  resolved_.notify_all();
+}
+
+void DnsResolver::queueRefresh(const std::string& key, Entry& entry) {
+  if (shutdown_) {
+    return;
+  }
+
+  entry.resolving = true;
+  refreshQueue_.push_back(key);
+  if (!refresher_.joinable()) {
+    refresher_ = std::thread([this] { refresh(); });
+  }
+  refreshCondition_.notify_one();
+}
+
+void DnsResolver::refresh() {
+  Log::setThreadName("NC DNS Thread");
+
+  std::unique_lock<decltype(mutex_)> lock(mutex_);
+  while (!shutdown_) {
+    if (refreshQueue_.empty()) {
+      refreshCondition_.wait_for(lock, ttl_);
+      sweep(clock::now());
+      continue;
+    }
+
+    auto key = std::move(refreshQueue_.front());
+    refreshQueue_.pop_front();
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+      continue;
+    }
+
+    auto host = found->second.host;
+    auto port = found->second.port;
+    lock.unlock();
+
+    boost::system::error_code error;
+    auto endpoints = lookup(host, port, error);
+
+    lock.lock();
+    store(key, std::move(endpoints), error);
+  }
+
+  for (const auto& key : refreshQueue_) {
+    auto found = entries_.find(key);
+    if (found != entries_.end()) {
+      found->second.resolving = false;
+    }
+  }
+  refreshQueue_.clear();
+  resolved_.notify_all();
+}
+
+void DnsResolver::sweep(clock::time_point now) {
+  for (auto entry = entries_.begin(); entry != entries_.end();) {
+    if (!entry->second.resolving && now - entry->second.lastUsed > ttl_ * 2) {
+      entry = entries_.erase(entry);
+    } else {
+      ++entry;
+    }
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
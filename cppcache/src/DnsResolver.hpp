@@ -0,0 +1,128 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DNSRESOLVER_H_
+#define GEODE_DNSRESOLVER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/ip/tcp.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CachePerfStats;
+
+/**
+ * Cache-wide host name resolver for client connections.
+ *
+ * Addresses are cached for the configured TTL and failures for the negative
+ * TTL; the system resolver does not report record TTLs. Concurrent lookups
+ * of the same host and port share one query. An entry nearing the end of its
+ * TTL, or past it, is refreshed by a background thread while callers keep
+ * using the addresses they have, so a caller only waits for DNS on the first
+ * lookup of a host or after a failure has expired. A TTL of zero disables
+ * caching.
+ */
+class DnsResolver {
+ public:
+  using clock = std::chrono::steady_clock;
+  using Endpoints = std::vector<boost::asio::ip::tcp::endpoint>;
+
+  /**
+   * Resolves host and port, throwing boost::system::system_error on failure.
+   */
+  using Lookup =
+      std::function<Endpoints(const std::string& host, uint16_t port)>;
+
+  DnsResolver(std::chrono::milliseconds ttl,
+              std::chrono::milliseconds negativeTtl);
+
+  DnsResolver(std::chrono::milliseconds ttl,
+              std::chrono::milliseconds negativeTtl, Lookup lookup);
+
+  ~DnsResolver() noexcept;
+
+  DnsResolver(const DnsResolver&) = delete;
+  DnsResolver& operator=(const DnsResolver&) = delete;
+
+  /**
+   * Returns the addresses of host. Throws boost::system::system_error if it
+   * cannot be resolved.
+   */
+  Endpoints resolve(const std::string& host, uint16_t port);
+
+  /**
+   * Stops background refreshes. Later lookups resolve in the caller.
+   */
+  void shutDown();
+
+  void setCachePerfStats(CachePerfStats* stats);
+
+  static Endpoints systemLookup(const std::string& host, uint16_t port);
+
+ private:
+  struct Entry {
+    std::string host;
+    uint16_t port = 0;
+    Endpoints endpoints;
+    boost::system::error_code error;
+    clock::time_point refreshAt;
+    clock::time_point expires;
+    clock::time_point lastUsed;
+    bool valid = false;
+    bool resolving = false;
+  };
+
+  Endpoints lookup(const std::string& host, uint16_t port,
+                   boost::system::error_code& error);
+  void store(const std::string& key, Endpoints endpoints,
+             boost::system::error_code error);
+  void queueRefresh(const std::string& key, Entry& entry);
+  void refresh();
+  void sweep(clock::time_point now);
+
+  const std::chrono::milliseconds ttl_;
+  const std::chrono::milliseconds negativeTtl_;
+  const Lookup lookup_;
+  std::mutex mutex_;
+  std::condition_variable resolved_;
+  std::condition_variable refreshCondition_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::deque<std::string> refreshQueue_;
+  bool shutdown_;
+  std::thread refresher_;
+  std::atomic<CachePerfStats*> stats_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DNSRESOLVER_H_
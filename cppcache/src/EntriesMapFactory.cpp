@@ -45,6 +45,7 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
   const auto& ttl = attrs.getEntryTimeToLive();
   const auto& idle = attrs.getEntryIdleTimeout();
   bool concurrencyChecksEnabled = attrs.getConcurrencyChecksEnabled();
+  bool lruAdmissionEnabled = attrs.getLruAdmissionEnabled();
   bool heapLRUEnabled = false;
 
   auto cache = region->getCacheImpl();
@@ -70,14 +71,14 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
           std::unique_ptr<LRUExpEntryFactory>(
               new LRUExpEntryFactory(concurrencyChecksEnabled)),
           region, lruEvictionAction, lruLimit, concurrencyChecksEnabled,
-          concurrency, heapLRUEnabled);
+          concurrency, heapLRUEnabled, lruAdmissionEnabled);
     } else {
       result = new LRUEntriesMap(
           &expiryTaskmanager,
           std::unique_ptr<LRUEntryFactory>(
               new LRUEntryFactory(concurrencyChecksEnabled)),
           region, lruEvictionAction, lruLimit, concurrencyChecksEnabled,
-          concurrency, heapLRUEnabled);
+          concurrency, heapLRUEnabled, lruAdmissionEnabled);
     }
   } else if (ttl > std::chrono::seconds::zero() ||
              idle > std::chrono::seconds::zero()) {
@@ -17,6 +17,7 @@
 
 #include "EvictionController.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 #include <boost/thread/lock_types.hpp>
@@ -24,11 +25,33 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "DistributedSystem.hpp"
+#include "MemoryAccounting.hpp"
 #include "RegionInternal.hpp"
+#include "ThreadPool.hpp"
 #include "util/Log.hpp"
 
 namespace {
 const std::chrono::seconds EVICTION_TIMEOUT{1};
+// largest fraction of the entries evicted in one pass
+const float MAX_EVICTION_SLICE = 0.05f;
+
+class RegionEvictionWork
+    : public apache::geode::client::PooledWork<int32_t> {
+ public:
+  RegionEvictionWork(
+      std::shared_ptr<apache::geode::client::RegionInternal> region,
+      float percentage)
+      : region_(std::move(region)), percentage_(percentage) {}
+
+  ~RegionEvictionWork() noexcept override = default;
+
+ protected:
+  int32_t execute() override { return region_->evict(percentage_); }
+
+ private:
+  std::shared_ptr<apache::geode::client::RegionInternal> region_;
+  float percentage_;
+};
 }  // namespace
 
 namespace apache {
@@ -42,11 +65,15 @@ EvictionController::EvictionController(int64_t max_heap_size,
       running_{false},
       max_heap_size_{max_heap_size << 20ULL},
       heap_size_delta_{heap_size_delta / 100.0f},
-      heap_size_{0} {
+      heap_size_{0},
+      calibrator_{max_heap_size_, 0},
+      calibration_{1.0} {
   LOGINFO("Maximum heap size for Heap LRU set to %ld bytes", max_heap_size_);
 }
 
 void EvictionController::start() {
+  calibrator_ =
+      HeapCalibrator(max_heap_size_, MemoryAccounting::residentSetSize());
   running_ = true;
   thread_ = std::thread(&EvictionController::svc, this);
 
@@ -69,10 +96,12 @@ void EvictionController::svc() {
   while (running_) {
     {
       std::unique_lock<std::mutex> lock(mutex);
-      cv_.wait(lock,
-               [this] { return !running_ || heap_size_ > max_heap_size_; });
+      cv_.wait_for(lock, EVICTION_TIMEOUT, [this] {
+        return !running_ || effectiveHeapSize() > max_heap_size_;
+      });
     }
 
+    calibrate();
     checkHeapSize();
   }
 }
@@ -85,22 +114,67 @@ void EvictionController::incrementHeapSize(int64_t delta) {
   // until the evictions had been completed.
 }
 
-void EvictionController::checkHeapSize() {
+void EvictionController::calibrate() {
   int64_t heap_size = heap_size_;
+  auto rss = MemoryAccounting::residentSetSize();
+  auto calibration = calibrator_.sample(heap_size, rss);
+  if (calibration == calibration_) {
+    return;
+  }
+  calibration_ = calibration;
+
+  LOGFINE(
+      "EvictionController::calibrate: resident set grew by %lld bytes for "
+      "%lld accounted bytes, heap size is now scaled by %.03f",
+      rss - calibrator_.baselineRss(), heap_size, calibration);
+}
+
+int64_t EvictionController::effectiveHeapSize() const {
+  return static_cast<int64_t>(static_cast<double>(heap_size_) * calibration_);
+}
+
+bool EvictionController::overLimit() const {
+  return effectiveHeapSize() > max_heap_size_;
+}
+
+void EvictionController::assisted(int32_t evicted,
+                                  std::chrono::nanoseconds elapsed) {
+  cache_->getCachePerfStats().incHeapLruAssists(evicted, elapsed.count());
+}
+
+void EvictionController::checkHeapSize() {
+  int64_t heap_size = effectiveHeapSize();
   if (heap_size <= max_heap_size_) {
     return;
   }
 
-  float percentage =
-      static_cast<float>(heap_size - max_heap_size_) / max_heap_size_ +
-      heap_size_delta_;
+  auto target = static_cast<int64_t>(static_cast<float>(max_heap_size_) *
+                                     (1.0f - heap_size_delta_));
+  auto start = std::chrono::steady_clock::now();
+  int32_t evicted = 0;
 
-  LOGFINE(
-      "EvictionController::process_delta: evicting %.03f%% of the entries. "
-      "Heap size is: %lld / %lld",
-      percentage * 100.0f, heap_size, max_heap_size_);
+  while (running_ && heap_size > target) {
+    float percentage = std::min(static_cast<float>(heap_size - target) /
+                                    static_cast<float>(heap_size),
+                                MAX_EVICTION_SLICE);
 
-  evict(percentage);
+    LOGFINE(
+        "EvictionController::checkHeapSize: evicting %.03f%% of the entries. "
+        "Heap size is: %lld / %lld",
+        percentage * 100.0f, heap_size, max_heap_size_);
+
+    auto count = evict(percentage);
+    if (count == 0) {
+      break;
+    }
+    evicted += count;
+    heap_size = effectiveHeapSize();
+  }
+
+  cache_->getCachePerfStats().incHeapLruEvictions(
+      evicted, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count());
 }
 
 void EvictionController::registerRegion(const std::string& name) {
@@ -119,7 +193,7 @@ void EvictionController::unregisterRegion(const std::string& name) {
   }
 }
 
-void EvictionController::evict(float percentage) {
+int32_t EvictionController::evict(float percentage) {
   // TODO:  Shouldn't we take the CacheImpl::m_regions
   // lock here? Otherwise we might invoke eviction on a region
   // that has been destroyed or is being destroyed.
@@ -136,12 +210,31 @@ void EvictionController::evict(float percentage) {
     regions.insert(regions.end(), regions_.begin(), regions_.end());
   }
 
+  std::vector<std::shared_ptr<RegionEvictionWork>> work;
   for (const auto& regionName : regions) {
-    if (auto region = std::dynamic_pointer_cast<RegionInternal>(
-            cache_->getRegion(regionName))) {
-      region->evict(percentage);
+    auto region = std::dynamic_pointer_cast<RegionInternal>(
+        cache_->getRegion(regionName));
+    if (!region) {
+      continue;
+    }
+
+    // one task per region: a region's entries share one LRU queue, so
+    // splitting its eviction would only contend on that queue's lock
+    auto task = std::make_shared<RegionEvictionWork>(region, percentage);
+    cache_->getThreadPool().perform(task);
+    work.push_back(std::move(task));
+  }
+
+  int32_t evicted = 0;
+  for (auto& task : work) {
+    try {
+      evicted += task->getResult();
+    } catch (const Exception& ex) {
+      LOGERROR("EvictionController::evict: %s: %s", ex.getName().c_str(),
+               ex.what());
     }
   }
+  return evicted;
 }
 
 }  // namespace client
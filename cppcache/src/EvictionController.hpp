@@ -21,6 +21,7 @@
 #define GEODE_EVICTIONCONTROLLER_H_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <set>
@@ -29,6 +30,8 @@
 
 #include <boost/thread/shared_mutex.hpp>
 
+#include "HeapCalibrator.hpp"
+
 namespace apache {
 namespace geode {
 namespace client {
@@ -59,6 +62,17 @@ class CacheImpl;
  *
  * When a region is destroyed, it deregisters itself with the EvictionController
  * Format of object that is put into the region map (int size, int numEntries)
+ *
+ * Eviction is incremental: each pass evicts at most a slice of the entries,
+ * one task per region on the cache's thread pool, and passes repeat until
+ * the heap is heap-lru-delta percent below the limit. While the heap is over
+ * the limit, writers also evict a few entries themselves, see overLimit()
+ * and assisted().
+ *
+ * The sizes reported by the regions are estimates. Once a second the
+ * controller compares them with the growth of the process' resident set size
+ * and scales the heap size by the smoothed ratio, so that eviction follows
+ * the memory the process actually uses, see HeapCalibrator.
  */
 class EvictionController {
  public:
@@ -73,13 +87,22 @@ class EvictionController {
 
   void svc(void);
 
-  void evict(float percentage);
+  int32_t evict(float percentage);
   void incrementHeapSize(int64_t delta);
+
+  /** Returns true if the heap is currently over heap-lru-limit. */
+  bool overLimit() const;
+
+  /** Records eviction done by a writer while the heap was over the limit. */
+  void assisted(int32_t evicted, std::chrono::nanoseconds elapsed);
+
   void registerRegion(const std::string& name);
   void unregisterRegion(const std::string& name);
 
  private:
   void checkHeapSize();
+  void calibrate();
+  int64_t effectiveHeapSize() const;
 
  private:
   CacheImpl* cache_;
@@ -92,6 +115,9 @@ class EvictionController {
   std::atomic<int64_t> heap_size_;
   std::condition_variable cv_;
 
+  HeapCalibrator calibrator_;
+  std::atomic<double> calibration_;
+
   std::set<std::string> regions_;
   boost::shared_mutex regions_mutex_;
 };
@@ -23,17 +23,25 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void ExpEntryFactory::newMapEntry(ExpiryTaskManager* expiryTaskManager,
+void ExpEntryFactory::newMapEntry(SlabPool* pool,
+                                  ExpiryTaskManager* expiryTaskManager,
                                   const std::shared_ptr<CacheableKey>& key,
                                   std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result =
-        MapEntryT<VersionedExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result = MapEntryT<VersionedExpMapEntry, 0, 0>::create(
+        pool, expiryTaskManager, key);
   } else {
-    result = MapEntryT<ExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result =
+        MapEntryT<ExpMapEntry, 0, 0>::create(pool, expiryTaskManager, key);
   }
 }
 
+size_t ExpEntryFactory::mapEntrySize() const {
+  return m_concurrencyChecksEnabled
+             ? sizeof(MapEntryT<VersionedExpMapEntry, 0, 0>)
+             : sizeof(MapEntryT<ExpMapEntry, 0, 0>);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -79,9 +79,11 @@ class ExpEntryFactory : public EntryFactory {
 
   ~ExpEntryFactory() noexcept override {}
 
-  void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  void newMapEntry(SlabPool* pool, ExpiryTaskManager* expiryTaskManager,
                    const std::shared_ptr<CacheableKey>& key,
                    std::shared_ptr<MapEntryImpl>& result) const override;
+
+  size_t mapEntrySize() const override;
 };
 }  // namespace client
 }  // namespace geode
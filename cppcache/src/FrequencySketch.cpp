@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FrequencySketch.hpp"
+
+#include <algorithm>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+const uint64_t SEEDS[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                          0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+
+const uint64_t RESET_MASK = 0x7777777777777777ULL;
+
+}  // namespace
+
+constexpr uint8_t FrequencySketch::MAX_FREQUENCY;
+
+FrequencySketch::FrequencySketch(size_t capacity)
+    : table_(tableSizeFor(capacity)),
+      tableMask_(table_.size() - 1),
+      sampleSize_(10 * std::max<size_t>(capacity, 1)),
+      size_(0),
+      resetting_(false) {
+  for (auto& word : table_) {
+    word.store(0, std::memory_order_relaxed);
+  }
+}
+
+void FrequencySketch::increment(int32_t hash) {
+  auto spreadHash = spread(hash);
+  // the hash selects a group of four counters; each row uses one of them
+  auto start = static_cast<int>((spreadHash & 3) << 2);
+
+  bool added = false;
+  for (int row = 0; row < 4; row++) {
+    added |= incrementAt(indexOf(spreadHash, row), start + row);
+  }
+
+  if (!added ||
+      size_.fetch_add(1, std::memory_order_relaxed) + 1 < sampleSize_) {
+    return;
+  }
+
+  // only one thread ages the table; the others keep counting meanwhile
+  if (!resetting_.exchange(true, std::memory_order_acquire)) {
+    if (size_.load(std::memory_order_relaxed) >= sampleSize_) {
+      reset();
+    }
+    resetting_.store(false, std::memory_order_release);
+  }
+}
+
+uint8_t FrequencySketch::frequency(int32_t hash) const {
+  auto spreadHash = spread(hash);
+  auto start = static_cast<int>((spreadHash & 3) << 2);
+
+  uint8_t frequency = MAX_FREQUENCY;
+  for (int row = 0; row < 4; row++) {
+    auto index = indexOf(spreadHash, row);
+    auto word = table_[index].load(std::memory_order_relaxed);
+    auto count =
+        static_cast<uint8_t>((word >> ((start + row) << 2)) & 0xfULL);
+    frequency = std::min(frequency, count);
+  }
+  return frequency;
+}
+
+size_t FrequencySketch::indexOf(uint32_t hash, int row) const {
+  auto h = (hash + SEEDS[row]) * SEEDS[row];
+  h += h >> 32;
+  return static_cast<size_t>(h) & tableMask_;
+}
+
+bool FrequencySketch::incrementAt(size_t index, int offset) {
+  auto shift = offset << 2;
+  auto mask = 0xfULL << shift;
+  auto& word = table_[index];
+  auto value = word.load(std::memory_order_relaxed);
+  do {
+    if ((value & mask) == mask) {
+      return false;
+    }
+  } while (!word.compare_exchange_weak(value, value + (1ULL << shift),
+                                       std::memory_order_relaxed));
+  return true;
+}
+
+void FrequencySketch::reset() {
+  for (auto& word : table_) {
+    auto value = word.load(std::memory_order_relaxed);
+    while (!word.compare_exchange_weak(value, (value >> 1) & RESET_MASK,
+                                       std::memory_order_relaxed)) {
+    }
+  }
+  size_.fetch_sub(sampleSize_ / 2, std::memory_order_relaxed);
+}
+
+size_t FrequencySketch::tableSizeFor(size_t capacity) {
+  size_t tableSize = 16;
+  while (tableSize < capacity) {
+    tableSize <<= 1;
+  }
+  return tableSize;
+}
+
+uint32_t FrequencySketch::spread(int32_t hash) {
+  auto h = static_cast<uint32_t>(hash);
+  h = ((h >> 16) ^ h) * 0x45d9f3bU;
+  h = ((h >> 16) ^ h) * 0x45d9f3bU;
+  return (h >> 16) ^ h;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_FREQUENCYSKETCH_H_
+#define GEODE_FREQUENCYSKETCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Approximate access frequency of keys, kept in a count-min sketch of 4-bit
+ * counters. Once the number of increments reaches ten times the capacity all
+ * counters are halved, so the sketch forgets keys that stopped being used.
+ * Thread safe without locking: counters are updated with compare-and-swap and
+ * a concurrent increment may miss the halving of a word.
+ */
+class FrequencySketch {
+ public:
+  static constexpr uint8_t MAX_FREQUENCY = 15;
+
+  explicit FrequencySketch(size_t capacity);
+
+  FrequencySketch(const FrequencySketch&) = delete;
+  FrequencySketch& operator=(const FrequencySketch&) = delete;
+
+  /**
+   * Records one access of the key with the given hash code.
+   */
+  void increment(int32_t hash);
+
+  /**
+   * Returns the estimated number of accesses of the key with the given hash
+   * code since it was last aged, at most MAX_FREQUENCY.
+   */
+  uint8_t frequency(int32_t hash) const;
+
+  size_t sampleSize() const { return sampleSize_; }
+
+ private:
+  size_t indexOf(uint32_t hash, int row) const;
+  bool incrementAt(size_t index, int offset);
+  void reset();
+
+  static uint32_t spread(int32_t hash);
+  static size_t tableSizeFor(size_t capacity);
+
+  std::vector<std::atomic<uint64_t>> table_;
+  size_t tableMask_;
+  size_t sampleSize_;
+  std::atomic<size_t> size_;
+  std::atomic<bool> resetting_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FREQUENCYSKETCH_H_
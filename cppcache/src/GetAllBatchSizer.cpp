@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GetAllBatchSizer.hpp"
+
+#include <algorithm>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Weight of the newest sample.
+constexpr double kSampleWeight = 0.2;
+
+// Largest share of a batch's time the round trip should take.
+constexpr double kRoundTripShare = 0.1;
+
+// Every this many getAlls one probes half, the next double the batch size.
+constexpr size_t kProbeInterval = 4;
+
+}  // namespace
+
+GetAllBatchSizer::GetAllBatchSizer(size_t targetBytes, size_t minKeys,
+                                   size_t maxKeys, size_t initialKeys)
+    : targetBytes_(static_cast<double>(targetBytes)),
+      minKeys_(std::max<size_t>(minKeys, 1)),
+      maxKeys_(std::max(maxKeys, minKeys_)),
+      keysPerBatch_(std::min(std::max(initialKeys, minKeys_), maxKeys_)),
+      batches_(0),
+      weight_(0),
+      keys_(0),
+      keysSquared_(0),
+      time_(0),
+      keysTime_(0),
+      bytes_(0) {}
+
+size_t GetAllBatchSizer::keysPerBatch() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return keysPerBatch_;
+}
+
+size_t GetAllBatchSizer::nextBatchSize() {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  auto batch = ++batches_;
+  if (batch % kProbeInterval != 0) {
+    return keysPerBatch_;
+  }
+
+  auto probe = batch % (2 * kProbeInterval) == 0 ? keysPerBatch_ * 2
+                                                 : keysPerBatch_ / 2;
+  return std::min(std::max(probe, minKeys_), maxKeys_);
+}
+
+std::vector<std::shared_ptr<GetAllKeys>> GetAllBatchSizer::split(
+    const std::shared_ptr<GetAllKeys>& keys, size_t batchSize) {
+  batchSize = std::max<size_t>(batchSize, 1);
+  if (keys->size() <= batchSize) {
+    return {keys};
+  }
+
+  std::vector<std::shared_ptr<GetAllKeys>> batches;
+  batches.reserve((keys->size() + batchSize - 1) / batchSize);
+  for (size_t begin = 0; begin < keys->size(); begin += batchSize) {
+    auto end = std::min(keys->size(), begin + batchSize);
+    batches.push_back(std::make_shared<GetAllKeys>(keys->begin() + begin,
+                                                   keys->begin() + end));
+  }
+  return batches;
+}
+
+void GetAllBatchSizer::record(size_t keys, size_t bytes,
+                              std::chrono::nanoseconds elapsed) {
+  if (keys == 0) {
+    return;
+  }
+
+  const auto n = static_cast<double>(keys);
+  const auto t = std::chrono::duration<double>(elapsed).count();
+
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+
+  const auto decay = 1.0 - kSampleWeight;
+  weight_ = weight_ * decay + 1.0;
+  keys_ = keys_ * decay + n;
+  keysSquared_ = keysSquared_ * decay + n * n;
+  time_ = time_ * decay + t;
+  keysTime_ = keysTime_ * decay + n * t;
+  bytes_ = bytes_ * decay + static_cast<double>(bytes);
+
+  const auto meanKeys = keys_ / weight_;
+  const auto meanTime = time_ / weight_;
+  const auto variance = keysSquared_ / weight_ - meanKeys * meanKeys;
+
+  // Without batches of different sizes the round trip cannot be told apart
+  // from the time per key, so only the bytes bound applies.
+  auto timeKeys = static_cast<double>(keysPerBatch_);
+  if (variance > 0.0001 * meanKeys * meanKeys) {
+    const auto covariance = keysTime_ / weight_ - meanKeys * meanTime;
+    const auto perKey = std::max(covariance / variance, 0.0);
+    const auto roundTrip = std::max(meanTime - perKey * meanKeys, 0.0);
+    timeKeys = perKey > 0
+                   ? roundTrip * (1 - kRoundTripShare) /
+                         (kRoundTripShare * perKey)
+                   : static_cast<double>(maxKeys_);
+  }
+
+  auto byteKeys = static_cast<double>(maxKeys_);
+  if (bytes_ > 0) {
+    byteKeys = targetBytes_ * keys_ / bytes_;
+  }
+
+  const auto current = static_cast<double>(keysPerBatch_);
+  auto target = std::min(timeKeys, byteKeys);
+  target = std::min(std::max(target, current / 2), current * 2);
+  target = std::min(std::max(target, static_cast<double>(minKeys_)),
+                    static_cast<double>(maxKeys_));
+  keysPerBatch_ = static_cast<size_t>(target);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_GETALLBATCHSIZER_H_
+#define GEODE_GETALLBATCHSIZER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <geode/CacheableKey.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using GetAllKeys = std::vector<std::shared_ptr<CacheableKey>>;
+
+/**
+ * Decides how many keys a pool puts in each getAll message to one server.
+ *
+ * Every completed batch reports its key count, the bytes of its reply and
+ * its elapsed time. The sizer fits elapsed = roundTrip + keys * perKey over
+ * exponentially weighted samples and picks batches large enough that the
+ * round trip is a small share of each batch, but whose replies stay near
+ * the target bytes. Each sample moves the batch size by at most a factor of
+ * two, and it always stays within the minimum and maximum keys.
+ *
+ * Batches of a single size cannot tell the round trip from the time per key,
+ * so every few getAlls are sent in half or double sized batches instead.
+ */
+class GetAllBatchSizer {
+ public:
+  GetAllBatchSizer(size_t targetBytes, size_t minKeys, size_t maxKeys,
+                   size_t initialKeys);
+
+  size_t keysPerBatch() const;
+
+  /**
+   * Returns the batch size for the next getAll, which is keysPerBatch()
+   * except for the getAlls that probe other sizes.
+   */
+  size_t nextBatchSize();
+
+  void record(size_t keys, size_t bytes, std::chrono::nanoseconds elapsed);
+
+  /**
+   * Splits keys into consecutive batches of at most batchSize keys, in
+   * order. Keys that fit in one batch are returned without a copy.
+   */
+  static std::vector<std::shared_ptr<GetAllKeys>> split(
+      const std::shared_ptr<GetAllKeys>& keys, size_t batchSize);
+
+ private:
+  const double targetBytes_;
+  const size_t minKeys_;
+  const size_t maxKeys_;
+
+  mutable std::mutex mutex_;
+  size_t keysPerBatch_;
+  size_t batches_;
+  double weight_;
+  double keys_;
+  double keysSquared_;
+  double time_;
+  double keysTime_;
+  double bytes_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_GETALLBATCHSIZER_H_
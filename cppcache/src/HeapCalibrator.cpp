@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HeapCalibrator.hpp"
+
+#include <algorithm>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+constexpr double kMinCalibration = 0.5;
+constexpr double kMaxCalibration = 4.0;
+
+}  // namespace
+
+HeapCalibrator::HeapCalibrator(int64_t maxHeapSize, int64_t baselineRss)
+    : maxHeapSize_(maxHeapSize),
+      baselineRss_(baselineRss),
+      peakHeapSize_(0),
+      lastHeapSize_(0),
+      lastRss_(baselineRss),
+      calibration_(1.0) {}
+
+double HeapCalibrator::sample(int64_t heapSize, int64_t rss) {
+  // resident growth while the accounted heap stays put is not the cache's
+  auto heapChange = heapSize - lastHeapSize_;
+  if (lastHeapSize_ > 0 &&
+      std::max(heapChange, -heapChange) <= lastHeapSize_ / 100) {
+    baselineRss_ += rss - lastRss_;
+  }
+  lastHeapSize_ = heapSize;
+  lastRss_ = rss;
+
+  peakHeapSize_ = std::max(heapSize, peakHeapSize_ - peakHeapSize_ / 10);
+  if (heapSize <= 0 || heapSize < maxHeapSize_ / 10 ||
+      heapSize < peakHeapSize_ - peakHeapSize_ / 20) {
+    return calibration_;
+  }
+
+  // keep the baseline where the growth is explained by a plausible ratio
+  auto heap = static_cast<double>(heapSize);
+  auto growth = static_cast<double>(rss - baselineRss_);
+  if (growth > heap * kMaxCalibration) {
+    baselineRss_ += static_cast<int64_t>(growth - heap * kMaxCalibration);
+  } else if (growth < heap * kMinCalibration) {
+    baselineRss_ -= static_cast<int64_t>(heap * kMinCalibration - growth);
+  }
+
+  auto ratio = static_cast<double>(rss - baselineRss_) / heap;
+  ratio = std::min(std::max(ratio, kMinCalibration), kMaxCalibration);
+  calibration_ = 0.75 * calibration_ + 0.25 * ratio;
+  return calibration_;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_HEAPCALIBRATOR_H_
+#define GEODE_HEAPCALIBRATOR_H_
+
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Scales the heap size estimated by the regions to the memory the process
+ * actually uses.
+ *
+ * Each sample compares the growth of the resident set size since a baseline
+ * with the accounted heap size and folds the ratio into a smoothed
+ * calibration. Samples are only taken near the recent high water mark of the
+ * heap, because memory freed by evictions stays resident in the allocator
+ * for a while. The high water mark decays, so once the heap settles at a
+ * lower size after eviction it is sampled again.
+ *
+ * The resident set also grows for reasons unrelated to the cache. Growth
+ * between two samples with the same accounted heap size, and growth that no
+ * ratio between 0.5 and 4 explains, moves the baseline instead.
+ */
+class HeapCalibrator {
+ public:
+  HeapCalibrator(int64_t maxHeapSize, int64_t baselineRss);
+
+  /**
+   * Records the accounted heap size and resident set size and returns the
+   * updated calibration.
+   */
+  double sample(int64_t heapSize, int64_t rss);
+
+  double calibration() const { return calibration_; }
+
+  int64_t baselineRss() const { return baselineRss_; }
+
+ private:
+  int64_t maxHeapSize_;
+  int64_t baselineRss_;
+  int64_t peakHeapSize_;
+  int64_t lastHeapSize_;
+  int64_t lastRss_;
+  double calibration_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_HEAPCALIBRATOR_H_
@@ -17,6 +17,8 @@
 
 #include "LRUEntriesMap.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 
 #include "CacheImpl.hpp"
@@ -24,12 +26,17 @@
 #include "ExpiryTaskManager.hpp"
 #include "LRUEntryProperties.hpp"
 #include "MapSegment.hpp"
+#include "MemoryAccounting.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+const int32_t HEAP_LRU_ASSIST_EVICTIONS = 2;
+}  // namespace
+
 /**
  * @brief LRUAction for testing map outside of a region....
  */
@@ -62,7 +69,8 @@ LRUEntriesMap::LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
                              const LRUAction::Action& lruAction,
                              const uint32_t limit,
                              bool concurrencyChecksEnabled,
-                             const uint8_t concurrency, bool heapLRUEnabled)
+                             const uint8_t concurrency, bool heapLRUEnabled,
+                             bool admissionEnabled)
     : ConcurrentEntriesMap(expiryTaskManager, std::move(entryFactory),
                            concurrencyChecksEnabled, region, concurrency),
       lru_queue_(),
@@ -71,6 +79,8 @@ LRUEntriesMap::LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
       m_validEntries(0),
       m_heapLRUEnabled(heapLRUEnabled) {
   m_currentMapSize = 0;
+  m_entryOverhead = static_cast<int64_t>(
+      MemoryAccounting::entryOverhead(getEntryFactory()->mapEntrySize()));
   m_action = nullptr;
   m_evictionControllerPtr = nullptr;
   // translate action type to an instance.
@@ -89,6 +99,10 @@ LRUEntriesMap::LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
   } else {
     m_action = new TestMapAction(this);
   }
+  // admission needs an entry count to size the window and the sketch
+  if (admissionEnabled && limit > 0) {
+    m_sketch = std::unique_ptr<FrequencySketch>(new FrequencySketch(limit));
+  }
 }
 
 void LRUEntriesMap::close() {
@@ -140,21 +154,24 @@ GfErrType LRUEntriesMap::create(const std::shared_ptr<CacheableKey>& key,
       return err;
     }
 
-    lru_queue_.push(mePtr);
+    recordAccess(key);
+    lruPush(mePtr);
     me = mePtr;
   }
   if (m_evictionControllerPtr != nullptr) {
     int64_t newSize =
         static_cast<int64_t>(Utils::checkAndGetObjectSize(newValue));
-    newSize += static_cast<int64_t>(Utils::checkAndGetObjectSize(key));
-    if (oldValue != nullptr) {
+    if (CacheableToken::isInvalid(oldValue)) {
+      // the entry and its key are already accounted for
       newSize -= static_cast<int64_t>(oldValue->objectSize());
     } else {
-      newSize -= static_cast<int64_t>(sizeof(void*));
+      newSize += static_cast<int64_t>(Utils::checkAndGetObjectSize(key));
+      newSize += m_entryOverhead;
     }
     updateMapSize(newSize);
   }
   err = processLRU();
+  assistHeapEviction();
   return err;
 }
 
@@ -168,7 +185,7 @@ GfErrType LRUEntriesMap::processLRU() {
 
 GfErrType LRUEntriesMap::evictionHelper() {
   GfErrType err = GF_NOERR;
-  auto entry = lru_queue_.pop();
+  auto entry = lruPop();
   if (entry == nullptr) {
     err = GF_ENOENT;
     return err;
@@ -184,7 +201,7 @@ GfErrType LRUEntriesMap::evictionHelper() {
   return err;
 }
 
-void LRUEntriesMap::processLRU(int32_t numEntriesToEvict) {
+int32_t LRUEntriesMap::processLRU(int32_t numEntriesToEvict) {
   int32_t evicted = 0;
   for (int32_t i = 0; i < numEntriesToEvict; i++) {
     if (m_validEntries > 0 && size() > 0) {
@@ -195,6 +212,24 @@ void LRUEntriesMap::processLRU(int32_t numEntriesToEvict) {
       break;
     }
   }
+  return evicted;
+}
+
+/**
+ * @brief While the heap is over its limit every write evicts a couple of
+ * entries itself, so that a burst of writes can not outrun the eviction
+ * controller's thread.
+ */
+void LRUEntriesMap::assistHeapEviction() {
+  if (m_evictionControllerPtr == nullptr ||
+      !m_evictionControllerPtr->overLimit()) {
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto evicted = processLRU(HEAP_LRU_ASSIST_EVICTIONS);
+  m_evictionControllerPtr->assisted(evicted,
+                                    std::chrono::steady_clock::now() - start);
 }
 
 GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
@@ -234,7 +269,7 @@ GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
   }
   if (!isOldValueToken) {
     --m_validEntries;
-    lru_queue_.remove(me);
+    lruRemove(me);
     auto newSize = CacheableToken::invalid()->objectSize();
     if (oldValue != nullptr) {
       newSize -= oldValue->objectSize();
@@ -310,6 +345,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
       ++m_validEntries;
     }
 
+    recordAccess(key);
     // Add new entry to LRU list
     if (isUpdate == false) {
       ++m_size;
@@ -318,13 +354,13 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
       segmentRPtr->getEntry(key, mePtr, tmpValue);
       // mePtr cannot be null, we just put it...
       // must convert to an std::shared_ptr<LRUMapEntryImpl>...
-      lru_queue_.push(mePtr);
+      lruPush(mePtr);
       me = mePtr;
     } else {
       if (!CacheableToken::isToken(newValue) && isOldValueToken) {
         std::shared_ptr<Cacheable> tmpValue;
         segmentRPtr->getEntry(key, mePtr, tmpValue);
-        lru_queue_.push(mePtr);
+        lruPush(mePtr);
         me = mePtr;
       }
     }
@@ -342,6 +378,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
     */
     if (isUpdate == false) {
       newSize += static_cast<int64_t>(Utils::checkAndGetObjectSize(key));
+      newSize += m_entryOverhead;
     } else {
       if (oldValue != nullptr) {
         newSize -= static_cast<int64_t>(oldValue->objectSize());
@@ -357,6 +394,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
   if (segmentLocked) {
     segmentRPtr->unlock();
   }
+  assistHeapEviction();
   return err;
 }
 
@@ -373,6 +411,9 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
   auto* segment = segmentFor(key);
   std::shared_ptr<MapEntryImpl> map_entry;
 
+  // misses count too, so a key fetched repeatedly is admitted once cached
+  recordAccess(key);
+
   {
     std::unique_lock<MapSegment> lock;
 
@@ -408,7 +449,7 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
 
       ++m_validEntries;
       trigger_lru = true;
-      lru_queue_.push(map_entry);
+      lruPush(map_entry);
 
       if (m_evictionControllerPtr != nullptr) {
         int64_t newSize = 0;
@@ -421,7 +462,7 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
         updateMapSize(newSize);
       }
     } else {
-      lru_queue_.move_to_end(map_entry);
+      lruMoveToEnd(map_entry);
     }
   }
 
@@ -441,7 +482,7 @@ GfErrType LRUEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
   if ((err = segmentRPtr->remove(key, result, me, updateCount, versionTag,
                                  afterRemote, isEntryFound)) == GF_NOERR) {
     if (result != nullptr && me != nullptr) {
-      lru_queue_.remove(me);
+      lruRemove(me);
       LRUEntryProperties& lru_prop = me->getLRUProperties();
       if (isEntryFound) --m_size;
       if (!CacheableToken::isToken(result)) {
@@ -465,6 +506,9 @@ GfErrType LRUEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
       if (m_evictionControllerPtr != nullptr) {
         int64_t sizeToRemove = static_cast<int64_t>(key->objectSize());
         sizeToRemove += static_cast<int64_t>(result->objectSize());
+        if (isEntryFound) {
+          sizeToRemove += m_entryOverhead;
+        }
         updateMapSize(-sizeToRemove);
       }
     }
@@ -473,6 +517,107 @@ GfErrType LRUEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void LRUEntriesMap::recordAccess(const std::shared_ptr<CacheableKey>& key) {
+  if (m_sketch) {
+    m_sketch->increment(key->hashcode());
+  }
+}
+
+void LRUEntriesMap::lruPush(const std::shared_ptr<MapEntryImpl>& entry) {
+  if (!m_sketch) {
+    lru_queue_.push(entry);
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(m_admissionMutex);
+  entry->getLRUProperties().in_window(true);
+  window_queue_.push(entry);
+}
+
+void LRUEntriesMap::lruMoveToEnd(const std::shared_ptr<MapEntryImpl>& entry) {
+  if (!m_sketch) {
+    lru_queue_.move_to_end(entry);
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(m_admissionMutex);
+  if (entry->getLRUProperties().in_window()) {
+    window_queue_.move_to_end(entry);
+  } else {
+    lru_queue_.move_to_end(entry);
+  }
+}
+
+void LRUEntriesMap::lruRemove(const std::shared_ptr<MapEntryImpl>& entry) {
+  if (!m_sketch) {
+    lru_queue_.remove(entry);
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(m_admissionMutex);
+  auto& properties = entry->getLRUProperties();
+  if (properties.in_window()) {
+    window_queue_.remove(entry);
+    properties.in_window(false);
+  } else {
+    lru_queue_.remove(entry);
+  }
+}
+
+/**
+ * @brief Picks the entry to evict. Without admission this is the head of the
+ * LRU queue. With admission, entries leaving the window fill the main queue
+ * until it is full; after that each one competes with the main queue's head
+ * and the less frequently accessed of the two is evicted.
+ */
+std::shared_ptr<MapEntryImpl> LRUEntriesMap::lruPop() {
+  if (!m_sketch) {
+    return lru_queue_.pop();
+  }
+
+  std::lock_guard<std::mutex> guard(m_admissionMutex);
+  const size_t windowLimit = std::max<uint32_t>(1, m_limit / 100);
+  const size_t mainLimit = m_limit > windowLimit ? m_limit - windowLimit : 0;
+
+  while (window_queue_.size() > windowLimit &&
+         lru_queue_.size() < mainLimit) {
+    auto entry = window_queue_.pop();
+    entry->getLRUProperties().in_window(false);
+    lru_queue_.push(entry);
+  }
+
+  // An entry popped from the window stays marked as in the window, so that
+  // removing it when it is evicted leaves the main queue alone.
+  if (window_queue_.size() > windowLimit) {
+    auto candidate = window_queue_.pop();
+    auto victim = lru_queue_.front();
+    if (victim == nullptr) {
+      return candidate;
+    }
+    if (frequencyOf(candidate) > frequencyOf(victim)) {
+      candidate->getLRUProperties().in_window(false);
+      lru_queue_.push(candidate);
+      return lru_queue_.pop();
+    }
+    if (m_region != nullptr) {
+      m_region->getRegionStats()->incLruAdmissionRejects();
+    }
+    return candidate;
+  }
+
+  if (auto entry = lru_queue_.pop()) {
+    return entry;
+  }
+  return window_queue_.pop();
+}
+
+uint8_t LRUEntriesMap::frequencyOf(
+    const std::shared_ptr<MapEntryImpl>& entry) const {
+  std::shared_ptr<CacheableKey> key;
+  entry->getKeyI(key);
+  return key ? m_sketch->frequency(key->hashcode()) : 0;
+}
+
 void LRUEntriesMap::updateMapSize(int64_t size) {
   // TODO: check and remove null check since this has already been done
   // by all the callers
@@ -21,11 +21,14 @@
 #define GEODE_LRUENTRIESMAP_H_
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include <geode/Cache.hpp>
 #include <geode/internal/geode_globals.hpp>
 
 #include "ConcurrentEntriesMap.hpp"
+#include "FrequencySketch.hpp"
 #include "LRUAction.hpp"
 #include "LRUMapEntry.hpp"
 #include "LRUQueue.hpp"
@@ -41,6 +44,11 @@ class EvictionController;
 /**
  * @brief Concurrent entries map with LRU behavior.
  * Not designed for subclassing...
+ *
+ * With admission enabled, new entries first go to a small LRU window. When
+ * an entry has to be evicted, the one leaving the window only replaces the
+ * least recently used entry of the main queue if its key is more frequently
+ * accessed, as estimated by a FrequencySketch of recent accesses.
  */
 class LRUEntriesMap : public ConcurrentEntriesMap {
  protected:
@@ -56,6 +64,10 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
   std::string m_name;
   std::atomic<uint32_t> m_validEntries;
   bool m_heapLRUEnabled;
+  LRUQueue window_queue_;
+  std::unique_ptr<FrequencySketch> m_sketch;
+  std::mutex m_admissionMutex;
+  int64_t m_entryOverhead;
 
  public:
   LRUEntriesMap(const LRUEntriesMap&) = delete;
@@ -64,7 +76,8 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
                 std::unique_ptr<EntryFactory> entryFactory,
                 RegionInternal* region, const LRUAction::Action& lruAction,
                 const uint32_t limit, bool concurrencyChecksEnabled,
-                const uint8_t concurrency = 16, bool heapLRUEnabled = false);
+                const uint8_t concurrency = 16, bool heapLRUEnabled = false,
+                bool admissionEnabled = false);
 
   ~LRUEntriesMap() noexcept override;
 
@@ -92,7 +105,7 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
       const std::shared_ptr<CacheableKey>& key,
       std::shared_ptr<MapEntryImpl>& me) const override;
   GfErrType processLRU();
-  void processLRU(int32_t numEntriesToEvict);
+  int32_t processLRU(int32_t numEntriesToEvict);
   GfErrType evictionHelper();
   void updateMapSize(int64_t size);
   inline void setPersistenceManager(
@@ -127,6 +140,14 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
 
   void clear() override;
 
+ private:
+  void assistHeapEviction();
+  void recordAccess(const std::shared_ptr<CacheableKey>& key);
+  void lruPush(const std::shared_ptr<MapEntryImpl>& entry);
+  void lruMoveToEnd(const std::shared_ptr<MapEntryImpl>& entry);
+  void lruRemove(const std::shared_ptr<MapEntryImpl>& entry);
+  std::shared_ptr<MapEntryImpl> lruPop();
+  uint8_t frequencyOf(const std::shared_ptr<MapEntryImpl>& entry) const;
 };  // class LRUEntriesMap
 
 }  // namespace client
@@ -51,6 +51,10 @@ class LRUEntryProperties {
 
   list_iterator iterator() const { return iter_; }
 
+  bool in_window() const { return in_window_; }
+
+  void in_window(bool inWindow) { in_window_ = inWindow; }
+
  protected:
   // this constructor deliberately skips initializing any fields
   inline explicit LRUEntryProperties(bool) {}
@@ -58,6 +62,7 @@ class LRUEntryProperties {
  private:
   std::shared_ptr<void> persistence_info_;
   list_iterator iter_;
+  bool in_window_ = false;
 };
 
 }  // namespace client
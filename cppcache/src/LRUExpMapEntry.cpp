@@ -24,17 +24,24 @@ namespace geode {
 namespace client {
 
 void LRUExpEntryFactory::newMapEntry(
-    ExpiryTaskManager* expiryTaskManager,
+    SlabPool* pool, ExpiryTaskManager* expiryTaskManager,
     const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(expiryTaskManager,
-                                                              key);
+    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(
+        pool, expiryTaskManager, key);
   } else {
-    result = MapEntryT<LRUExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result =
+        MapEntryT<LRUExpMapEntry, 0, 0>::create(pool, expiryTaskManager, key);
   }
 }
 
+size_t LRUExpEntryFactory::mapEntrySize() const {
+  return m_concurrencyChecksEnabled
+             ? sizeof(MapEntryT<VersionedLRUExpMapEntry, 0, 0>)
+             : sizeof(MapEntryT<LRUExpMapEntry, 0, 0>);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -23,16 +23,22 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void LRUEntryFactory::newMapEntry(ExpiryTaskManager*,
+void LRUEntryFactory::newMapEntry(SlabPool* pool, ExpiryTaskManager*,
                                   const std::shared_ptr<CacheableKey>& key,
                                   std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedLRUMapEntry, 0, 0>::create(key);
+    result = MapEntryT<VersionedLRUMapEntry, 0, 0>::create(pool, key);
   } else {
-    result = MapEntryT<LRUMapEntry, 0, 0>::create(key);
+    result = MapEntryT<LRUMapEntry, 0, 0>::create(pool, key);
   }
 }
 
+size_t LRUEntryFactory::mapEntrySize() const {
+  return m_concurrencyChecksEnabled
+             ? sizeof(MapEntryT<VersionedLRUMapEntry, 0, 0>)
+             : sizeof(MapEntryT<LRUMapEntry, 0, 0>);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -108,9 +108,11 @@ class LRUEntryFactory : public EntryFactory {
 
   ~LRUEntryFactory() noexcept override = default;
 
-  void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  void newMapEntry(SlabPool* pool, ExpiryTaskManager* expiryTaskManager,
                    const std::shared_ptr<CacheableKey>& key,
                    std::shared_ptr<MapEntryImpl>& result) const override;
+
+  size_t mapEntrySize() const override;
 };
 
 }  // namespace client
@@ -51,6 +51,16 @@ LRUQueue::type LRUQueue::pop() {
   return result;
 }
 
+LRUQueue::type LRUQueue::front() {
+  std::unique_lock<mutex> lock{mutex_};
+
+  if (container_.empty()) {
+    return {};
+  }
+
+  return container_.front();
+}
+
 void LRUQueue::remove(const type& entry) {
   auto end = container_.end();
   auto& properties = entry->getLRUProperties();
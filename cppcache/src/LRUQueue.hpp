@@ -59,6 +59,13 @@ class LRUQueue {
    */
   type pop();
 
+  /**
+   * Returns the entry on the queue's head without removing it
+   * @return If the queue is not empty, the entry on the queue's head
+   *         is returned, nullptr otherwise.
+   */
+  type front();
+
   /**
    * Removes an entry from the queue
    * @param entry Entry to be removed
@@ -17,6 +17,7 @@
 
 #include "LocalRegion.hpp"
 
+#include <cmath>
 #include <vector>
 
 #include <boost/regex.hpp>
@@ -939,7 +940,28 @@ GfErrType LocalRegion::getNoThrow(
   cachePerfStats.incMisses();
   std::shared_ptr<VersionTag> versionTag;
   // Get from some remote source (e.g. external java server) if required.
-  err = getNoThrow_remote(keyPtr, value, aCallbackArgument, versionTag);
+  bool coalesced = false;
+  if (cachingEnabled && aCallbackArgument == nullptr) {
+    // Concurrent misses on this key share one request. Only the caller that
+    // made it stores the value, guarded by its update counter as usual.
+    auto remoteGet = m_remoteGets.run(
+        keyPtr,
+        [&] {
+          RemoteGet fetched;
+          fetched.err = getNoThrow_remote(keyPtr, fetched.value, nullptr,
+                                          fetched.versionTag);
+          return fetched;
+        },
+        coalesced);
+    err = remoteGet.err;
+    value = remoteGet.value;
+    versionTag = remoteGet.versionTag;
+    if (coalesced) {
+      m_regionStats->incCoalescedGets();
+    }
+  } else {
+    err = getNoThrow_remote(keyPtr, value, aCallbackArgument, versionTag);
+  }
 
   // Its a cache missor it is invalid token then Check if we have a local
   // loader.
@@ -967,6 +989,16 @@ GfErrType LocalRegion::getNoThrow(
     }
   }
 
+  if (coalesced && !isLoaderInvoked) {
+    // The value was stored, and listeners invoked, by the caller whose
+    // request this one shared.
+    if (CacheableToken::isInvalid(value) ||
+        CacheableToken::isTombstone(value)) {
+      value = nullptr;
+    }
+    return err;
+  }
+
   std::shared_ptr<Cacheable> oldValue;
   // Found it somehow, so store it.
   if (value != nullptr /*&& value != CacheableToken::invalid( )*/ &&
@@ -1737,6 +1769,7 @@ GfErrType LocalRegion::updateNoThrow(
           "of invalid delta.",
           TAction::name(), Utils::nullSafeToString(key).c_str());
       m_cacheImpl->getCachePerfStats().incFailureOnDeltaReceived();
+      m_regionStats->incDeltaFullValueRequests();
       // Get full object from server.
       std::shared_ptr<Cacheable>& newValue1 =
           const_cast<std::shared_ptr<Cacheable>&>(value);
@@ -3152,22 +3185,25 @@ void LocalRegion::adjustCacheWriter(const std::string& lib,
   m_writer = m_regionAttributes.getCacheWriter();
 }
 
-void LocalRegion::evict(float percentage) {
+int32_t LocalRegion::evict(float percentage) {
   boost::shared_lock<decltype(mutex_)> guard{mutex_};
 
   if (m_released || m_destroyPending) {
-    return;
+    return 0;
   }
 
   if (m_entries != nullptr) {
     int32_t size = m_entries->size();
-    int32_t entriesToEvict = static_cast<int32_t>(percentage * size);
+    // round up so that small regions give up entries too
+    auto entriesToEvict =
+        static_cast<int32_t>(std::ceil(percentage * static_cast<float>(size)));
     // only invoked from EvictionController so static_cast is always safe
     LRUEntriesMap* lruMap = static_cast<LRUEntriesMap*>(m_entries);
-    LOGINFO("Evicting %d entries. Current entry count is %d", entriesToEvict,
+    LOGFINE("Evicting %d entries. Current entry count is %d", entriesToEvict,
             size);
-    lruMap->processLRU(entriesToEvict);
+    return lruMap->processLRU(entriesToEvict);
   }
+  return 0;
 }
 void LocalRegion::invokeAfterAllEndPointDisconnected() {
   if (m_listener != nullptr) {
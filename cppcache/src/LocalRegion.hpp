@@ -45,6 +45,7 @@
 #include "RegionStats.hpp"
 #include "TSSTXStateWrapper.hpp"
 #include "TombstoneList.hpp"
+#include "util/concurrent/single_flight.hpp"
 #include "util/synchronized_map.hpp"
 
 namespace apache {
@@ -399,7 +400,7 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
                          const std::string& factoryFuncName) override;
   CacheImpl* getCacheImpl() const override;
 
-  void evict(float percentage) override;
+  int32_t evict(float percentage) override;
 
   virtual void acquireGlobals(bool isFailover);
 
@@ -586,6 +587,19 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
           interest_list);
 
  private:
+  struct RemoteGet {
+    GfErrType err;
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<VersionTag> versionTag;
+  };
+
+  // Server gets in flight for cache misses, so that concurrent misses on a
+  // key share one request.
+  single_flight<std::shared_ptr<CacheableKey>, RemoteGet,
+                dereference_hash<std::shared_ptr<CacheableKey>>,
+                dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      m_remoteGets;
+
   std::shared_ptr<Region> findSubRegion(const std::string& name);
   GfErrType invalidateRegionNoThrowOnSubRegions(
       const std::shared_ptr<Serializable>& aCallbackArgument,
@@ -43,16 +43,22 @@ VersionStamp& MapEntryImpl::getVersionStamp() {
       "non-versioned MapEntry");
 }
 
-void EntryFactory::newMapEntry(ExpiryTaskManager*,
+void EntryFactory::newMapEntry(SlabPool* pool, ExpiryTaskManager*,
                                const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(pool, key);
   } else {
-    result = MapEntryT<MapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<MapEntryImpl, 0, 0>::create(pool, key);
   }
 }
 
+size_t EntryFactory::mapEntrySize() const {
+  return m_concurrencyChecksEnabled
+             ? sizeof(MapEntryT<VersionedMapEntryImpl, 0, 0>)
+             : sizeof(MapEntryT<MapEntryImpl, 0, 0>);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
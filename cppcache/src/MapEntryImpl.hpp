@@ -31,6 +31,7 @@
 #include "CacheableToken.hpp"
 #include "MapEntry.hpp"
 #include "RegionInternal.hpp"
+#include "SlabPool.hpp"
 #include "VersionStamp.hpp"
 
 namespace apache {
@@ -131,10 +132,15 @@ class APACHE_GEODE_EXPORT EntryFactory {
 
   virtual ~EntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  /** @brief creates an entry allocated from the given pool. */
+  virtual void newMapEntry(SlabPool* pool,
+                           ExpiryTaskManager* expiryTaskManager,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 
+  /** @brief size in bytes of the entries created by newMapEntry. */
+  virtual size_t mapEntrySize() const;
+
  protected:
   bool m_concurrencyChecksEnabled;
 };
@@ -23,6 +23,7 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "MapEntry.hpp"
+#include "SlabPool.hpp"
 #include "TrackedMapEntry.hpp"
 
 #define GF_TRACK_MAX 4
@@ -127,6 +128,19 @@ class MapEntryT final : public TBase {
     return std::make_shared<MapEntryT>(expiryTaskManager, key);
   }
 
+  inline static std::shared_ptr<MapEntryT> create(
+      SlabPool* pool, const std::shared_ptr<CacheableKey>& key) {
+    return std::allocate_shared<MapEntryT>(SlabPoolAllocator<MapEntryT>(pool),
+                                           key);
+  }
+
+  inline static std::shared_ptr<MapEntryT> create(
+      SlabPool* pool, ExpiryTaskManager* expiryTaskManager,
+      const std::shared_ptr<CacheableKey>& key) {
+    return std::allocate_shared<MapEntryT>(SlabPoolAllocator<MapEntryT>(pool),
+                                           expiryTaskManager, key);
+  }
+
   inline explicit MapEntryT(const std::shared_ptr<CacheableKey>& key)
       : TBase(key) {}
   inline MapEntryT(ExpiryTaskManager* expiryTaskManager,
@@ -19,13 +19,16 @@
 
 #include <chrono>
 
+#include <geode/SystemProperties.hpp>
+
+#include "CacheImpl.hpp"
 #include "MapEntry.hpp"
 #include "RegionInternal.hpp"
+#include "RegionStats.hpp"
 #include "TableOfPrimes.hpp"
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
 #include "TombstoneEntry.hpp"
-#include "TombstoneExpiryTask.hpp"
 #include "Utils.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
@@ -33,6 +36,13 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+// tombstones expired per hold of the segment lock
+const size_t TOMBSTONE_EXPIRY_BATCH = 1000;
+
+}  // namespace
+
 bool MapSegment::boolVal = false;
 
 void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
@@ -42,7 +52,11 @@ void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
   uint32_t mapSize = TableOfPrimes::nextLargerPrime(size, m_primeIndex);
   LOGFINER("Initializing MapSegment with size %d (given size %d).", mapSize,
            size);
-  m_map.reserve(mapSize);
+  m_entryPool = SlabPool::create();
+  m_nodePool = SlabPool::create();
+  m_map = CacheableKeyHashMap(
+      mapSize, CacheableKeyHashMap::hasher(), CacheableKeyHashMap::key_equal(),
+      CacheableKeyHashMap::allocator_type(m_nodePool.get()));
   m_entryFactory = entryFactory;
   m_region = region;
   m_tombstoneList =
@@ -356,22 +370,15 @@ void MapSegment::remove_entry(const std::shared_ptr<CacheableKey>& key) {
   m_map.erase(key);
 }
 
-bool MapSegment::remove_tomb_entry(
-    const std::shared_ptr<TombstoneEntry>& entry) {
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
-  if (!entry->valid()) {
-    return false;
-  }
-
-  std::shared_ptr<CacheableKey> key;
-  entry->entry()->getKeyI(key);
-
-  if (!m_tombstoneList->erase(key, false)) {
-    return false;
+bool MapSegment::expire_tombstones(
+    std::chrono::steady_clock::time_point& next) {
+  for (;;) {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    if (m_tombstoneList->expire(TOMBSTONE_EXPIRY_BATCH) <
+        TOMBSTONE_EXPIRY_BATCH) {
+      return m_tombstoneList->next_generation(next);
+    }
   }
-
-  m_map.erase(key);
-  return true;
 }
 /**
  * @brief get MapEntry for key. throws NoEntryException if absent.
@@ -500,7 +507,8 @@ int MapSegment::addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
     if (addIfAbsent) {
       std::shared_ptr<MapEntryImpl> entryImpl;
       // add a new entry with value as destroyed
-      m_entryFactory->newMapEntry(expiry_manager_, key, entryImpl);
+      m_entryFactory->newMapEntry(m_entryPool.get(), expiry_manager_, key,
+                                  entryImpl);
       entryImpl->setValueI(CacheableToken::destroyed());
       entry = entryImpl;
       newEntry = entryImpl;
@@ -637,31 +645,34 @@ GfErrType MapSegment::putForTrackedEntry(
 
       using clock = std::chrono::steady_clock;
 
+      // with cloning the value is copied before the delta is applied, unless
+      // nothing but this entry can see the value change
+      const auto inPlace = !m_region->getAttributes().getCloningEnabled() ||
+                           canApplyDeltaInPlace(oldValue);
       auto valueWithDelta = std::dynamic_pointer_cast<Delta>(oldValue);
+      if (valueWithDelta == nullptr) {
+        return GF_INVALID_DELTA;
+      }
       auto& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
       try {
-        if (m_region->getAttributes().getCloningEnabled()) {
-          auto tempVal = valueWithDelta->clone();
-          auto currTimeBefore = clock::now();
-          tempVal->fromDelta(*delta);
+        if (!inPlace) {
+          valueWithDelta = valueWithDelta->clone();
+        }
+        const auto deltaLength = delta->getBytesRemaining();
+        auto currTimeBefore = clock::now();
+        valueWithDelta->fromDelta(*delta);
 
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(true,
-                                              clock::now() - currTimeBefore);
-          }
-          newValue1 = std::dynamic_pointer_cast<Serializable>(tempVal);
-          entryImpl->setValueI(newValue1);
-        } else {
-          auto currTimeBefore = clock::now();
-          valueWithDelta->fromDelta(*delta);
-          newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
+        if (m_poolDM) {
+          m_poolDM->updateNotificationStats(true,
+                                            clock::now() - currTimeBefore);
+        }
+        newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
+        entryImpl->setValueI(newValue1);
 
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(true,
-                                              clock::now() - currTimeBefore);
-          }
-          entryImpl->setValueI(
-              std::dynamic_pointer_cast<Serializable>(valueWithDelta));
+        if (auto regionStats = m_region->getRegionStats()) {
+          const auto valueSize = newValue1->objectSize();
+          regionStats->incDeltaUpdates(
+              inPlace, valueSize > deltaLength ? valueSize - deltaLength : 0);
         }
       } catch (InvalidDeltaException&) {
         return GF_INVALID_DELTA;
@@ -671,7 +682,7 @@ GfErrType MapSegment::putForTrackedEntry(
     }
     if (m_concurrencyChecksEnabled) {
       // erase if the entry is in tombstone
-      m_tombstoneList->erase(key, true);
+      m_tombstoneList->erase(key);
       entryImpl->getVersionStamp().setVersions(versionStamp);
     }
     (void)incrementUpdateCount(key, entry);
@@ -688,6 +699,23 @@ GfErrType MapSegment::putForTrackedEntry(
     return GF_CACHE_ENTRY_UPDATED;
   }
 }
+// The value can change in place when no one outside of the map holds it;
+// during a put that is the entry, and the copies held by put() and
+// putForTrackedEntry(). A cache listener would see its old value change, and
+// heap LRU needs the old value's size, so those regions always copy.
+bool MapSegment::canApplyDeltaInPlace(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (value.use_count() > 3 ||
+      m_region->getAttributes().getCacheListener() != nullptr) {
+    return false;
+  }
+
+  return !m_region->getCacheImpl()
+              ->getDistributedSystem()
+              .getSystemProperties()
+              .heapLRULimitEnabled();
+}
+
 void MapSegment::reapTombstones(std::map<uint16_t, int64_t>& gcVersions) {
   std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
   m_tombstoneList->reap_tombstones(gcVersions);
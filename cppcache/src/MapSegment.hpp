@@ -20,6 +20,7 @@
 #ifndef GEODE_MAPSEGMENT_H_
 #define GEODE_MAPSEGMENT_H_
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -33,6 +34,7 @@
 #include "CacheableToken.hpp"
 #include "MapEntryImpl.hpp"
 #include "MapWithLock.hpp"
+#include "SlabPool.hpp"
 #include "TombstoneList.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
@@ -46,13 +48,19 @@ class RegionInternal;
 /** @brief type wrapper around the std::unordered_map implementation. */
 class MapSegment {
  private:
-  using CacheableKeyHashMap =
-      std::unordered_map<std::shared_ptr<CacheableKey>,
-                         std::shared_ptr<MapEntry>,
-                         dereference_hash<std::shared_ptr<CacheableKey>>,
-                         dereference_equal_to<std::shared_ptr<CacheableKey>>>;
+  using CacheableKeyHashMap = std::unordered_map<
+      std::shared_ptr<CacheableKey>, std::shared_ptr<MapEntry>,
+      dereference_hash<std::shared_ptr<CacheableKey>>,
+      dereference_equal_to<std::shared_ptr<CacheableKey>>,
+      SlabPoolAllocator<std::pair<const std::shared_ptr<CacheableKey>,
+                                  std::shared_ptr<MapEntry>>>>;
 
  private:
+  // entries and hash map nodes are carved out of slabs to avoid per
+  // allocation overhead; each segment has its own pools, so that their
+  // locks are only shared by threads working on the same segment
+  std::shared_ptr<SlabPool> m_entryPool;
+  std::shared_ptr<SlabPool> m_nodePool;
   // contain
   CacheableKeyHashMap m_map;
   // refers to object managed by the entries map...
@@ -142,7 +150,8 @@ class MapSegment {
         }
       }
     }
-    m_entryFactory->newMapEntry(expiry_manager_, key, newEntry);
+    m_entryFactory->newMapEntry(m_entryPool.get(), expiry_manager_, key,
+                                newEntry);
     newEntry->setValueI(newValue);
     if (m_concurrencyChecksEnabled) {
       if (versionTag) {
@@ -162,6 +171,7 @@ class MapSegment {
                                int updateCount, VersionStamp& versionStamp,
                                DataInput* delta = nullptr);
 
+  bool canApplyDeltaInPlace(const std::shared_ptr<Cacheable>& value) const;
   std::shared_ptr<Cacheable> getFromDisc(
       std::shared_ptr<CacheableKey> key,
       std::shared_ptr<MapEntryImpl>& entryImpl);
@@ -174,7 +184,9 @@ class MapSegment {
 
  public:
   MapSegment()
-      : m_map(),
+      : m_entryPool(),
+        m_nodePool(),
+        m_map(),
         m_entryFactory(nullptr),
         m_region(nullptr),
         expiry_manager_(nullptr),
@@ -283,10 +295,20 @@ class MapSegment {
 
   void reapTombstones(std::shared_ptr<CacheableHashSet> removedKeys);
 
-  bool remove_tomb_entry(const std::shared_ptr<TombstoneEntry>& entry);
+  /**
+   * @brief expire the tombstones that are due. Returns true and sets next to
+   *   the expiry time of the next generation if there are tombstones left.
+   */
+  bool expire_tombstones(std::chrono::steady_clock::time_point& next);
 
   void remove_entry(const std::shared_ptr<CacheableKey>& key);
 
+  /**
+   * @brief the tombstones of this segment. Access is not synchronized with
+   *   the segment's operations.
+   */
+  inline TombstoneList& getTombstoneList() { return *m_tombstoneList; }
+
   GfErrType isTombstone(std::shared_ptr<CacheableKey> key,
                         std::shared_ptr<MapEntryImpl>& me, bool& result);
 
@@ -0,0 +1,109 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MemoryAccounting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// virtual table pointer plus use and weak counts
+const size_t CONTROL_BLOCK_SIZE = sizeof(void*) + 2 * sizeof(int32_t);
+
+const size_t MALLOC_ALIGNMENT = 2 * sizeof(void*);
+
+const size_t MIN_ALLOCATION_SIZE = 4 * sizeof(void*);
+
+// next pointer, key and value pointers and the cached hash code
+const size_t HASH_NODE_SIZE =
+    sizeof(void*) +
+    sizeof(std::pair<std::shared_ptr<void>, std::shared_ptr<void>>) +
+    sizeof(size_t);
+
+}  // namespace
+
+size_t MemoryAccounting::allocationSize(size_t size) {
+  auto chunk = (size + sizeof(size_t) + MALLOC_ALIGNMENT - 1) &
+               ~(MALLOC_ALIGNMENT - 1);
+  return std::max(chunk, MIN_ALLOCATION_SIZE);
+}
+
+size_t MemoryAccounting::sharedAllocationSize(size_t size) {
+  return allocationSize(CONTROL_BLOCK_SIZE + size);
+}
+
+size_t MemoryAccounting::pooledAllocationSize(size_t size) {
+  const size_t alignment = alignof(std::max_align_t);
+  return (std::max(size, sizeof(void*)) + alignment - 1) / alignment *
+         alignment;
+}
+
+size_t MemoryAccounting::entryOverhead(size_t mapEntrySize) {
+  // the bucket array holds about one pointer per entry at the default load
+  // factor
+  return pooledAllocationSize(CONTROL_BLOCK_SIZE + mapEntrySize) +
+         pooledAllocationSize(HASH_NODE_SIZE) + sizeof(void*) +
+         2 * CONTROL_BLOCK_SIZE;
+}
+
+int64_t MemoryAccounting::residentSetSize() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return static_cast<int64_t>(counters.WorkingSetSize);
+  }
+  return 0;
+#elif defined(__APPLE__)
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+    return static_cast<int64_t>(info.resident_size);
+  }
+  return 0;
+#else
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  if (statm >> size >> resident) {
+    return resident * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  }
+  return 0;
+#endif
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_MEMORYACCOUNTING_H_
+#define GEODE_MEMORYACCOUNTING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Estimates of the memory the cache uses beyond what Cacheable::objectSize()
+ * reports, used to feed the heap LRU eviction controller.
+ */
+class MemoryAccounting {
+ public:
+  /**
+   * Returns the number of bytes a typical malloc reserves for a request of
+   * size bytes, including its chunk header and alignment padding.
+   */
+  static size_t allocationSize(size_t size);
+
+  /**
+   * Returns the number of bytes used by an object of size bytes created
+   * with std::make_shared, which shares its allocation with the control
+   * block.
+   */
+  static size_t sharedAllocationSize(size_t size);
+
+  /**
+   * Returns the number of bytes used by an object of size bytes allocated
+   * from a SlabPool.
+   */
+  static size_t pooledAllocationSize(size_t size);
+
+  /**
+   * Returns the number of bytes a region entry uses besides its key and
+   * value objects: the pooled map entry of mapEntrySize bytes, its pooled
+   * hash map node and bucket, and the control blocks of the key and the
+   * value.
+   */
+  static size_t entryOverhead(size_t mapEntrySize);
+
+  /**
+   * Returns the resident set size of this process in bytes, or zero where
+   * it can not be determined.
+   */
+  static int64_t residentSetSize();
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_MEMORYACCOUNTING_H_
@@ -19,6 +19,7 @@
 
 #include <geode/Cache.hpp>
 #include <geode/DataInput.hpp>
+#include <geode/PdxSchema.hpp>
 #include <geode/PdxWrapper.hpp>
 #include <geode/PoolManager.hpp>
 
@@ -90,6 +91,23 @@ void PdxHelper::serializePdx(
   auto pdxTypeRegistry = cacheImpl->getPdxTypeRegistry();
   auto& cachePerfStats = cacheImpl->getCachePerfStats();
 
+  // a schema object whose type id is known is written without looking up its
+  // type or any of its field names
+  auto schemaObject =
+      dynamic_cast<const PdxSchemaSerializableBase*>(pdxObject.get());
+  auto generation = pdxTypeRegistry->getGeneration();
+  if (schemaObject != nullptr && !schemaObject->isReadFromOtherType()) {
+    auto typeId = schemaObject->getCachedTypeId(generation);
+    if (typeId != -1) {
+      PdxSchemaWriter writer{output, typeId};
+      schemaObject->toData(writer);
+      auto pdxLen = writer.end();
+      cachePerfStats.incPdxSerialization(
+          pdxLen + 1 + 2 * 4);  // pdxLen + 93 DSID + len + typeID
+      return;
+    }
+  }
+
   auto&& className = pdxObject->getClassName();
   auto localPdxType = pdxTypeRegistry->getLocalPdxType(className);
 
@@ -109,6 +127,10 @@ void PdxHelper::serializePdx(
     pdxTypeRegistry->addLocalPdxType(className, nType);
     pdxTypeRegistry->addPdxType(nTypeId, nType);
 
+    if (schemaObject != nullptr) {
+      schemaObject->setCachedTypeId(generation, nTypeId);
+    }
+
     if (cacheImpl != nullptr) {
       uint8_t* stPos = const_cast<uint8_t*>(output.getBuffer()) +
                        ptc.getStartPositionOffset();
@@ -139,6 +161,10 @@ void PdxHelper::serializePdx(
     pdxObject->toData(prw);
     prw.endObjectWriting();
 
+    if (schemaObject != nullptr) {
+      schemaObject->setCachedTypeId(generation, localPdxType->getTypeId());
+    }
+
     //[ToDo] need to write bytes for stats
     if (cacheImpl != nullptr) {
       uint8_t* stPos = const_cast<uint8_t*>(output.getBuffer()) +
@@ -172,7 +198,16 @@ std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
              ", isLocal = " + std::to_string(pType->isLocal()));
 
     object = serializationRegistry->getPdxSerializableType(pdxClassname);
-    if (pType->isLocal())  // local type no need to read Unread data
+    auto schemaObject =
+        std::dynamic_pointer_cast<PdxSchemaSerializableBase>(object);
+    if (schemaObject && pType == localType) {
+      // the bytes were written for this class' own type, read them in order
+      schemaObject->setCachedTypeId(pdxTypeRegistry->getGeneration(), typeId);
+      auto start = dataInput.getBytesRead();
+      PdxSchemaReader reader{dataInput};
+      schemaObject->fromData(reader);
+      dataInput.reset(start + static_cast<size_t>(length));
+    } else if (pType->isLocal())  // local type no need to read Unread data
     {
       auto plr = PdxLocalReader(dataInput, pType, length, pdxTypeRegistry);
       object->fromData(plr);
@@ -18,6 +18,7 @@
 #include "PdxInstanceImpl.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include <geode/Cache.hpp>
 #include <geode/PdxFieldTypes.hpp>
@@ -26,8 +27,10 @@
 
 #include "CacheRegionHelper.hpp"
 #include "DataInputInternal.hpp"
+#include "MemoryAccounting.hpp"
 #include "PdxHelper.hpp"
 #include "Utils.hpp"
+#include "util/hash.hpp"
 #include "util/string.hpp"
 
 namespace {
@@ -68,6 +71,7 @@ PdxInstanceImpl::PdxInstanceImpl(const uint8_t* buffer, size_t length,
                                  bool enableTimeStatistics)
     : buffer_(buffer, buffer + length),
       typeId_(pdxType->getTypeId()),
+      hashcode_(0),
       pdxType_(pdxType),
       cacheStats_(cacheStats),
       pdxTypeRegistry_(pdxTypeRegistry),
@@ -84,6 +88,7 @@ PdxInstanceImpl::PdxInstanceImpl(FieldVsValues fieldVsValue,
                                  const CacheImpl& cacheImpl,
                                  bool enableTimeStatistics)
     : typeId_(0),
+      hashcode_(0),
       pdxType_(pdxType),
       m_updatedFields(fieldVsValue),
       cacheStats_(cacheStats),
@@ -726,6 +731,11 @@ int PdxInstanceImpl::deepArrayHashCode(std::shared_ptr<Cacheable> obj) {
 }
 
 int32_t PdxInstanceImpl::hashcode() const {
+  auto cached = hashcode_.load(std::memory_order_relaxed);
+  if (cached != 0) {
+    return cached;
+  }
+
   const auto& stream = getPdxStream();
   auto input = cacheImpl_.createDataInput(stream.data(), stream.size());
 
@@ -786,6 +796,7 @@ int32_t PdxInstanceImpl::hashcode() const {
     }
   }
 
+  hashcode_.store(hashCode, std::memory_order_relaxed);
   return hashCode;
 }
 
@@ -807,6 +818,7 @@ std::shared_ptr<PdxType> PdxInstanceImpl::getPdxType(Pool* pool) const {
 
 void PdxInstanceImpl::updatePdxStream(std::vector<uint8_t> stream) {
   buffer_ = std::move(stream);
+  hashcode_.store(0, std::memory_order_relaxed);
 }
 
 const std::vector<uint8_t>& PdxInstanceImpl::getPdxStream() const {
@@ -1221,6 +1233,12 @@ bool PdxInstanceImpl::operator==(const CacheableKey& o) const {
     return false;
   }
 
+  if (pdxType_ == otherType ||
+      (pdxType_->getTypeId() != 0 &&
+       pdxType_->getTypeId() == otherType->getTypeId())) {
+    return equalsSameType(*other);
+  }
+
   auto identityFields = getIdentityPdxFields();
   auto otherIdentityFields = other->getIdentityPdxFields();
 
@@ -1328,6 +1346,80 @@ bool PdxInstanceImpl::operator==(const CacheableKey& o) const {
   return true;
 }
 
+bool PdxInstanceImpl::equalsSameType(const PdxInstanceImpl& other) const {
+  const auto& stream = getPdxStream();
+  const auto& otherStream = other.getPdxStream();
+
+  if (stream.size() == otherStream.size() &&
+      std::memcmp(stream.data(), otherStream.data(), stream.size()) == 0) {
+    return true;
+  }
+
+  auto input = cacheImpl_.createDataInput(stream.data(), stream.size());
+  auto otherInput =
+      cacheImpl_.createDataInput(otherStream.data(), otherStream.size());
+
+  // Both instances share one field layout, so each identity field can be
+  // compared as a single span without pairing fields up by name first.
+  for (const auto& field : getIdentityPdxFields()) {
+    auto sequenceId = field->getSequenceId();
+    auto pos = getOffset(input, sequenceId);
+    auto nextpos = getNextFieldPosition(input, sequenceId + 1);
+    auto otherPos = other.getOffset(otherInput, sequenceId);
+    auto otherNextpos = other.getNextFieldPosition(otherInput, sequenceId + 1);
+
+    if ((nextpos - pos) == (otherNextpos - otherPos) &&
+        std::memcmp(stream.data() + pos, otherStream.data() + otherPos,
+                    static_cast<size_t>(nextpos - pos)) == 0) {
+      continue;
+    }
+
+    switch (field->getTypeId()) {
+      case PdxFieldTypes::OBJECT: {
+        // Equal objects may still differ in their serialized form.
+        std::shared_ptr<Cacheable> object = nullptr;
+        std::shared_ptr<Cacheable> otherObject = nullptr;
+        setOffsetForObject(input, sequenceId);
+        input.readObject(object);
+        other.setOffsetForObject(otherInput, sequenceId);
+        otherInput.readObject(otherObject);
+
+        if (object != nullptr) {
+          if (!deepArrayEquals(object, otherObject)) {
+            return false;
+          }
+        } else if (otherObject != nullptr) {
+          return false;
+        }
+        break;
+      }
+      case PdxFieldTypes::OBJECT_ARRAY: {
+        auto objectArray = CacheableObjectArray::create();
+        auto otherObjectArray = CacheableObjectArray::create();
+        setOffsetForObject(input, sequenceId);
+        objectArray->fromData(input);
+        other.setOffsetForObject(otherInput, sequenceId);
+        otherObjectArray->fromData(otherInput);
+
+        if (!deepArrayEquals(objectArray, otherObjectArray)) {
+          return false;
+        }
+        break;
+      }
+      case PdxFieldTypes::UNKNOWN: {
+        throw IllegalStateException(
+            "PdxInstance not found typeid " +
+            std::to_string(static_cast<int>(field->getTypeId())));
+      }
+      default: {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 bool PdxInstanceImpl::compareRawBytes(
     DataInput& input, DataInput& otherInput, PdxInstanceImpl& other,
     std::shared_ptr<PdxFieldType> field,
@@ -1350,13 +1442,9 @@ bool PdxInstanceImpl::compareRawBytes(
       return false;
     }
 
-    for (int i = pos; i < nextpos; i++) {
-      if (input.read() != otherInput.read()) {
-        return false;
-      }
-    }
-
-    return true;
+    return std::memcmp(input.currentBufferPosition(),
+                       otherInput.currentBufferPosition(),
+                       static_cast<size_t>(nextpos - pos)) == 0;
   } else {
     if (field->equals(DEFAULT_PDX_FIELD_TYPE)) {
       int otherPos = other.getOffset(otherInput, otherField->getSequenceId());
@@ -1534,14 +1622,9 @@ int PdxInstanceImpl::getRawHashCode(DataInput& input,
   }
 
   input.reset();
-  input.advanceCursor(nextpos - 1);
-
-  int h = 1;
-  for (int i = nextpos - 1; i >= pos; i--) {
-    h = 31 * h + static_cast<int>(input.read());
-    input.reset();
-    input.advanceCursor(i - 1);
-  }
+  auto h = java_hash_reverse(
+      1, reinterpret_cast<const int8_t*>(input.currentBufferPosition()) + pos,
+      static_cast<size_t>(nextpos - pos));
   LOGDEBUG("getRawHashCode nbytes = %d, final hashcode = %d ", (nextpos - pos),
            h);
   return h;
@@ -1588,14 +1671,8 @@ bool PdxInstanceImpl::compareDefaultBytes(DataInput& dataInput, int start,
   if ((end - start) != length) return false;
 
   dataInput.reset();
-  dataInput.advanceCursor(start);
-  int j = 0;
-  for (int i = start; i < end; i++) {
-    if (defaultBytes[j++] != dataInput.read()) {
-      return false;
-    }
-  }
-  return true;
+  return std::memcmp(dataInput.currentBufferPosition() + start, defaultBytes,
+                     static_cast<size_t>(length)) == 0;
 }
 
 bool PdxInstanceImpl::hasDefaultBytes(std::shared_ptr<PdxFieldType> pField,
@@ -1950,13 +2027,19 @@ void PdxInstanceImpl::setOffsetForObject(DataInput& input,
 }
 
 size_t PdxInstanceImpl::objectSize() const {
+  // the PdxType is shared with the type registry and not counted here
   auto size = sizeof(PdxInstanceImpl);
-  size += buffer_.size();
-  size += pdxType_->objectSize();
-  for (FieldVsValues::const_iterator iter = m_updatedFields.begin();
-       iter != m_updatedFields.end(); ++iter) {
-    size += iter->first.length();
-    size += iter->second->objectSize();
+  if (buffer_.capacity() > 0) {
+    size += MemoryAccounting::allocationSize(buffer_.capacity());
+  }
+  for (const auto& field : m_updatedFields) {
+    // tree node: three pointers and the color next to the value
+    size += MemoryAccounting::allocationSize(
+        4 * sizeof(void*) + sizeof(FieldVsValues::value_type));
+    size += field.first.capacity();
+    if (field.second) {
+      size += field.second->objectSize();
+    }
   }
   return size;
 }
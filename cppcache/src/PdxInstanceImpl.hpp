@@ -20,6 +20,7 @@
 #ifndef GEODE_PDXINSTANCEIMPL_H_
 #define GEODE_PDXINSTANCEIMPL_H_
 
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -222,6 +223,7 @@ class PdxInstanceImpl : public WritablePdxInstance {
  private:
   mutable std::vector<uint8_t> buffer_;
   mutable int32_t typeId_;
+  mutable std::atomic<int32_t> hashcode_;
 
   std::shared_ptr<PdxType> pdxType_;
   FieldVsValues m_updatedFields;
@@ -260,6 +262,8 @@ class PdxInstanceImpl : public WritablePdxInstance {
                        std::shared_ptr<PdxFieldType> field,
                        std::shared_ptr<PdxFieldType> otherField) const;
 
+  bool equalsSameType(const PdxInstanceImpl& other) const;
+
   void equatePdxFields(std::vector<std::shared_ptr<PdxFieldType>>& my,
                        std::vector<std::shared_ptr<PdxFieldType>>& other) const;
 
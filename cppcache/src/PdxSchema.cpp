@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PdxSchema.hpp>
+
+#include "PdxHelper.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+PdxSchemaWriter::PdxSchemaWriter(DataOutput& output, int32_t typeId)
+    : output_(output),
+      typeId_(typeId),
+      start_(output.getBufferLength()),
+      offsetCount_(0) {
+  // the header is written by end() once the length is known
+  output_.advanceCursor(PdxHelper::PdxHeader);
+}
+
+void PdxSchemaWriter::addOffset() {
+  auto offset = static_cast<int32_t>(output_.getBufferLength() - start_ -
+                                     PdxHelper::PdxHeader);
+  if (offsetCount_ < INLINE_OFFSETS) {
+    offsets_[offsetCount_] = offset;
+  } else {
+    moreOffsets_.push_back(offset);
+  }
+  ++offsetCount_;
+}
+
+int32_t PdxSchemaWriter::offset(size_t index) const {
+  return index < INLINE_OFFSETS ? offsets_[index]
+                                : moreOffsets_[index - INLINE_OFFSETS];
+}
+
+int32_t PdxSchemaWriter::end() {
+  // same layout as PdxLocalWriter::writePdxHeader, the first variable length
+  // field needs no offset
+  auto totalOffsets =
+      offsetCount_ > 0 ? static_cast<int32_t>(offsetCount_ - 1) : 0;
+  auto totalLen = static_cast<int32_t>(output_.getBufferLength() - start_ -
+                                       PdxHelper::PdxHeader) +
+                  totalOffsets;
+
+  int32_t len;
+  if (totalLen <= 0xff) {
+    len = totalLen;
+  } else if (totalLen + totalOffsets <= 0xffff) {
+    len = totalLen + totalOffsets;
+  } else {
+    len = totalLen + totalOffsets * 3;
+  }
+
+  auto header = const_cast<uint8_t*>(output_.getBuffer()) + start_;
+  PdxHelper::writeInt32(header, len);
+  PdxHelper::writeInt32(header + 4, typeId_);
+
+  for (auto i = offsetCount_; i-- > 1;) {
+    if (len <= 0xff) {
+      output_.write(static_cast<uint8_t>(offset(i)));
+    } else if (len <= 0xffff) {
+      output_.writeInt(static_cast<uint16_t>(offset(i)));
+    } else {
+      output_.writeInt(static_cast<uint32_t>(offset(i)));
+    }
+  }
+
+  return len;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -22,6 +22,7 @@
 #include <geode/PoolManager.hpp>
 
 #include "CacheImpl.hpp"
+#include "CachePerfStats.hpp"
 #include "CacheRegionHelper.hpp"
 #include "PreservedDataExpiryTask.hpp"
 #include "SerializationRegistry.hpp"
@@ -31,6 +32,70 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+// unique across registries, so a type id cached for one cache is never taken
+// for another cache's
+std::atomic<uint32_t> nextGeneration{1};
+
+// cache hits are added to the statistics with the next miss, or after this
+// many of them
+const int32_t TYPE_CACHE_HITS_BATCH = 1024;
+
+template <class Map>
+void eraseMissing(Map& types) {
+  for (auto it = types.begin(); it != types.end();) {
+    if (it->second == nullptr) {
+      it = types.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * Types a thread has looked up in a registry, including the ones it did not
+ * find. The registry only ever adds types until it is cleared, so the types
+ * found stay valid for the generation, while the misses are dropped whenever
+ * a type is added. Looking up types in another registry starts over.
+ */
+struct PdxTypeRegistry::ThreadTypeCache {
+  const PdxTypeRegistry* registry = nullptr;
+  uint32_t generation = 0;
+  uint64_t additions = 0;
+  int32_t hits = 0;
+  std::unordered_map<int32_t, std::shared_ptr<PdxType>> types;
+  std::unordered_map<int32_t, std::shared_ptr<PdxType>> mergedTypes;
+  std::unordered_map<std::string, std::shared_ptr<PdxType>> localTypes;
+
+  template <class Map, class Key, class Find>
+  std::shared_ptr<PdxType> lookup(Map& cached, const Key& key,
+                                  CachePerfStats* stats, Find find) {
+    auto&& found = cached.find(key);
+    if (found != cached.end()) {
+      if (++hits == TYPE_CACHE_HITS_BATCH) {
+        if (stats) {
+          stats->incPdxTypeCacheHits(hits);
+        }
+        hits = 0;
+      }
+      return found->second;
+    }
+
+    if (stats) {
+      stats->incPdxTypeCacheHits(hits);
+      stats->incPdxTypeCacheMisses();
+    }
+    hits = 0;
+
+    auto type = find();
+    cached.emplace(key, type);
+    return type;
+  }
+};
+
 PdxTypeRegistry::PdxTypeRegistry(CacheImpl* cache)
     : cache_(cache),
       typeIdToPdxType_(),
@@ -38,7 +103,10 @@ PdxTypeRegistry::PdxTypeRegistry(CacheImpl* cache)
       localTypeToPdxType_(),
       pdxTypeToTypeIdMap_(),
       enumToInt_(CacheableHashMap::create()),
-      intToEnum_(CacheableHashMap::create()) {}
+      intToEnum_(CacheableHashMap::create()),
+      generation_(nextGeneration++),
+      additions_(0),
+      stats_(nullptr) {}
 
 PdxTypeRegistry::~PdxTypeRegistry() {}
 
@@ -46,6 +114,47 @@ size_t PdxTypeRegistry::testNumberOfPreservedData() const {
   return preserved_data_.size();
 }
 
+void PdxTypeRegistry::setCachePerfStats(CachePerfStats* stats) {
+  stats_ = stats;
+}
+
+PdxTypeRegistry::ThreadTypeCache& PdxTypeRegistry::threadTypeCache() const {
+  static thread_local ThreadTypeCache cache;
+
+  // read before the registry so that anything changed during the lookup
+  // empties the cache again on the next one
+  auto generation = generation_.load(std::memory_order_acquire);
+  auto additions = additions_.load(std::memory_order_acquire);
+
+  if (cache.registry != this || cache.generation != generation) {
+    size_t typeCount;
+    {
+      boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
+      typeCount = typeIdToPdxType_.size();
+    }
+    cache.types.clear();
+    cache.mergedTypes.clear();
+    cache.localTypes.clear();
+    cache.types.reserve(typeCount);
+    cache.localTypes.reserve(typeCount);
+    cache.registry = this;
+    cache.generation = generation;
+    cache.additions = additions;
+    cache.hits = 0;
+  } else if (cache.additions != additions) {
+    eraseMissing(cache.types);
+    eraseMissing(cache.mergedTypes);
+    eraseMissing(cache.localTypes);
+    cache.additions = additions;
+  }
+
+  return cache;
+}
+
+void PdxTypeRegistry::typesAdded() {
+  additions_.fetch_add(1, std::memory_order_release);
+}
+
 int32_t PdxTypeRegistry::getPDXIdForType(const std::string& type, Pool* pool,
                                          std::shared_ptr<PdxType> nType,
                                          bool checkIfThere) {
@@ -68,6 +177,14 @@ int32_t PdxTypeRegistry::getPDXIdForType(const std::string& type, Pool* pool,
 
 int32_t PdxTypeRegistry::getPDXIdForType(std::shared_ptr<PdxType> nType,
                                          Pool* pool) {
+  return registerPdxType(nType, [&] {
+    return cache_->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+  });
+}
+
+int32_t PdxTypeRegistry::registerPdxType(
+    std::shared_ptr<PdxType> nType,
+    const std::function<int32_t()>& fetchTypeId) {
   int32_t typeId = 0;
   {
     boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
@@ -90,10 +207,11 @@ int32_t PdxTypeRegistry::getPDXIdForType(std::shared_ptr<PdxType> nType,
       }
     }
 
-    typeId = cache_->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+    typeId = fetchTypeId();
     nType->setTypeId(typeId);
     pdxTypeToTypeIdMap_.emplace(nType, typeId);
     typeIdToPdxType_.emplace(typeId, nType);
+    typesAdded();
   }
   return typeId;
 }
@@ -112,6 +230,8 @@ void PdxTypeRegistry::clear() {
     if (enumToInt_) enumToInt_->clear();
 
     pdxTypeToTypeIdMap_.clear();
+
+    generation_.store(nextGeneration++, std::memory_order_release);
   }
   {
     boost::unique_lock<decltype(preserved_data_mutex_)> guard{
@@ -124,46 +244,62 @@ void PdxTypeRegistry::addPdxType(int32_t typeId,
                                  std::shared_ptr<PdxType> pdxType) {
   boost::unique_lock<decltype(types_mutex_)> guard{types_mutex_};
   typeIdToPdxType_.emplace(typeId, pdxType);
+  typesAdded();
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getPdxType(int32_t typeId) const {
-  boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
-  auto&& iter = typeIdToPdxType_.find(typeId);
-  if (iter != typeIdToPdxType_.end()) {
-    return iter->second;
-  }
-  return nullptr;
+  auto find = [&]() -> std::shared_ptr<PdxType> {
+    boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
+    auto&& iter = typeIdToPdxType_.find(typeId);
+    if (iter != typeIdToPdxType_.end()) {
+      return iter->second;
+    }
+    return nullptr;
+  };
+  auto& cache = threadTypeCache();
+  return cache.lookup(cache.types, typeId, stats_.load(), find);
 }
 
 void PdxTypeRegistry::addLocalPdxType(const std::string& localType,
                                       std::shared_ptr<PdxType> pdxType) {
   boost::unique_lock<decltype(types_mutex_)> guard{types_mutex_};
   localTypeToPdxType_.emplace(localType, pdxType);
+  typesAdded();
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getLocalPdxType(
     const std::string& localType) const {
-  boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
-  auto&& it = localTypeToPdxType_.find(localType);
-  if (it != localTypeToPdxType_.end()) {
-    return it->second;
-  }
-  return nullptr;
+  auto find = [&]() -> std::shared_ptr<PdxType> {
+    boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
+    auto&& it = localTypeToPdxType_.find(localType);
+    if (it != localTypeToPdxType_.end()) {
+      return it->second;
+    }
+    return nullptr;
+  };
+  auto& cache = threadTypeCache();
+  return cache.lookup(cache.localTypes, localType, stats_.load(), find);
 }
 
 void PdxTypeRegistry::setMergedType(int32_t remoteTypeId,
                                     std::shared_ptr<PdxType> mergedType) {
   boost::unique_lock<decltype(types_mutex_)> guard{types_mutex_};
   remoteTypeIdToMergedPdxType_.emplace(remoteTypeId, mergedType);
+  typesAdded();
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getMergedType(
     int32_t remoteTypeId) const {
-  auto&& it = remoteTypeIdToMergedPdxType_.find(remoteTypeId);
-  if (it != remoteTypeIdToMergedPdxType_.end()) {
-    return it->second;
-  }
-  return nullptr;
+  auto find = [&]() -> std::shared_ptr<PdxType> {
+    boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
+    auto&& it = remoteTypeIdToMergedPdxType_.find(remoteTypeId);
+    if (it != remoteTypeIdToMergedPdxType_.end()) {
+      return it->second;
+    }
+    return nullptr;
+  };
+  auto& cache = threadTypeCache();
+  return cache.lookup(cache.mergedTypes, remoteTypeId, stats_.load(), find);
 }
 
 void PdxTypeRegistry::setPreserveData(
@@ -20,6 +20,8 @@
 #ifndef GEODE_PDXTYPEREGISTRY_H_
 #define GEODE_PDXTYPEREGISTRY_H_
 
+#include <atomic>
+#include <functional>
 #include <map>
 #include <unordered_map>
 
@@ -38,6 +40,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class CachePerfStats;
+
 typedef std::map<int32_t, std::shared_ptr<PdxType>> TypeIdVsPdxType;
 typedef std::map<std::string, std::shared_ptr<PdxType>> TypeNameVsPdxType;
 typedef std::unordered_map<std::shared_ptr<PdxSerializable>,
@@ -81,6 +85,22 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   std::shared_ptr<CacheableHashMap> intToEnum_;
 
+  std::atomic<uint32_t> generation_;
+
+  std::atomic<uint64_t> additions_;
+
+  std::atomic<CachePerfStats*> stats_;
+
+  struct ThreadTypeCache;
+
+  /**
+   * Returns the calling thread's cache of types looked up in this registry,
+   * emptied of anything the registry may have changed since.
+   */
+  ThreadTypeCache& threadTypeCache() const;
+
+  void typesAdded();
+
  public:
   explicit PdxTypeRegistry(CacheImpl* cache);
   PdxTypeRegistry(const PdxTypeRegistry& other) = delete;
@@ -90,6 +110,8 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
   // test hook
   size_t testNumberOfPreservedData() const;
 
+  void setCachePerfStats(CachePerfStats* stats);
+
   void addPdxType(int32_t typeId, std::shared_ptr<PdxType> pdxType);
 
   std::shared_ptr<PdxType> getPdxType(int32_t typeId) const;
@@ -113,6 +135,14 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   void clear();
 
+  /**
+   * Identifies this registry and its contents; changes whenever the types
+   * are cleared, so type ids cached outside the registry can be validated.
+   */
+  uint32_t getGeneration() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+
   int32_t getPDXIdForType(const std::string& type, Pool* pool,
                           std::shared_ptr<PdxType> nType, bool checkIfThere);
 
@@ -137,6 +167,13 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
   }
 
  protected:
+  /**
+   * Returns the id of nType, fetching it with fetchTypeId and adding the type
+   * when it is not registered yet.
+   */
+  int32_t registerPdxType(std::shared_ptr<PdxType> nType,
+                          const std::function<int32_t()>& fetchTypeId);
+
   friend class PreservedDataExpiryTask;
 
   PreservedHashMap& preserved_data_map() { return preserved_data_; }
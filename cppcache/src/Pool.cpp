@@ -68,6 +68,10 @@ std::chrono::milliseconds Pool::getUpdateLocatorListInterval() const {
   return m_attrs->getUpdateLocatorListInterval();
 }
 
+std::chrono::milliseconds Pool::getServerSnapshotInterval() const {
+  return m_attrs->getServerSnapshotInterval();
+}
+
 std::chrono::milliseconds Pool::getStatisticInterval() const {
   return m_attrs->getStatisticInterval();
 }
@@ -129,6 +133,18 @@ bool Pool::getPRSingleHopEnabled() const {
   return m_attrs->getPRSingleHopEnabled();
 }
 
+bool Pool::getAdaptiveSizingEnabled() const {
+  return m_attrs->getAdaptiveSizingEnabled();
+}
+
+int Pool::getPrefillParallelism() const {
+  return m_attrs->getPrefillParallelism();
+}
+
+std::chrono::milliseconds Pool::getPrefillTimeout() const {
+  return m_attrs->getPrefillTimeout();
+}
+
 int Pool::getPendingEventCount() const {
   const auto poolHADM = dynamic_cast<const ThinClientPoolHADM*>(this);
   if (nullptr == poolHADM || poolHADM->isReadyForEvent()) {
@@ -41,9 +41,13 @@ PoolAttributes::PoolAttributes()
       m_pingInterval(PoolFactory::DEFAULT_PING_INTERVAL),
       m_updateLocatorListInterval(
           PoolFactory::DEFAULT_UPDATE_LOCATOR_LIST_INTERVAL),
+      m_serverSnapshotInterval(PoolFactory::DEFAULT_SERVER_SNAPSHOT_INTERVAL),
       m_subsEnabled(PoolFactory::DEFAULT_SUBSCRIPTION_ENABLED),
       m_multiuserSecurityMode(PoolFactory::DEFAULT_MULTIUSER_SECURE_MODE),
       m_isPRSingleHopEnabled(PoolFactory::DEFAULT_PR_SINGLE_HOP_ENABLED),
+      m_adaptiveSizingEnabled(PoolFactory::DEFAULT_ADAPTIVE_SIZING_ENABLED),
+      m_prefillParallelism(PoolFactory::DEFAULT_PREFILL_PARALLELISM),
+      m_prefillTimeout(PoolFactory::DEFAULT_PREFILL_TIMEOUT),
       m_serverGrp(PoolFactory::DEFAULT_SERVER_GROUP),
       m_sniProxyPort(0) {}
 
@@ -112,6 +112,15 @@ class PoolAttributes {
     m_updateLocatorListInterval = updateLocatorListInterval;
   }
 
+  const std::chrono::milliseconds& getServerSnapshotInterval() const {
+    return m_serverSnapshotInterval;
+  }
+
+  void setServerSnapshotInterval(
+      const std::chrono::milliseconds& serverSnapshotInterval) {
+    m_serverSnapshotInterval = serverSnapshotInterval;
+  }
+
   const std::chrono::milliseconds& getStatisticInterval() const {
     return m_statsInterval;
   }
@@ -164,6 +173,26 @@ class PoolAttributes {
 
   void setPRSingleHopEnabled(bool enabled) { m_isPRSingleHopEnabled = enabled; }
 
+  bool getAdaptiveSizingEnabled() const { return m_adaptiveSizingEnabled; }
+
+  void setAdaptiveSizingEnabled(bool enabled) {
+    m_adaptiveSizingEnabled = enabled;
+  }
+
+  int getPrefillParallelism() const { return m_prefillParallelism; }
+
+  void setPrefillParallelism(int parallelism) {
+    m_prefillParallelism = parallelism;
+  }
+
+  const std::chrono::milliseconds& getPrefillTimeout() const {
+    return m_prefillTimeout;
+  }
+
+  void setPrefillTimeout(const std::chrono::milliseconds& timeout) {
+    m_prefillTimeout = timeout;
+  }
+
   bool getMultiuserSecureModeEnabled() const { return m_multiuserSecurityMode; }
 
   void setMultiuserSecureModeEnabled(bool multiuserSecureMode) {
@@ -193,10 +222,14 @@ class PoolAttributes {
   std::chrono::milliseconds m_idleTimeout;
   std::chrono::milliseconds m_pingInterval;
   std::chrono::milliseconds m_updateLocatorListInterval;
+  std::chrono::milliseconds m_serverSnapshotInterval;
 
   bool m_subsEnabled;
   bool m_multiuserSecurityMode;
   bool m_isPRSingleHopEnabled;
+  bool m_adaptiveSizingEnabled;
+  int m_prefillParallelism;
+  std::chrono::milliseconds m_prefillTimeout;
 
   std::string m_serverGrp;
   std::vector<std::string> m_initLocList;
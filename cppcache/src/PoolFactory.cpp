@@ -50,6 +50,14 @@ const std::chrono::milliseconds PoolFactory::DEFAULT_PING_INTERVAL =
 const std::chrono::milliseconds
     PoolFactory::DEFAULT_UPDATE_LOCATOR_LIST_INTERVAL = std::chrono::seconds{5};
 
+constexpr int PoolFactory::DEFAULT_PREFILL_PARALLELISM;
+
+const std::chrono::milliseconds PoolFactory::DEFAULT_PREFILL_TIMEOUT =
+    std::chrono::milliseconds::zero();
+
+const std::chrono::milliseconds PoolFactory::DEFAULT_SERVER_SNAPSHOT_INTERVAL =
+    std::chrono::milliseconds::zero();
+
 const std::chrono::milliseconds PoolFactory::DEFAULT_STATISTIC_INTERVAL =
     std::chrono::milliseconds::zero();
 
@@ -155,6 +163,16 @@ PoolFactory& PoolFactory::setUpdateLocatorListInterval(
   return *this;
 }
 
+PoolFactory& PoolFactory::setServerSnapshotInterval(
+    const std::chrono::milliseconds serverSnapshotInterval) {
+  if (serverSnapshotInterval < std::chrono::milliseconds::zero()) {
+    throw IllegalArgumentException("timeout must be positive.");
+  }
+
+  m_attrs->setServerSnapshotInterval(serverSnapshotInterval);
+  return *this;
+}
+
 PoolFactory& PoolFactory::setStatisticInterval(
     std::chrono::milliseconds statisticInterval) {
   if (statisticInterval < std::chrono::milliseconds::zero()) {
@@ -235,6 +253,31 @@ PoolFactory& PoolFactory::setPRSingleHopEnabled(bool enabled) {
   m_attrs->setPRSingleHopEnabled(enabled);
   return *this;
 }
+
+PoolFactory& PoolFactory::setAdaptiveSizingEnabled(bool enabled) {
+  m_attrs->setAdaptiveSizingEnabled(enabled);
+  return *this;
+}
+
+PoolFactory& PoolFactory::setPrefillParallelism(int parallelism) {
+  if (parallelism < 1) {
+    throw IllegalArgumentException("parallelism must be at least 1.");
+  }
+
+  m_attrs->setPrefillParallelism(parallelism);
+  return *this;
+}
+
+PoolFactory& PoolFactory::setPrefillTimeout(
+    std::chrono::milliseconds timeout) {
+  if (timeout < std::chrono::milliseconds::zero()) {
+    throw IllegalArgumentException("timeout must be positive.");
+  }
+
+  m_attrs->setPrefillTimeout(timeout);
+  return *this;
+}
+
 std::shared_ptr<Pool> PoolFactory::create(std::string name) {
   std::shared_ptr<ThinClientPoolDM> poolDM;
 
@@ -31,7 +31,7 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
-    std::vector<std::shared_ptr<StatisticDescriptor>> stats(27);
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats(38);
 
     stats[0] = factory->createIntGauge(
         "locators", "Current number of locators discovered", "locators");
@@ -120,6 +120,50 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[26] = factory->createLongCounter(
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
+    stats[27] = factory->createIntGauge(
+        "adaptiveTargetConnections",
+        "Number of connections the adaptive sizer last aimed for",
+        "connections");
+    stats[28] = factory->createIntCounter(
+        "adaptiveConnects",
+        "Total number of connects done by adaptive sizing.", "connects");
+    stats[29] = factory->createIntCounter(
+        "adaptiveDisconnects",
+        "Total number of disconnects done by adaptive sizing.", "disconnects");
+    stats[30] = factory->createIntCounter(
+        "sslHandshakes", "Total number of TLS handshakes completed.",
+        "handshakes");
+    stats[31] = factory->createIntCounter(
+        "sslHandshakesResumed",
+        "Total number of TLS handshakes that resumed a cached session.",
+        "handshakes");
+    stats[32] = factory->createLongCounter(
+        "sslHandshakeTime", "Total time spent in TLS handshakes",
+        "nanoseconds");
+    stats[33] = factory->createLongGauge(
+        "timeToReady",
+        "Time from pool start until it first held its minimum connections",
+        "nanoseconds");
+    stats[34] = factory->createLongCounter(
+        "interestKeysRecovered",
+        "Total number of interest keys registered again after subscription "
+        "failover.",
+        "keys");
+    stats[35] = factory->createIntCounter(
+        "interestRecoveryBatches",
+        "Total number of key batches registered again after subscription "
+        "failover.",
+        "batches");
+    stats[36] = factory->createLongCounter(
+        "interestRecoveryTime",
+        "Total time spent registering interest keys again after subscription "
+        "failover",
+        "nanoseconds");
+    stats[37] = factory->createLongCounter(
+        "clientEventsConflated",
+        "Total number of subscription events replaced by a newer event for "
+        "the same key before they were applied",
+        "events");
 
     statsType = factory->createType(STATS_NAME, STATS_DESC, std::move(stats));
   }
@@ -151,6 +195,17 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
       statsType->nameToId("processedDeltaMessagesTime");
   m_queryExecutionsId = statsType->nameToId("queryExecutions");
   m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+  m_adaptiveTargetConnsId = statsType->nameToId("adaptiveTargetConnections");
+  m_adaptiveConnectsId = statsType->nameToId("adaptiveConnects");
+  m_adaptiveDisconnectsId = statsType->nameToId("adaptiveDisconnects");
+  m_sslHandshakesId = statsType->nameToId("sslHandshakes");
+  m_sslHandshakesResumedId = statsType->nameToId("sslHandshakesResumed");
+  m_sslHandshakeTimeId = statsType->nameToId("sslHandshakeTime");
+  m_timeToReadyId = statsType->nameToId("timeToReady");
+  m_interestKeysRecoveredId = statsType->nameToId("interestKeysRecovered");
+  m_interestRecoveryBatchesId = statsType->nameToId("interestRecoveryBatches");
+  m_interestRecoveryTimeId = statsType->nameToId("interestRecoveryTime");
+  m_clientEventsConflatedId = statsType->nameToId("clientEventsConflated");
 
   m_poolStats = factory->createAtomicStatistics(statsType, poolName.c_str());
 
@@ -181,6 +236,17 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+  getStats()->setInt(m_adaptiveTargetConnsId, 0);
+  getStats()->setInt(m_adaptiveConnectsId, 0);
+  getStats()->setInt(m_adaptiveDisconnectsId, 0);
+  getStats()->setInt(m_sslHandshakesId, 0);
+  getStats()->setInt(m_sslHandshakesResumedId, 0);
+  getStats()->setLong(m_sslHandshakeTimeId, 0);
+  getStats()->setLong(m_timeToReadyId, 0);
+  getStats()->setLong(m_interestKeysRecoveredId, 0);
+  getStats()->setInt(m_interestRecoveryBatchesId, 0);
+  getStats()->setLong(m_interestRecoveryTimeId, 0);
+  getStats()->setLong(m_clientEventsConflatedId, 0);
 }
 
 PoolStats::~PoolStats() {
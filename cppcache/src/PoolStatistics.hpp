@@ -19,6 +19,7 @@
 #ifndef GEODE_POOLSTATISTICS_H_
 #define GEODE_POOLSTATISTICS_H_
 
+#include <chrono>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
@@ -130,6 +131,36 @@ class PoolStats {
   void incQueryExecutionTimeId(int64_t value) {  // counter
     getStats()->incLong(m_queryExecutionTimeId, value);
   }
+  void setAdaptiveTargetConnections(int32_t curVal) {
+    getStats()->setInt(m_adaptiveTargetConnsId, curVal);
+  }
+  void incAdaptiveConnects(int32_t numConn) {  // counter
+    getStats()->incInt(m_adaptiveConnectsId, numConn);
+  }
+  void incAdaptiveDisconnects(int32_t numConn) {  // counter
+    getStats()->incInt(m_adaptiveDisconnectsId, numConn);
+  }
+  void incSslHandshakes(bool resumed, std::chrono::nanoseconds time) {
+    getStats()->incInt(m_sslHandshakesId, 1);
+    if (resumed) {
+      getStats()->incInt(m_sslHandshakesResumedId, 1);
+    }
+    getStats()->incLong(m_sslHandshakeTimeId, time.count());
+  }
+  void setTimeToReady(std::chrono::nanoseconds time) {
+    getStats()->setLong(m_timeToReadyId, time.count());
+  }
+  std::chrono::nanoseconds getTimeToReady() const {
+    return std::chrono::nanoseconds(m_poolStats->getLong(m_timeToReadyId));
+  }
+  void incInterestRecoveryBatches(size_t keys, std::chrono::nanoseconds time) {
+    getStats()->incLong(m_interestKeysRecoveredId, static_cast<int64_t>(keys));
+    getStats()->incInt(m_interestRecoveryBatchesId, 1);
+    getStats()->incLong(m_interestRecoveryTimeId, time.count());
+  }
+  void incClientEventsConflated() {
+    getStats()->incLong(m_clientEventsConflatedId, 1);
+  }
   inline apache::geode::statistics::Statistics* getStats() {
     return m_poolStats;
   }
@@ -170,6 +201,17 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_adaptiveTargetConnsId;
+  int32_t m_adaptiveConnectsId;
+  int32_t m_adaptiveDisconnectsId;
+  int32_t m_sslHandshakesId;
+  int32_t m_sslHandshakesResumedId;
+  int32_t m_sslHandshakeTimeId;
+  int32_t m_timeToReadyId;
+  int32_t m_interestKeysRecoveredId;
+  int32_t m_interestRecoveryBatchesId;
+  int32_t m_interestRecoveryTimeId;
+  int32_t m_clientEventsConflatedId;
 
   static constexpr const char* STATS_NAME = "PoolStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this pool";
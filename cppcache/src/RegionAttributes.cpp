@@ -55,7 +55,8 @@ RegionAttributes::RegionAttributes()
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_isLruAdmissionEnabled(false) {}
 
 RegionAttributes::~RegionAttributes() noexcept = default;
 
@@ -307,6 +308,7 @@ void RegionAttributes::toData(DataOutput& out) const {
   out.writeObject(m_persistenceProperties);
   apache::geode::client::impl::writeString(out, m_poolName);
   apache::geode::client::impl::writeBool(out, m_isConcurrencyChecksEnabled);
+  apache::geode::client::impl::writeBool(out, m_isLruAdmissionEnabled);
 }
 
 void RegionAttributes::fromData(DataInput& in) {
@@ -348,6 +350,7 @@ void RegionAttributes::fromData(DataInput& in) {
       std::dynamic_pointer_cast<Properties>(in.readObject());
   apache::geode::client::impl::readString(in, m_poolName);
   apache::geode::client::impl::readBool(in, &m_isConcurrencyChecksEnabled);
+  apache::geode::client::impl::readBool(in, &m_isLruAdmissionEnabled);
 }
 
 /** Return true if all the attributes are equal to those of other. */
@@ -422,6 +425,9 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_isConcurrencyChecksEnabled != other.m_isConcurrencyChecksEnabled) {
     return false;
   }
+  if (m_isLruAdmissionEnabled != other.m_isLruAdmissionEnabled) {
+    return false;
+  }
 
   return true;
 }
@@ -518,6 +524,10 @@ void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
 
+void RegionAttributes::setLruAdmissionEnabled(bool enable) {
+  m_isLruAdmissionEnabled = enable;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -232,6 +232,12 @@ RegionAttributesFactory& RegionAttributesFactory::setConcurrencyChecksEnabled(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setLruAdmissionEnabled(
+    bool enable) {
+  m_regionAttributes.setLruAdmissionEnabled(enable);
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
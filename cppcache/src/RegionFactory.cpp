@@ -170,6 +170,10 @@ RegionFactory& RegionFactory::setConcurrencyChecksEnabled(bool enable) {
   m_regionAttributesFactory->setConcurrencyChecksEnabled(enable);
   return *this;
 }
+RegionFactory& RegionFactory::setLruAdmissionEnabled(bool enable) {
+  m_regionAttributesFactory->setLruAdmissionEnabled(enable);
+  return *this;
+}
 RegionFactory& RegionFactory::setLruEntriesLimit(const uint32_t entriesLimit) {
   m_regionAttributesFactory->setLruEntriesLimit(entriesLimit);
   return *this;
@@ -252,7 +252,8 @@ class RegionInternal : public Region {
   virtual RegionStats* getRegionStats() = 0;
   virtual bool cacheEnabled() = 0;
   bool isDestroyed() const override = 0;
-  virtual void evict(float percentage) = 0;
+  /** Evicts the given fraction of the entries, returns the number evicted. */
+  virtual int32_t evict(float percentage) = 0;
   virtual CacheImpl* getCacheImpl() const = 0;
   virtual std::shared_ptr<TombstoneList> getTombstoneList();
 
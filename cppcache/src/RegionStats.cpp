@@ -32,7 +32,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    std::vector<std::shared_ptr<StatisticDescriptor>> stats(25);
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats(32);
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -127,6 +127,38 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
+    stats[25] = factory->createIntCounter(
+        "coalescedGets",
+        "The total number of cache misses for this region that shared "
+        "another get's server request",
+        "entries", largerIsBetter);
+    stats[26] = factory->createIntCounter(
+        "lruAdmissionRejects",
+        "The total number of new entries evicted in favor of more frequently "
+        "used entries for this region",
+        "entries", !largerIsBetter);
+    stats[27] = factory->createDoubleGauge(
+        "hitRatio", "The ratio of hits to gets for this region", "ratio",
+        largerIsBetter);
+    stats[28] = factory->createIntCounter(
+        "deltaUpdates",
+        "The total number of notification deltas applied to this region",
+        "entries", largerIsBetter);
+    stats[29] = factory->createIntCounter(
+        "deltaUpdatesInPlace",
+        "The total number of notification deltas applied to this region "
+        "without copying the cached value",
+        "entries", largerIsBetter);
+    stats[30] = factory->createIntCounter(
+        "deltaFullValueRequests",
+        "The total number of full values requested from the server because a "
+        "notification delta could not be applied to this region",
+        "entries", !largerIsBetter);
+    stats[31] = factory->createLongCounter(
+        "deltaBytesSaved",
+        "Estimated bytes of values not sent to this region because they were "
+        "updated by deltas",
+        "bytes", largerIsBetter);
     statsType = factory->createType(STATS_NAME, STATS_DESC, std::move(stats));
   }
 
@@ -156,6 +188,13 @@ RegionStats::RegionStats(StatisticsFactory* factory,
       statsType->nameToId("cacheListenerCallsCompleted");
   m_ListenerCallTimeId = statsType->nameToId("cacheListenerCallTime");
   m_clearsId = statsType->nameToId("clears");
+  m_coalescedGetsId = statsType->nameToId("coalescedGets");
+  m_lruAdmissionRejectsId = statsType->nameToId("lruAdmissionRejects");
+  m_hitRatioId = statsType->nameToId("hitRatio");
+  m_deltaUpdatesId = statsType->nameToId("deltaUpdates");
+  m_deltaUpdatesInPlaceId = statsType->nameToId("deltaUpdatesInPlace");
+  m_deltaFullValueRequestsId = statsType->nameToId("deltaFullValueRequests");
+  m_deltaBytesSavedId = statsType->nameToId("deltaBytesSaved");
 
   m_regionStats = factory->createAtomicStatistics(
       statsType, const_cast<char*>(regionName.c_str()));
@@ -185,6 +224,22 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+  m_regionStats->setInt(m_coalescedGetsId, 0);
+  m_regionStats->setInt(m_lruAdmissionRejectsId, 0);
+  m_regionStats->setInt(m_deltaUpdatesId, 0);
+  m_regionStats->setInt(m_deltaUpdatesInPlaceId, 0);
+  m_regionStats->setInt(m_deltaFullValueRequestsId, 0);
+  m_regionStats->setLong(m_deltaBytesSavedId, 0);
+
+  // computed when sampled rather than on every hit or miss
+  auto stats = m_regionStats;
+  auto hitsId = m_hitsId;
+  auto missesId = m_missesId;
+  m_regionStats->setDoubleSupplier(m_hitRatioId, [stats, hitsId, missesId] {
+    auto hits = static_cast<double>(stats->getInt(hitsId));
+    auto gets = hits + static_cast<double>(stats->getInt(missesId));
+    return gets > 0 ? hits / gets : 0.0;
+  });
 }
 
 RegionStats::~RegionStats() {
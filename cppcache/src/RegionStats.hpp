@@ -64,6 +64,27 @@ class RegionStats {
 
   inline void incMisses() { m_regionStats->incInt(m_missesId, 1); }
 
+  inline void incCoalescedGets() {
+    m_regionStats->incInt(m_coalescedGetsId, 1);
+  }
+
+  inline void incLruAdmissionRejects() {
+    m_regionStats->incInt(m_lruAdmissionRejectsId, 1);
+  }
+
+  inline void incDeltaUpdates(bool inPlace, size_t bytesSaved) {
+    m_regionStats->incInt(m_deltaUpdatesId, 1);
+    if (inPlace) {
+      m_regionStats->incInt(m_deltaUpdatesInPlaceId, 1);
+    }
+    m_regionStats->incLong(m_deltaBytesSavedId,
+                           static_cast<int64_t>(bytesSaved));
+  }
+
+  inline void incDeltaFullValueRequests() {
+    m_regionStats->incInt(m_deltaFullValueRequestsId, 1);
+  }
+
   inline void incOverflows() { m_regionStats->incInt(m_overflowsId, 1); }
 
   inline void incRetrieves() { m_regionStats->incInt(m_retrievesId, 1); }
@@ -142,6 +163,13 @@ class RegionStats {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_coalescedGetsId;
+  int32_t m_lruAdmissionRejectsId;
+  int32_t m_hitRatioId;
+  int32_t m_deltaUpdatesId;
+  int32_t m_deltaUpdatesInPlaceId;
+  int32_t m_deltaFullValueRequestsId;
+  int32_t m_deltaBytesSavedId;
 
   static constexpr const char* STATS_NAME = "RegionStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this region";
@@ -265,6 +265,11 @@ RemoteQueryService::getCqServiceStatistics() const {
 }
 
 void RemoteQueryService::receiveNotification(TcrMessage& msg) {
+  receiveNotifications(std::vector<TcrMessage*>{&msg});
+}
+
+void RemoteQueryService::receiveNotifications(
+    const std::vector<TcrMessage*>& msgs) {
   {
     boost::shared_lock<decltype(mutex_)> guard{mutex_};
     if (m_invalid || !m_cqService || !m_cqService->checkAndAcquireLock()) {
@@ -272,7 +277,12 @@ void RemoteQueryService::receiveNotification(TcrMessage& msg) {
     }
   }
 
-  m_cqService->receiveNotification(msg);
+  m_cqService->receiveNotifications(msgs);
+}
+
+bool RemoteQueryService::hasCqBatchListener(const TcrMessage& msg) {
+  boost::shared_lock<decltype(mutex_)> guard{mutex_};
+  return !m_invalid && m_cqService && m_cqService->hasBatchListener(msg);
 }
 
 std::shared_ptr<CacheableArrayList>
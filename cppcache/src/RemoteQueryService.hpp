@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/thread/shared_mutex.hpp>
 
@@ -88,6 +89,8 @@ class RemoteQueryService
    */
   GfErrType executeAllCqs(TcrEndpoint* endpoint);
   void receiveNotification(TcrMessage& msg);
+  void receiveNotifications(const std::vector<TcrMessage*>& msgs);
+  bool hasCqBatchListener(const TcrMessage& msg);
   void invokeCqConnectedListeners(ThinClientPoolDM* pool, bool connected);
   // For Lazy Cq Start-no use, no start
   inline void initCqService() {
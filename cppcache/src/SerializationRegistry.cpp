@@ -39,6 +39,7 @@
 #include "CacheableToken.hpp"
 #include "ClientConnectionResponse.hpp"
 #include "ClientProxyMembershipID.hpp"
+#include "DeserializationArena.hpp"
 #include "DiskStoreId.hpp"
 #include "EnumInfo.hpp"
 #include "EventId.hpp"
@@ -54,6 +55,101 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+template <class T, class... Args>
+std::shared_ptr<Serializable> makeInArena(DeserializationArena& arena,
+                                          DataInput& input, Args&&... args) {
+  auto obj = arena.make<T>(std::forward<Args>(args)...);
+  obj->fromData(input);
+  return std::move(obj);
+}
+
+/**
+ * Only built-in leaf types are placed in an arena. Containers hold
+ * shared_ptrs to their elements, which would keep the arena alive.
+ */
+std::shared_ptr<Serializable> deserializeInArena(DeserializationArena& arena,
+                                                 DataInput& input,
+                                                 DSCode dsCode) {
+  switch (dsCode) {
+    case DSCode::CacheableASCIIString:
+    case DSCode::CacheableASCIIStringHuge:
+    case DSCode::CacheableString:
+    case DSCode::CacheableStringHuge:
+      return makeInArena<CacheableString>(arena, input, dsCode);
+    case DSCode::CacheableBoolean:
+      return makeInArena<CacheableBoolean>(arena, input);
+    case DSCode::CacheableByte:
+      return makeInArena<CacheableByte>(arena, input);
+    case DSCode::CacheableCharacter:
+      return makeInArena<CacheableCharacter>(arena, input);
+    case DSCode::CacheableInt16:
+      return makeInArena<CacheableInt16>(arena, input);
+    case DSCode::CacheableInt32:
+      return makeInArena<CacheableInt32>(arena, input);
+    case DSCode::CacheableInt64:
+      return makeInArena<CacheableInt64>(arena, input);
+    case DSCode::CacheableFloat:
+      return makeInArena<CacheableFloat>(arena, input);
+    case DSCode::CacheableDouble:
+      return makeInArena<CacheableDouble>(arena, input);
+    case DSCode::CacheableDate:
+      return makeInArena<CacheableDate>(arena, input);
+    case DSCode::CacheableBytes:
+      return makeInArena<CacheableBytes>(arena, input);
+    case DSCode::BooleanArray:
+      return makeInArena<BooleanArray>(arena, input);
+    case DSCode::CharArray:
+      return makeInArena<CharArray>(arena, input);
+    case DSCode::CacheableInt16Array:
+      return makeInArena<CacheableInt16Array>(arena, input);
+    case DSCode::CacheableInt32Array:
+      return makeInArena<CacheableInt32Array>(arena, input);
+    case DSCode::CacheableInt64Array:
+      return makeInArena<CacheableInt64Array>(arena, input);
+    case DSCode::CacheableFloatArray:
+      return makeInArena<CacheableFloatArray>(arena, input);
+    case DSCode::CacheableDoubleArray:
+      return makeInArena<CacheableDoubleArray>(arena, input);
+    case DSCode::FixedIDDefault:
+    case DSCode::FixedIDByte:
+    case DSCode::FixedIDInt:
+    case DSCode::FixedIDNone:
+    case DSCode::FixedIDShort:
+    case DSCode::CacheableLinkedList:
+    case DSCode::Properties:
+    case DSCode::PdxType:
+    case DSCode::CacheableUserData:
+    case DSCode::CacheableUserData2:
+    case DSCode::CacheableUserData4:
+    case DSCode::NullObj:
+    case DSCode::Class:
+    case DSCode::JavaSerializable:
+    case DSCode::DataSerializable:
+    case DSCode::CacheableObjectArray:
+    case DSCode::CacheableFileName:
+    case DSCode::CacheableStringArray:
+    case DSCode::CacheableArrayList:
+    case DSCode::CacheableHashSet:
+    case DSCode::CacheableHashMap:
+    case DSCode::CacheableTimeUnit:
+    case DSCode::CacheableNullString:
+    case DSCode::CacheableHashTable:
+    case DSCode::CacheableVector:
+    case DSCode::CacheableIdentityHashMap:
+    case DSCode::CacheableLinkedHashSet:
+    case DSCode::CacheableStack:
+    case DSCode::PDX:
+    case DSCode::PDX_ENUM:
+      break;
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
 void TheTypeMap::setup() {
   // Register Geode builtins here!!
   // update type ids in DSCode.hpp
@@ -365,6 +461,12 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
       break;
   }
 
+  if (auto arena = DeserializationArena::current(input)) {
+    if (auto obj = deserializeInArena(*arena, input, dsCode)) {
+      return obj;
+    }
+  }
+
   TypeFactoryMethod createType = nullptr;
 
   theTypeMap_.findDataSerializablePrimitive(dsCode, createType);
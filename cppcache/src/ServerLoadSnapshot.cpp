@@ -0,0 +1,100 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ServerLoadSnapshot.hpp"
+
+#include <algorithm>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+ServerLoadSnapshot::ServerLoadSnapshot(std::chrono::milliseconds maxAge)
+    : ServerLoadSnapshot(maxAge, std::random_device{}()) {}
+
+ServerLoadSnapshot::ServerLoadSnapshot(std::chrono::milliseconds maxAge,
+                                       uint32_t seed)
+    : maxAge_(maxAge),
+      valid_(false),
+      refreshing_(false),
+      random_(seed) {}
+
+bool ServerLoadSnapshot::claimRefresh(clock::time_point now) {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  if (refreshing_ || (valid_ && now - updated_ < maxAge_)) {
+    return false;
+  }
+
+  refreshing_ = true;
+  return true;
+}
+
+void ServerLoadSnapshot::update(std::vector<ServerLocation> servers,
+                                clock::time_point now) {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  servers_ = std::move(servers);
+  updated_ = now;
+  valid_ = true;
+  refreshing_ = false;
+}
+
+void ServerLoadSnapshot::refreshFailed() {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  refreshing_ = false;
+}
+
+bool ServerLoadSnapshot::select(const std::set<ServerLocation>& excluded,
+                                const LoadFunction& load,
+                                ServerLocation& selected) {
+  std::vector<ServerLocation> candidates;
+  {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    candidates.reserve(servers_.size());
+    for (const auto& server : servers_) {
+      if (excluded.find(server) == excluded.end()) {
+        candidates.push_back(server);
+      }
+    }
+  }
+
+  if (candidates.empty()) {
+    return false;
+  }
+
+  // Loads are read outside the lock; the callback may take pool locks.
+  std::vector<double> weights;
+  weights.reserve(candidates.size());
+  for (const auto& server : candidates) {
+    weights.push_back(1.0 / (1.0 + std::max(load(server), 0)));
+  }
+
+  std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+  {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    selected = candidates[pick(random_)];
+  }
+  return true;
+}
+
+size_t ServerLoadSnapshot::size() const {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  return servers_.size();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
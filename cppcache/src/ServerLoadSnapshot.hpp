@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERVERLOADSNAPSHOT_H_
+#define GEODE_SERVERLOADSNAPSHOT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "ServerLocation.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Locally cached list of the servers a locator reported for a pool, used to
+ * place new connections without asking a locator each time.
+ *
+ * Servers are picked at random, weighted by 1 / (1 + load), where load is
+ * supplied by the caller at selection time. The snapshot goes stale after
+ * maxAge; a single caller at a time is told to refresh it from a locator
+ * while the others keep using the previous list.
+ */
+class ServerLoadSnapshot {
+ public:
+  using clock = std::chrono::steady_clock;
+  using LoadFunction = std::function<int32_t(const ServerLocation&)>;
+
+  explicit ServerLoadSnapshot(std::chrono::milliseconds maxAge);
+  ServerLoadSnapshot(std::chrono::milliseconds maxAge, uint32_t seed);
+
+  ServerLoadSnapshot(const ServerLoadSnapshot&) = delete;
+  ServerLoadSnapshot& operator=(const ServerLoadSnapshot&) = delete;
+
+  /**
+   * Returns true if the snapshot is stale and no other caller is already
+   * refreshing it. The caller must then call update() or refreshFailed().
+   */
+  bool claimRefresh(clock::time_point now = clock::now());
+
+  void update(std::vector<ServerLocation> servers,
+              clock::time_point now = clock::now());
+
+  void refreshFailed();
+
+  /**
+   * Picks a server not in excluded. Returns false if there is none.
+   */
+  bool select(const std::set<ServerLocation>& excluded,
+              const LoadFunction& load, ServerLocation& selected);
+
+  size_t size() const;
+
+ private:
+  const std::chrono::milliseconds maxAge_;
+  mutable std::mutex mutex_;
+  std::vector<ServerLocation> servers_;
+  clock::time_point updated_;
+  bool valid_;
+  bool refreshing_;
+  std::minstd_rand random_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERVERLOADSNAPSHOT_H_
@@ -0,0 +1,185 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SlabPool.hpp"
+
+#include <cstdint>
+#include <mutex>
+
+#include <boost/align/aligned_alloc.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+size_t alignBlockSize(size_t size) {
+  const size_t alignment = alignof(std::max_align_t);
+  if (size < sizeof(void*)) {
+    size = sizeof(void*);
+  }
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+std::shared_ptr<SlabPool> SlabPool::create() {
+  return std::shared_ptr<SlabPool>(new SlabPool(),
+                                   [](SlabPool* pool) { pool->release(); });
+}
+
+SlabPool::SlabPool()
+    : refs_(1),
+      blockSize_(0),
+      slabSize_(0),
+      headerSize_(alignBlockSize(sizeof(Slab))),
+      available_(nullptr),
+      slabCount_(0) {}
+
+SlabPool::~SlabPool() noexcept {
+  // every block is free by now, so all slabs are on the available list
+  while (available_ != nullptr) {
+    auto slab = available_;
+    unlink(slab);
+    freeSlab(slab);
+  }
+}
+
+void SlabPool::release() noexcept {
+  if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+void* SlabPool::allocate(size_t size) {
+  {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    if (blockSize_ == 0) {
+      blockSize_ = alignBlockSize(size);
+      slabSize_ = 1;
+      while (slabSize_ < headerSize_ + blockSize_ * MIN_BLOCKS_PER_SLAB) {
+        slabSize_ <<= 1;
+      }
+    }
+    if (alignBlockSize(size) == blockSize_) {
+      if (available_ == nullptr) {
+        addSlab();
+      }
+      auto slab = available_;
+      auto block = slab->free;
+      slab->free = block->next;
+      slab->used++;
+      if (slab->free == nullptr) {
+        unlink(slab);
+      }
+      refs_.fetch_add(1, std::memory_order_relaxed);
+      return block;
+    }
+  }
+  return ::operator new(size);
+}
+
+void SlabPool::deallocate(void* block, size_t size) noexcept {
+  {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    if (alignBlockSize(size) != blockSize_) {
+      ::operator delete(block);
+      return;
+    }
+    auto slab = slabOf(block);
+    if (slab->free == nullptr) {
+      link(slab);
+    }
+    auto freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = slab->free;
+    slab->free = freeBlock;
+    // keep one slab with free blocks, so that a pool hovering around a
+    // slab boundary does not allocate and free a slab on every call
+    if (--slab->used == 0 && (slab->prev != nullptr || slab->next != nullptr)) {
+      unlink(slab);
+      freeSlab(slab);
+    }
+  }
+  release();
+}
+
+size_t SlabPool::blockSize() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return blockSize_;
+}
+
+size_t SlabPool::slabCount() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return slabCount_;
+}
+
+void SlabPool::addSlab() {
+  auto memory =
+      static_cast<char*>(boost::alignment::aligned_alloc(slabSize_, slabSize_));
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  auto slab = new (memory) Slab{nullptr, nullptr, nullptr, 0};
+  auto blocks = (slabSize_ - headerSize_) / blockSize_;
+  for (size_t i = blocks; i-- > 0;) {
+    auto block =
+        reinterpret_cast<FreeBlock*>(memory + headerSize_ + i * blockSize_);
+    block->next = slab->free;
+    slab->free = block;
+  }
+  link(slab);
+  slabCount_++;
+}
+
+void SlabPool::freeSlab(Slab* slab) noexcept {
+  slab->~Slab();
+  boost::alignment::aligned_free(slab);
+  slabCount_--;
+}
+
+SlabPool::Slab* SlabPool::slabOf(void* block) const noexcept {
+  auto address = reinterpret_cast<uintptr_t>(block);
+  return reinterpret_cast<Slab*>(address & ~(slabSize_ - 1));
+}
+
+void SlabPool::link(Slab* slab) noexcept {
+  slab->prev = nullptr;
+  slab->next = available_;
+  if (available_ != nullptr) {
+    available_->prev = slab;
+  }
+  available_ = slab;
+}
+
+void SlabPool::unlink(Slab* slab) noexcept {
+  if (slab->prev != nullptr) {
+    slab->prev->next = slab->next;
+  } else {
+    available_ = slab->next;
+  }
+  if (slab->next != nullptr) {
+    slab->next->prev = slab->prev;
+  }
+  slab->prev = nullptr;
+  slab->next = nullptr;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
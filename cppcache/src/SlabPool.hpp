@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SLABPOOL_H_
+#define GEODE_SLABPOOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Pool of fixed-size blocks carved out of larger slabs.
+ *
+ * The block size is fixed by the first request; requests of any other size
+ * are passed on to the global operator new. Slabs are aligned to their
+ * power of two size, so a freed block finds its slab from its address and
+ * goes back to that slab's free list. A slab whose blocks are all free is
+ * released unless it is the last one with free blocks.
+ *
+ * A pool is not meant to be shared by many threads; each MapSegment has its
+ * own, so the pool's lock is rarely contended.
+ *
+ * The pool is reference counted intrusively: the owner holds one reference
+ * and every live block holds another, so blocks may safely be freed after
+ * the owner has released the pool.
+ */
+class SlabPool {
+ public:
+  static constexpr size_t MIN_BLOCKS_PER_SLAB = 256;
+
+  /** Creates a pool owned by the returned pointer. */
+  static std::shared_ptr<SlabPool> create();
+
+  SlabPool(const SlabPool&) = delete;
+  SlabPool& operator=(const SlabPool&) = delete;
+
+  void* allocate(size_t size);
+  void deallocate(void* block, size_t size) noexcept;
+
+  size_t blockSize() const;
+  size_t slabCount() const;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  /** Header at the start of each slab, followed by its blocks. */
+  struct Slab {
+    Slab* prev;
+    Slab* next;
+    FreeBlock* free;
+    size_t used;
+  };
+
+  SlabPool();
+  ~SlabPool() noexcept;
+
+  void release() noexcept;
+  void addSlab();
+  void freeSlab(Slab* slab) noexcept;
+  Slab* slabOf(void* block) const noexcept;
+  void link(Slab* slab) noexcept;
+  void unlink(Slab* slab) noexcept;
+
+  mutable util::concurrent::spinlock_mutex mutex_;
+  std::atomic<size_t> refs_;
+  size_t blockSize_;
+  size_t slabSize_;
+  size_t headerSize_;
+  // slabs with at least one free block
+  Slab* available_;
+  size_t slabCount_;
+};
+
+/**
+ * Allocator handing out single objects from a SlabPool. Arrays, such as
+ * hash table bucket arrays, and allocators without a pool use the global
+ * operator new.
+ */
+template <class T>
+class SlabPoolAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  SlabPoolAllocator() noexcept : pool_(nullptr) {}
+
+  explicit SlabPoolAllocator(SlabPool* pool) noexcept : pool_(pool) {}
+
+  template <class U>
+  SlabPoolAllocator(const SlabPoolAllocator<U>& other) noexcept
+      : pool_(other.pool()) {}
+
+  T* allocate(size_t n) {
+    if (pool_ != nullptr && n == 1) {
+      return static_cast<T*>(pool_->allocate(sizeof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    if (pool_ != nullptr && n == 1) {
+      pool_->deallocate(p, sizeof(T));
+    } else {
+      ::operator delete(p);
+    }
+  }
+
+  SlabPool* pool() const noexcept { return pool_; }
+
+ private:
+  SlabPool* pool_;
+};
+
+template <class T, class U>
+bool operator==(const SlabPoolAllocator<T>& lhs,
+                const SlabPoolAllocator<U>& rhs) noexcept {
+  return lhs.pool() == rhs.pool();
+}
+
+template <class T, class U>
+bool operator!=(const SlabPoolAllocator<T>& lhs,
+                const SlabPoolAllocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SLABPOOL_H_
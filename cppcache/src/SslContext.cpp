@@ -0,0 +1,128 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SslContext.hpp"
+
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Index of the owning SslContext in SSL_CTX ex data.
+int contextIndex() {
+  static const int index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+// Index of the endpoint's session entry in SSL ex data.
+int sessionIndex() {
+  static const int index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+}  // namespace
+
+SslContext::SslContext(const std::string& pubkeyfile,
+                       const std::string& privkeyfile,
+                       const std::string& pemPassword)
+    : context_{boost::asio::ssl::context::sslv23_client} {
+  LOGDEBUG("*** SslContext init, pubkeyfile = %s", pubkeyfile.c_str());
+
+  try {
+    context_.set_verify_mode(boost::asio::ssl::verify_peer);
+    context_.load_verify_file(pubkeyfile);
+
+    context_.set_password_callback(
+        [pemPassword](std::size_t /*max_length*/,
+                      boost::asio::ssl::context::password_purpose /*purpose*/) {
+          return pemPassword;
+        });
+
+    if (!privkeyfile.empty()) {
+      context_.use_certificate_chain_file(privkeyfile);
+      context_.use_private_key_file(
+          privkeyfile, boost::asio::ssl::context::file_format::pem);
+    }
+  } catch (const boost::exception& ex) {
+    std::string info = boost::diagnostic_information(ex);
+    LOGDEBUG("caught boost exception: %s", info.c_str());
+    throw apache::geode::client::SslException(info.c_str());
+  }
+
+  auto ctx = context_.native_handle();
+  SSL_CTX_set_ex_data(ctx, contextIndex(), this);
+  SSL_CTX_set_session_cache_mode(
+      ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ctx, &SslContext::onNewSession);
+}
+
+SslContext::~SslContext() noexcept {
+  SSL_CTX_sess_set_new_cb(context_.native_handle(), nullptr);
+  for (auto& entry : sessions_) {
+    if (entry.second) {
+      SSL_SESSION_free(entry.second);
+    }
+  }
+}
+
+void SslContext::prepare(SSL* ssl, const std::string& endpoint) {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+  // Entries are never erased, so the address stays valid for callbacks.
+  auto& entry = *sessions_.emplace(endpoint, nullptr).first;
+  SSL_set_ex_data(ssl, sessionIndex(), &entry);
+  if (entry.second) {
+    SSL_set_session(ssl, entry.second);
+  }
+}
+
+int SslContext::onNewSession(SSL* ssl, SSL_SESSION* session) {
+  auto self = static_cast<SslContext*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), contextIndex()));
+  auto entry = static_cast<Sessions::value_type*>(
+      SSL_get_ex_data(ssl, sessionIndex()));
+  if (self == nullptr || entry == nullptr) {
+    return 0;
+  }
+
+  SSL_SESSION* previous;
+  {
+    std::lock_guard<decltype(self->mutex_)> lock(self->mutex_);
+    previous = entry->second;
+    entry->second = session;
+  }
+
+  if (previous) {
+    SSL_SESSION_free(previous);
+  }
+
+  // Keep the reference OpenSSL passed in.
+  return 1;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
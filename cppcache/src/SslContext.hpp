@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SSLCONTEXT_H_
+#define GEODE_SSLCONTEXT_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/asio/ssl.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Client TLS configuration shared by all connections of a cache. The trust
+ * store, certificate chain and private key are loaded once. Sessions the
+ * servers issue are kept per endpoint so reconnections can resume them
+ * instead of running a full handshake.
+ */
+class SslContext {
+ public:
+  SslContext(const std::string& pubkeyfile, const std::string& privkeyfile,
+             const std::string& pemPassword);
+
+  ~SslContext() noexcept;
+
+  SslContext(const SslContext&) = delete;
+  SslContext& operator=(const SslContext&) = delete;
+
+  boost::asio::ssl::context& context() { return context_; }
+
+  /**
+   * Offers the session last saved for endpoint to ssl, and saves sessions
+   * later issued on ssl for endpoint. Call before the handshake.
+   */
+  void prepare(SSL* ssl, const std::string& endpoint);
+
+ private:
+  using Sessions = std::unordered_map<std::string, SSL_SESSION*>;
+
+  static int onNewSession(SSL* ssl, SSL_SESSION* session);
+
+  boost::asio::ssl::context context_;
+  std::mutex mutex_;
+  Sessions sessions_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SSLCONTEXT_H_
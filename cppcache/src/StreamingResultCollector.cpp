@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/StreamingResultCollector.hpp>
+
+#include <utility>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+StreamingResultCollector::StreamingResultCollector(ResultHandler handler)
+    : handler_(std::move(handler)), cancelled_(false), ready_(false) {}
+
+StreamingResultCollector::~StreamingResultCollector() noexcept {}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lk(readyMutex_);
+  if (readyCondition_.wait_for(lk, timeout, [this] { return ready_; })) {
+    return CacheableVector::create();
+  }
+
+  throw FunctionException(
+      "Result is not ready, function execution has not ended");
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  if (!isCancelled() && !handler_(result)) {
+    cancel();
+  }
+}
+
+void StreamingResultCollector::endResults() {
+  {
+    std::lock_guard<std::mutex> lk(readyMutex_);
+    ready_ = true;
+  }
+  readyCondition_.notify_all();
+}
+
+void StreamingResultCollector::clearResults() {}
+
+void StreamingResultCollector::cancel() {
+  cancelled_.store(true, std::memory_order_relaxed);
+}
+
+bool StreamingResultCollector::isCancelled() const {
+  return cancelled_.load(std::memory_order_relaxed);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -60,7 +60,13 @@ const char DurableTimeout[] = "durable-timeout";
 const char ConnectTimeout[] = "connect-timeout";
 const char ConnectWaitTimeout[] = "connect-wait-timeout";
 const char BucketWaitTimeout[] = "bucket-wait-timeout";
+const char DnsCacheTtl[] = "dns-cache-ttl";
+const char DnsNegativeCacheTtl[] = "dns-negative-cache-ttl";
+const char DeserializationArenaEnabled[] = "deserialization-arena-enabled";
 const char ConflateEvents[] = "conflate-events";
+const char ClientConflateEvents[] = "client-conflate-events";
+const char ClientConflateEventsQueueSize[] =
+    "client-conflate-events-queue-size";
 const char SecurityClientDhAlgo[] = "security-client-dhalgo";
 const char SecurityClientKsPath[] = "security-client-kspath";
 const char AutoReadyForEvents[] = "auto-ready-for-events";
@@ -83,6 +89,8 @@ constexpr auto DefaultDurableTimeout = std::chrono::seconds(300);
 constexpr auto DefaultConnectTimeout = std::chrono::seconds(59);
 constexpr auto DefaultConnectWaitTimeout = std::chrono::seconds::zero();
 constexpr auto DefaultBucketWaitTimeout = std::chrono::seconds::zero();
+constexpr auto DefaultDnsCacheTtl = std::chrono::seconds(30);
+constexpr auto DefaultDnsNegativeCacheTtl = std::chrono::seconds(10);
 
 constexpr auto DefaultSamplingInterval = std::chrono::seconds(1);
 constexpr auto DefaultSamplingEnabled = false;
@@ -119,6 +127,7 @@ constexpr auto DefaultNotifyAckInterval = std::chrono::seconds(1);
 constexpr auto DefaultNotifyDupCheckLife = std::chrono::seconds(300);
 const char DefaultSecurityPrefix[] = "security-";
 const uint32_t DefaultThreadPoolSize = std::thread::hardware_concurrency() * 2;
+const uint32_t DefaultClientConflateEventsQueueSize = 10000;
 constexpr auto DefaultSuspendedTxTimeout = std::chrono::seconds(30);
 constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
@@ -162,6 +171,9 @@ SystemProperties::SystemProperties(
       m_connectTimeout(DefaultConnectTimeout),
       m_connectWaitTimeout(DefaultConnectWaitTimeout),
       m_bucketWaitTimeout(DefaultBucketWaitTimeout),
+      m_dnsCacheTtl(DefaultDnsCacheTtl),
+      m_dnsNegativeCacheTtl(DefaultDnsNegativeCacheTtl),
+      m_deserializationArenaEnabled(false),
       m_autoReadyForEvents(DefaultAutoReadyForEvents),
       m_sslEnabled(DefaultSslEnabled),
       m_timestatisticsEnabled(DefaultTimeStatisticsEnabled),
@@ -169,6 +181,8 @@ SystemProperties::SystemProperties(
       m_sslTrustStore(DefaultSslTrustStore),
       m_sslKeystorePassword(DefaultSslKeystorePassword),
       m_conflateEvents(DefaultConflateEvents),
+      m_clientConflateEvents(false),
+      m_clientConflateEventsQueueSize(DefaultClientConflateEventsQueueSize),
       m_threadPoolSize(DefaultThreadPoolSize),
       m_suspendedTxTimeout(DefaultSuspendedTxTimeout),
       m_tombstoneTimeout(DefaultTombstoneTimeout),
@@ -294,6 +308,12 @@ void SystemProperties::processProperty(const std::string& property,
     parseDurationProperty(property, std::string(value), m_connectWaitTimeout);
   } else if (property == BucketWaitTimeout) {
     parseDurationProperty(property, std::string(value), m_bucketWaitTimeout);
+  } else if (property == DnsCacheTtl) {
+    parseDurationProperty(property, std::string(value), m_dnsCacheTtl);
+  } else if (property == DnsNegativeCacheTtl) {
+    parseDurationProperty(property, std::string(value), m_dnsNegativeCacheTtl);
+  } else if (property == DeserializationArenaEnabled) {
+    m_deserializationArenaEnabled = parseBooleanProperty(property, value);
   } else if (property == DisableShufflingEndpoint) {
     m_disableShufflingEndpoint = parseBooleanProperty(property, value);
   } else if (property == AutoReadyForEvents) {
@@ -329,6 +349,10 @@ void SystemProperties::processProperty(const std::string& property,
     m_sslKeystorePassword = value;
   } else if (property == ConflateEvents) {
     m_conflateEvents = value;
+  } else if (property == ClientConflateEvents) {
+    m_clientConflateEvents = parseBooleanProperty(property, value);
+  } else if (property == ClientConflateEventsQueueSize) {
+    m_clientConflateEventsQueueSize = std::stoul(value);
   } else if (property == CacheXMLFile) {
     m_cacheXMLFile = value;
   } else if (property == LogFileSizeLimit) {
@@ -381,6 +405,12 @@ void SystemProperties::logSettings() {
   settings += "\n  conflate-events = ";
   settings += conflateEvents();
 
+  settings += "\n  client-conflate-events = ";
+  settings += clientConflateEvents() ? "true" : "false";
+
+  settings += "\n  client-conflate-events-queue-size = ";
+  settings += std::to_string(clientConflateEventsQueueSize());
+
   settings += "\n  connect-timeout = ";
   settings += to_string(connectTimeout());
 
@@ -396,6 +426,15 @@ void SystemProperties::logSettings() {
   settings += "\n  disable-shuffling-of-endpoints = ";
   settings += isEndpointShufflingDisabled() ? "true" : "false";
 
+  settings += "\n  dns-cache-ttl = ";
+  settings += to_string(dnsCacheTtl());
+
+  settings += "\n  dns-negative-cache-ttl = ";
+  settings += to_string(dnsNegativeCacheTtl());
+
+  settings += "\n  deserialization-arena-enabled = ";
+  settings += deserializationArenaEnabled() ? "true" : "false";
+
   settings += "\n  durable-client-id = ";
   settings += durableClientId();
 
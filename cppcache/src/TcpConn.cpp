@@ -103,20 +103,21 @@ namespace geode {
 namespace client {
 TcpConn::TcpConn(const std::string ipaddr,
                  std::chrono::microseconds connect_timeout,
-                 int32_t maxBuffSizePool)
+                 int32_t maxBuffSizePool, DnsResolver& resolver)
     : TcpConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
-          connect_timeout, maxBuffSizePool} {}
+          connect_timeout, maxBuffSizePool, resolver} {}
 
 TcpConn::TcpConn(const std::string host, uint16_t port,
-                 std::chrono::microseconds timeout, int32_t maxBuffSizePool)
+                 std::chrono::microseconds timeout, int32_t maxBuffSizePool,
+                 DnsResolver& resolver)
     : socket_{io_context_} {
-  auto results = resolve(host, port);
+  auto endpoints = resolver.resolve(host, port);
 
   // We must connect first so we have a valid file descriptor to set options
   // on.
-  connect(results, timeout);
+  connect(endpoints, timeout);
 
   socket_.set_option(::boost::asio::ip::tcp::no_delay{true});
   socket_.set_option(
@@ -128,8 +129,8 @@ TcpConn::TcpConn(const std::string host, uint16_t port,
 TcpConn::TcpConn(const std::string ipaddr,
                  std::chrono::microseconds connect_timeout,
                  int32_t maxBuffSizePool, std::chrono::microseconds send_time,
-                 std::chrono::microseconds receive_time)
-    : TcpConn{ipaddr, connect_timeout, maxBuffSizePool} {
+                 std::chrono::microseconds receive_time, DnsResolver& resolver)
+    : TcpConn{ipaddr, connect_timeout, maxBuffSizePool, resolver} {
 #if defined(_WINDOWS)
   socket_.set_option(::send_timeout{static_cast<DWORD>(send_time.count())});
   socket_.set_option(
@@ -297,7 +298,7 @@ std::string TcpConn::getRemoteEndpoint() {
       std::to_string(socket_.remote_endpoint().port()));
 }
 
-void TcpConn::connect(boost::asio::ip::tcp::resolver::results_type r,
+void TcpConn::connect(const DnsResolver::Endpoints &endpoints,
                       std::chrono::microseconds timeout) {
   boost::optional<boost::system::error_code> connect_result;
 
@@ -305,7 +306,7 @@ void TcpConn::connect(boost::asio::ip::tcp::resolver::results_type r,
     // We must connect first so we have a valid file descriptor to set
     // options on.
     boost::asio::async_connect(
-        socket_, r,
+        socket_, endpoints,
         [&connect_result](const boost::system::error_code &ec,
                           const boost::asio::ip::tcp::endpoint) {
           connect_result = ec;
@@ -336,23 +337,6 @@ void TcpConn::connect(boost::asio::ip::tcp::resolver::results_type r,
            socket_.remote_endpoint().port());
 }
 
-boost::asio::ip::tcp::resolver::results_type TcpConn::resolve(
-    const std::string host, uint16_t port) {
-  boost::system::error_code resolve_result;
-  boost::asio::ip::tcp::resolver::results_type results;
-
-  boost::asio::ip::tcp::resolver resolver(io_context_);
-  results = resolver.resolve(host, std::to_string(port), resolve_result);
-
-  if (resolve_result) {
-    LOGDEBUG("Throwing a resolve exception: %s",
-             resolve_result.message().c_str());
-    throw boost::system::system_error{resolve_result};
-  }
-
-  return results;
-}
-
 void TcpConn::prepareAsyncRead(
     char *buff, size_t len,
     boost::optional<boost::system::error_code> &read_result,
@@ -26,6 +26,7 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "Connector.hpp"
+#include "DnsResolver.hpp"
 
 namespace apache {
 namespace geode {
@@ -44,10 +45,7 @@ class TcpConn : public Connector {
   boost::asio::io_context io_context_;
   boost::asio::ip::tcp::socket socket_;
 
-  boost::asio::ip::tcp::resolver::results_type resolve(
-      const std::string hostname, uint16_t port);
-
-  void connect(boost::asio::ip::tcp::resolver::results_type r,
+  void connect(const DnsResolver::Endpoints& endpoints,
                std::chrono::microseconds connect_timeout);
 
   size_t receive(char*, size_t, std::chrono::milliseconds,
@@ -65,14 +63,15 @@ class TcpConn : public Connector {
 
  public:
   TcpConn(const std::string ipaddr, std::chrono::microseconds connect_timeout,
-          int32_t maxBuffSizePool);
+          int32_t maxBuffSizePool, DnsResolver& resolver);
 
   TcpConn(const std::string hostname, uint16_t port,
-          std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool);
+          std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
+          DnsResolver& resolver);
 
   TcpConn(const std::string ipaddr, std::chrono::microseconds connect_timeout,
           int32_t maxBuffSizePool, std::chrono::microseconds send_timeout,
-          std::chrono::microseconds receive_timeout);
+          std::chrono::microseconds receive_timeout, DnsResolver& resolver);
 
   ~TcpConn() override;
 };
@@ -36,51 +36,48 @@ namespace apache {
 namespace geode {
 namespace client {
 
-TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t,
+TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t port,
                        const std::string& sniProxyHostname,
                        uint16_t sniProxyPort,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
-    : TcpConn{sniProxyHostname, sniProxyPort, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
-      strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword, hostname);
+                       int32_t maxBuffSizePool, DnsResolver& resolver,
+                       SslContext& sslContext)
+    : TcpConn{sniProxyHostname, sniProxyPort, connect_timeout, maxBuffSizePool,
+              resolver},
+      ssl_context_(sslContext),
+      strand_(io_context_),
+      handshake_time_(std::chrono::nanoseconds::zero()),
+      session_reused_(false) {
+  init(hostname + ':' + std::to_string(port), hostname);
 }
 
 TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t port,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
-    : TcpConn{hostname, port, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
-      strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword);
+                       int32_t maxBuffSizePool, DnsResolver& resolver,
+                       SslContext& sslContext)
+    : TcpConn{hostname, port, connect_timeout, maxBuffSizePool, resolver},
+      ssl_context_(sslContext),
+      strand_(io_context_),
+      handshake_time_(std::chrono::nanoseconds::zero()),
+      session_reused_(false) {
+  init(hostname + ':' + std::to_string(port));
 }
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       int32_t maxBuffSizePool, DnsResolver& resolver,
+                       SslContext& sslContext)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
-          connect_timeout,
-          maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
+          connect_timeout, maxBuffSizePool, resolver, sslContext} {}
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
                        int32_t maxBuffSizePool,
                        const std::string& sniProxyHostname,
-                       uint16_t sniProxyPort, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       uint16_t sniProxyPort, DnsResolver& resolver,
+                       SslContext& sslContext)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
@@ -88,45 +85,27 @@ TcpSslConn::TcpSslConn(const std::string& ipaddr,
           sniProxyPort,
           connect_timeout,
           maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
+          resolver,
+          sslContext} {}
 
-void TcpSslConn::init(const std::string& pubkeyfile,
-                      const std::string& privkeyfile,
-                      const std::string& pemPassword,
+void TcpSslConn::init(const std::string& endpoint,
                       const std::string& sniHostname) {
-  // Most of the SSL configuration provided *through* Asio is on the context.
-  // This configuration is copied into each SSL instance upon construction.
-  // That means you need to get your configuration in order before you
-  // construct the stream and connect the socket.
-  LOGDEBUG(
-      "*** TcpSslConn init, pubkeyfile = %s, pemPassword = %s, sniHostname = "
-      "%s",
-      pubkeyfile.c_str(), pemPassword.c_str(), sniHostname.c_str());
+  // The trust store and key material are loaded once into the shared
+  // SslContext; each stream only picks up the endpoint's cached session.
+  LOGDEBUG("*** TcpSslConn init, endpoint = %s, sniHostname = %s",
+           endpoint.c_str(), sniHostname.c_str());
 
   try {
-    ssl_context_.set_verify_mode(boost::asio::ssl::verify_peer);
-    ssl_context_.load_verify_file(pubkeyfile);
-
-    ssl_context_.set_password_callback(
-        [pemPassword](std::size_t /*max_length*/,
-                      boost::asio::ssl::context::password_purpose /*purpose*/) {
-          return pemPassword;
-        });
-
-    if (!privkeyfile.empty()) {
-      ssl_context_.use_certificate_chain_file(privkeyfile);
-      ssl_context_.use_private_key_file(
-          privkeyfile, boost::asio::ssl::context::file_format::pem);
-    }
-
     auto stream = std::unique_ptr<ssl_stream_type>(
-        new ssl_stream_type{socket_, ssl_context_});
+        new ssl_stream_type{socket_, ssl_context_.context()});
 
     SSL_set_tlsext_host_name(stream->native_handle(), sniHostname.c_str());
+    ssl_context_.prepare(stream->native_handle(), endpoint);
 
+    auto start = std::chrono::steady_clock::now();
     stream->handshake(ssl_stream_type::client);
+    handshake_time_ = std::chrono::steady_clock::now() - start;
+    session_reused_ = SSL_session_reused(stream->native_handle()) == 1;
 
     std::stringstream ss;
     ss << "Setup SSL " << socket_.local_endpoint() << " -> "
@@ -137,6 +116,10 @@ void TcpSslConn::init(const std::string& pubkeyfile,
     ss << "SNI hostname: " << sniHostname;
     LOGINFO(ss.str());
 
+    LOGFINE("SSL handshake with %s took %lld ns, session %s", endpoint.c_str(),
+            static_cast<long long>(handshake_time_.count()),
+            session_reused_ ? "resumed" : "new");
+
     socket_stream_ = std::move(stream);
   } catch (const boost::exception& ex) {
     // error handling
@@ -147,6 +130,13 @@ void TcpSslConn::init(const std::string& pubkeyfile,
 }
 
 TcpSslConn::~TcpSslConn() {
+  // Connections are dropped without a close_notify exchange. OpenSSL treats
+  // a session freed that way as broken and stops it from being resumed, so
+  // mark the shutdown as done to keep the cached session usable.
+  if (socket_stream_) {
+    SSL_set_shutdown(socket_stream_->native_handle(), SSL_SENT_SHUTDOWN);
+  }
+
   std::stringstream ss;
   ss << "Teardown SSL " << socket_.local_endpoint() << " -> ";
   try {
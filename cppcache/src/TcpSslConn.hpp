@@ -22,6 +22,7 @@
 
 #include <boost/asio/ssl.hpp>
 
+#include "SslContext.hpp"
 #include "TcpConn.hpp"
 
 namespace apache {
@@ -33,9 +34,11 @@ class TcpSslConn : public TcpConn {
   using ssl_stream_type =
       boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>;
 
-  boost::asio::ssl::context ssl_context_;
+  SslContext& ssl_context_;
   std::unique_ptr<ssl_stream_type> socket_stream_;
   boost::asio::io_context::strand strand_;
+  std::chrono::nanoseconds handshake_time_;
+  bool session_reused_;
 
   void prepareAsyncRead(char* buff, size_t len,
                         boost::optional<boost::system::error_code>& read_result,
@@ -50,30 +53,31 @@ class TcpSslConn : public TcpConn {
   TcpSslConn(const std::string& hostname, uint16_t port,
              const std::string& sniProxyHostname, uint16_t sniProxyPort,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             DnsResolver& resolver, SslContext& sslContext);
 
   TcpSslConn(const std::string& hostname, uint16_t port,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             DnsResolver& resolver, SslContext& sslContext);
 
   TcpSslConn(const std::string& ipaddr,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             DnsResolver& resolver, SslContext& sslContext);
 
   TcpSslConn(const std::string& ipaddr, std::chrono::microseconds waitSeconds,
              int32_t maxBuffSizePool, const std::string& sniProxyHostname,
-             uint16_t sniProxyPort, const std::string& publicKeyFile,
-             const std::string& privateKeyFile, const std::string& password);
+             uint16_t sniProxyPort, DnsResolver& resolver,
+             SslContext& sslContext);
 
   ~TcpSslConn() override;
 
+  /** Time spent in the TLS handshake. */
+  std::chrono::nanoseconds getHandshakeTime() const { return handshake_time_; }
+
+  /** True if the handshake resumed a previous session with the endpoint. */
+  bool isSessionReused() const { return session_reused_; }
+
  private:
-  void init(const std::string& pubkeyfile, const std::string& privkeyfile,
-            const std::string& pemPassword,
-            const std::string& sniHostname = "");
+  void init(const std::string& endpoint, const std::string& sniHostname = "");
 };
 }  // namespace client
 }  // namespace geode
@@ -30,6 +30,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class DeserializationArena;
+
 /**
  * Base class for holding chunked results, processing a chunk
  * and signalling end of chunks using semaphore.
@@ -39,6 +41,7 @@ class TcrChunkedResult {
   binary_semaphore* finalize_semaphore_;
   std::shared_ptr<Exception> m_ex;
   bool m_inSameThread;
+  std::shared_ptr<DeserializationArena> m_arena;
 
  protected:
   uint16_t m_dsmemId;
@@ -48,6 +51,14 @@ class TcrChunkedResult {
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl) = 0;
 
+  /**
+   * Returns the arena shared by the whole response if
+   * deserialization-arena-enabled is set, or nullptr. Pass it to a
+   * DeserializationArena::Scope only for results handed to the application,
+   * not for values put in a region.
+   */
+  DeserializationArena* getArena(const CacheImpl* cacheImpl);
+
  public:
   inline TcrChunkedResult()
       : finalize_semaphore_(nullptr),
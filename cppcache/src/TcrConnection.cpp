@@ -111,7 +111,11 @@ bool TcrConnection::initTcrConnection(
     synchronized_set<std::unordered_set<uint16_t>>& ports,
     bool isClientNotification, bool isSecondary,
     std::chrono::microseconds connectTimeout) {
+  if (endpointObj_) {
+    endpointObj_->connectionClosed();
+  }
   endpointObj_ = endpointObj;
+  endpointObj_->connectionOpened();
   poolDM_ = dynamic_cast<ThinClientPoolDM*>(endpointObj_->getPoolHADM());
   hasServerQueue_ = NON_REDUNDANT_SERVER;
   queueSize_ = 0;
@@ -483,22 +487,27 @@ void TcrConnection::createConnection(const std::string& address,
                                ->getDistributedSystem()
                                .getSystemProperties();
 
+  auto& resolver = connectionManager_.getCacheImpl()->getDnsResolver();
+
   if (systemProperties.sslEnabled()) {
+    auto& sslContext = connectionManager_.getCacheImpl()->getSslContext();
     const auto& sniHostname = poolDM_->getSniProxyHost();
+    std::unique_ptr<TcpSslConn> sslConn;
     if (sniHostname.empty()) {
-      conn_.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
-                                 systemProperties.sslTrustStore(),
-                                 systemProperties.sslKeyStore(),
-                                 systemProperties.sslKeystorePassword()));
+      sslConn.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
+                                   resolver, sslContext));
     } else {
       const auto sniPort = poolDM_->getSniProxyPort();
-      conn_.reset(new TcpSslConn(
-          address, connectTimeout, maxBuffSizePool, sniHostname, sniPort,
-          systemProperties.sslTrustStore(), systemProperties.sslKeyStore(),
-          systemProperties.sslKeystorePassword()));
+      sslConn.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
+                                   sniHostname, sniPort, resolver,
+                                   sslContext));
     }
+    poolDM_->getStats().incSslHandshakes(sslConn->isSessionReused(),
+                                         sslConn->getHandshakeTime());
+    conn_ = std::move(sslConn);
   } else {
-    conn_.reset(new TcpConn(address, connectTimeout, maxBuffSizePool));
+    conn_.reset(
+        new TcpConn(address, connectTimeout, maxBuffSizePool, resolver));
   }
 }
 
@@ -549,17 +558,21 @@ char* TcrConnection::sendRequest(const char* buffer, size_t len,
                                  std::chrono::microseconds sendTimeoutSec,
                                  std::chrono::microseconds receiveTimeoutSec,
                                  int32_t request) {
-  const auto start = std::chrono::system_clock::now();
-  send(buffer, len, sendTimeoutSec);
-  const auto timeSpent = start - std::chrono::system_clock::now();
+  receiveTimeoutSec =
+      sendRequestAsync(buffer, len, sendTimeoutSec, receiveTimeoutSec);
+  return receiveResponse(recvLen, receiveTimeoutSec, request);
+}
 
-  if (timeSpent >= receiveTimeoutSec) {
-    throwException(
-        TimeoutException("TcrConnection::send: connection timed out"));
-  }
+std::chrono::microseconds TcrConnection::sendRequestAsync(
+    const char* buffer, size_t len, std::chrono::microseconds sendTimeoutSec,
+    std::chrono::microseconds receiveTimeoutSec) {
+  return receiveTimeoutSec -
+         sendWithTimeouts(buffer, len, sendTimeoutSec, receiveTimeoutSec);
+}
 
-  receiveTimeoutSec -=
-      std::chrono::duration_cast<decltype(receiveTimeoutSec)>(timeSpent);
+char* TcrConnection::receiveResponse(
+    size_t* recvLen, std::chrono::microseconds receiveTimeoutSec,
+    int32_t request) {
   ConnErrType opErr = CONN_NOERR;
   return readMessage(recvLen, receiveTimeoutSec, true, &opErr, false, request);
 }
@@ -568,6 +581,15 @@ void TcrConnection::sendRequestForChunkedResponse(
     const TcrMessage& request, size_t len, TcrMessageReply& reply,
     std::chrono::microseconds sendTimeoutSec,
     std::chrono::microseconds receiveTimeoutSec) {
+  receiveTimeoutSec = sendRequestForChunkedResponseAsync(
+      request, len, reply, sendTimeoutSec, receiveTimeoutSec);
+  receiveChunkedResponse(request, reply, receiveTimeoutSec);
+}
+
+std::chrono::microseconds TcrConnection::sendRequestForChunkedResponseAsync(
+    const TcrMessage& request, size_t len, TcrMessageReply& reply,
+    std::chrono::microseconds sendTimeoutSec,
+    std::chrono::microseconds receiveTimeoutSec) {
   if (useReplyTimeout(request)) {
     receiveTimeoutSec = reply.getTimeout();
     sendTimeoutSec = reply.getTimeout();
@@ -579,6 +601,12 @@ void TcrConnection::sendRequestForChunkedResponse(
   // to help in decoding the reply based on what was the request type
   reply.setMessageTypeRequest(request.getMessageType());
 
+  return receiveTimeoutSec;
+}
+
+void TcrConnection::receiveChunkedResponse(
+    const TcrMessage& request, TcrMessageReply& reply,
+    std::chrono::microseconds receiveTimeoutSec) {
   if (replyHasResult(request, reply)) {
     readMessageChunked(reply, receiveTimeoutSec, true);
   }
@@ -1224,7 +1252,11 @@ void TcrConnection::updateCreationTime() {
   touch();
 }
 
-TcrConnection::~TcrConnection() {}
+TcrConnection::~TcrConnection() {
+  if (endpointObj_) {
+    endpointObj_->connectionClosed();
+  }
+}
 
 bool TcrConnection::setAndGetBeingUsed(volatile bool isBeingUsed,
                                        bool forTransaction) {
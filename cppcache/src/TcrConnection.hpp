@@ -171,6 +171,29 @@ class TcrConnection {
       std::chrono::microseconds sendTimeoutSec = DEFAULT_WRITE_TIMEOUT,
       std::chrono::microseconds receiveTimeoutSec = DEFAULT_READ_TIMEOUT);
 
+  /**
+   * The two halves of sendRequest and sendRequestForChunkedResponse, so that
+   * one thread can have requests in flight on several connections before it
+   * reads any of their replies. The send returns the receive timeout left
+   * after the send, to be passed to the matching receive.
+   *
+   * @exception  GeodeIOException  if an I/O error occurs (socket failure).
+   * @exception  TimeoutException  if timeout happens at any socket operation
+   */
+  std::chrono::microseconds sendRequestAsync(
+      const char* buffer, size_t len, std::chrono::microseconds sendTimeoutSec,
+      std::chrono::microseconds receiveTimeoutSec);
+  char* receiveResponse(size_t* recvLen,
+                        std::chrono::microseconds receiveTimeoutSec,
+                        int32_t request);
+  std::chrono::microseconds sendRequestForChunkedResponseAsync(
+      const TcrMessage& request, size_t len, TcrMessageReply& reply,
+      std::chrono::microseconds sendTimeoutSec,
+      std::chrono::microseconds receiveTimeoutSec);
+  void receiveChunkedResponse(const TcrMessage& request,
+                              TcrMessageReply& reply,
+                              std::chrono::microseconds receiveTimeoutSec);
+
   /**
    * send an asynchronized request to server. No response is expected.
    * we need to use it to send CLOSE_CONNECTION msg
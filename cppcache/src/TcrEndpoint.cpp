@@ -18,12 +18,14 @@
 #include "TcrEndpoint.hpp"
 
 #include <chrono>
+#include <functional>
 #include <thread>
 
 #include <geode/AuthInitialize.hpp>
 #include <geode/SystemProperties.hpp>
 
 #include "CacheImpl.hpp"
+#include "ConflatingQueue.hpp"
 #include "DistributedSystemImpl.hpp"
 #include "StackTrace.hpp"
 #include "TcrConnectionManager.hpp"
@@ -37,6 +39,156 @@ namespace geode {
 namespace client {
 
 const char* TcrEndpoint::NC_Notification = "NC Notification";
+const char* TcrEndpoint::NC_Notification_Dispatcher =
+    "NC Notification Dispatcher";
+
+namespace {
+
+struct NotificationKey {
+  std::string region;
+  std::shared_ptr<CacheableKey> key;
+};
+
+struct NotificationKeyHash {
+  size_t operator()(const NotificationKey& key) const {
+    return std::hash<std::string>()(key.region) * 31 +
+           static_cast<size_t>(key.key->hashcode());
+  }
+};
+
+struct NotificationKeyEqual {
+  bool operator()(const NotificationKey& lhs,
+                  const NotificationKey& rhs) const {
+    return lhs.region == rhs.region && *lhs.key == *rhs.key;
+  }
+};
+
+bool isCqNotification(const TcrMessageReply& msg) {
+  return msg.getMessageType() != TcrMessage::CLIENT_MARKER && msg.hasCqPart();
+}
+
+bool isEntryNotification(const TcrMessageReply& msg) {
+  switch (msg.getMessageType()) {
+    case TcrMessage::LOCAL_CREATE:
+    case TcrMessage::LOCAL_UPDATE:
+    case TcrMessage::LOCAL_INVALIDATE:
+    case TcrMessage::LOCAL_DESTROY:
+      return msg.getKey() != nullptr;
+    default:
+      return false;
+  }
+}
+
+// A full value update supersedes a pending full value update of the same
+// key, as long as both were routed to the same continuous queries with the
+// same operations. Deltas are never conflated away.
+bool conflatesNotification(const std::unique_ptr<TcrMessageReply>& pending,
+                           const std::unique_ptr<TcrMessageReply>& next) {
+  if (pending->getMessageType() != TcrMessage::LOCAL_UPDATE ||
+      next->getMessageType() != TcrMessage::LOCAL_UPDATE ||
+      pending->hasDelta() || next->hasDelta()) {
+    return false;
+  }
+
+  auto pendingCqs = pending->getCqs();
+  auto nextCqs = next->getCqs();
+  if (pendingCqs == nullptr || nextCqs == nullptr) {
+    return pendingCqs == nextCqs;
+  }
+  return *pendingCqs == *nextCqs;
+}
+
+}  // namespace
+
+/**
+ * Applies subscription events on its own thread, so that the subscription
+ * reader keeps reading while listeners run. CQ events queued together are
+ * delivered to the CQ listeners as one batch and, when conflating, the
+ * events a slow listener has not got to yet are conflated. Events still
+ * queued when it is destroyed are dropped.
+ */
+class TcrEndpoint::NotificationDispatcher {
+ public:
+  NotificationDispatcher(TcrEndpoint& endpoint, bool conflate,
+                         size_t capacity)
+      : endpoint_(endpoint),
+        queue_(conflate ? &conflatesNotification : nullptr, capacity),
+        task_(this, &NotificationDispatcher::dispatch,
+              NC_Notification_Dispatcher) {
+    task_.start();
+  }
+
+  // waits only for the event being applied
+  ~NotificationDispatcher() noexcept {
+    task_.stopNoblock();
+    queue_.close();
+    task_.wait();
+  }
+
+  void push(std::unique_ptr<TcrMessageReply> msg) {
+    if (!isEntryNotification(*msg)) {
+      queue_.pushBarrier(std::move(msg));
+      return;
+    }
+
+    NotificationKey key{msg->getRegionName(), msg->getKey()};
+    if (queue_.push(key, std::move(msg))) {
+      endpoint_.handleConflatedNotification();
+    }
+  }
+
+ private:
+  void dispatch(std::atomic<bool>& isRunning) {
+    std::vector<std::unique_ptr<TcrMessageReply>> msgs;
+    std::vector<TcrMessage*> cqMsgs;
+    while (isRunning && queue_.popAll(msgs)) {
+      for (auto& msg : msgs) {
+        if (isCqNotification(*msg)) {
+          cqMsgs.push_back(msg.get());
+          continue;
+        }
+        dispatchCqNotifications(cqMsgs, isRunning);
+        if (!isRunning) {
+          break;
+        }
+        applyLogged([&] { endpoint_.dispatchNotification(*msg); });
+      }
+      dispatchCqNotifications(cqMsgs, isRunning);
+      msgs.clear();
+    }
+  }
+
+  void dispatchCqNotifications(std::vector<TcrMessage*>& cqMsgs,
+                               std::atomic<bool>& isRunning) {
+    if (!cqMsgs.empty() && isRunning) {
+      applyLogged([&] { endpoint_.dispatchCqNotifications(cqMsgs); });
+      cqMsgs.clear();
+    }
+  }
+
+  template <class Apply>
+  void applyLogged(Apply apply) {
+    try {
+      apply();
+    } catch (const Exception& ex) {
+      LOGERROR(
+          "Exception while applying subscription event from endpoint %s:: "
+          "%s: %s",
+          endpoint_.m_name.c_str(), ex.getName().c_str(), ex.what());
+    } catch (...) {
+      LOGERROR(
+          "Unexpected exception while applying subscription event from "
+          "endpoint %s",
+          endpoint_.m_name.c_str());
+    }
+  }
+
+  TcrEndpoint& endpoint_;
+  ConflatingQueue<NotificationKey, std::unique_ptr<TcrMessageReply>,
+                  NotificationKeyHash, NotificationKeyEqual>
+      queue_;
+  Task<NotificationDispatcher> task_;
+};
 
 TcrEndpoint::TcrEndpoint(const std::string& name, CacheImpl* cacheImpl,
                          binary_semaphore& failoverSema,
@@ -74,7 +226,11 @@ TcrEndpoint::TcrEndpoint(const std::string& name, CacheImpl* cacheImpl,
       m_queueSize(0),
       m_distributedMemId(0),
       m_isServerQueueStatusSet(false),
-      m_connCreatedWhenMaxConnsIsZero(false) {
+      m_connCreatedWhenMaxConnsIsZero(false),
+      m_inFlightOps(0),
+      m_peakInFlightOps(0),
+      m_busyNanos(0),
+      m_connections(0) {
   /*
   m_name = Utils::convertHostToCanonicalForm(m_name.c_str() );
   */
@@ -549,6 +705,12 @@ bool TcrEndpoint::checkDupAndAdd(std::shared_ptr<EventId> eventid) {
 
 void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
   LOGFINE("Started subscription channel for endpoint %s", m_name.c_str());
+  if (m_cacheImpl->getDistributedSystem()
+          .getSystemProperties()
+          .clientConflateEvents()) {
+    startNotificationDispatcher(true);
+  }
+
   while (isRunning) {
     try {
       size_t dataLen;
@@ -575,32 +737,32 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
       }
 
       if (data) {
-        TcrMessageReply msg(true, m_baseDM);
-        msg.initCqMap();
-        msg.setData(data, static_cast<int32_t>(dataLen),
-                    getDistributedMemberID(),
-                    *(m_cacheImpl->getSerializationRegistry()),
-                    *(m_cacheImpl->getMemberListForVersionStamp()));
+        std::unique_ptr<TcrMessageReply> msg(
+            new TcrMessageReply(true, m_baseDM));
+        msg->initCqMap();
+        msg->setData(data, static_cast<int32_t>(dataLen),
+                     getDistributedMemberID(),
+                     *(m_cacheImpl->getSerializationRegistry()),
+                     *(m_cacheImpl->getMemberListForVersionStamp()));
         handleNotificationStats(static_cast<int64_t>(dataLen));
-        LOGDEBUG("receive notification %d", msg.getMessageType());
+        LOGDEBUG("receive notification %d", msg->getMessageType());
 
         if (!isRunning) {
           break;
         }
 
-        if (msg.getMessageType() == TcrMessage::SERVER_TO_CLIENT_PING) {
+        if (msg->getMessageType() == TcrMessage::SERVER_TO_CLIENT_PING) {
           LOGFINE("Received ping from server subscription channel.");
         }
 
         // ignore some message types like REGISTER_INSTANTIATORS
-        if (msg.shouldIgnore()) {
+        if (msg->shouldIgnore()) {
           continue;
         }
 
-        bool isMarker = (msg.getMessageType() == TcrMessage::CLIENT_MARKER);
-        if (!msg.hasCqPart()) {
-          if (msg.getMessageType() != TcrMessage::CLIENT_MARKER) {
-            const std::string& regionFullPath1 = msg.getRegionName();
+        if (!msg->hasCqPart()) {
+          if (msg->getMessageType() != TcrMessage::CLIENT_MARKER) {
+            const std::string& regionFullPath1 = msg->getRegionName();
             auto region1 = m_cacheImpl->getRegion(regionFullPath1);
 
             if (region1 != nullptr &&
@@ -616,7 +778,7 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
           }
         }
 
-        if (!checkDupAndAdd(msg.getEventId())) {
+        if (!checkDupAndAdd(msg->getEventId())) {
           m_dupCount++;
           if (m_dupCount % 100 == 1) {
             LOGFINE("Dropped %dst duplicate notification message", m_dupCount);
@@ -624,34 +786,7 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
           continue;
         }
 
-        if (isMarker) {
-          LOGFINE("Got a marker message on endpont %s", m_name.c_str());
-          m_cacheImpl->processMarker();
-          processMarker();
-        } else {
-          if (!msg.hasCqPart())  // || msg.isInterestListPassed())
-          {
-            const std::string& regionFullPath = msg.getRegionName();
-            auto region = m_cacheImpl->getRegion(regionFullPath);
-
-            if (region != nullptr) {
-              static_cast<ThinClientRegion*>(region.get())
-                  ->receiveNotification(msg);
-            } else {
-              LOGWARN(
-                  "Notification for region %s that does not exist in "
-                  "client cacheImpl.",
-                  regionFullPath.c_str());
-            }
-          } else {
-            LOGDEBUG("receive cq notification %d", msg.getMessageType());
-            auto queryService = getQueryService();
-            if (queryService != nullptr) {
-              static_cast<RemoteQueryService*>(queryService.get())
-                  ->receiveNotification(msg);
-            }
-          }
-        }
+        deliverNotification(std::move(msg));
       }
     } catch (const TimeoutException&) {
       // If there is no notification, this exception is expected
@@ -690,9 +825,80 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
           m_name.c_str());
     }
   }
+  stopNotificationDispatcher();
   LOGFINE("Ended subscription channel for endpoint %s", m_name.c_str());
 }
 
+void TcrEndpoint::startNotificationDispatcher(bool conflate) {
+  m_notificationDispatcher = std::unique_ptr<NotificationDispatcher>(
+      new NotificationDispatcher(*this, conflate,
+                                 m_cacheImpl->getDistributedSystem()
+                                     .getSystemProperties()
+                                     .clientConflateEventsQueueSize()));
+}
+
+void TcrEndpoint::stopNotificationDispatcher() {
+  m_notificationDispatcher.reset();
+}
+
+void TcrEndpoint::deliverNotification(std::unique_ptr<TcrMessageReply> msg) {
+  if (!m_notificationDispatcher && msg->hasCqPart() &&
+      hasCqBatchListener(*msg)) {
+    // from now on CQ events queue up to reach batch listeners together
+    startNotificationDispatcher(false);
+  }
+
+  if (m_notificationDispatcher) {
+    m_notificationDispatcher->push(std::move(msg));
+  } else {
+    dispatchNotification(*msg);
+  }
+}
+
+void TcrEndpoint::dispatchNotification(TcrMessageReply& msg) {
+  if (msg.getMessageType() == TcrMessage::CLIENT_MARKER) {
+    LOGFINE("Got a marker message on endpont %s", m_name.c_str());
+    m_cacheImpl->processMarker();
+    processMarker();
+  } else if (!msg.hasCqPart()) {  // || msg.isInterestListPassed())
+    const std::string& regionFullPath = msg.getRegionName();
+    auto region = m_cacheImpl->getRegion(regionFullPath);
+
+    if (region != nullptr) {
+      static_cast<ThinClientRegion*>(region.get())->receiveNotification(msg);
+    } else {
+      LOGWARN(
+          "Notification for region %s that does not exist in "
+          "client cacheImpl.",
+          regionFullPath.c_str());
+    }
+  } else {
+    LOGDEBUG("receive cq notification %d", msg.getMessageType());
+    auto queryService = getQueryService();
+    if (queryService != nullptr) {
+      static_cast<RemoteQueryService*>(queryService.get())
+          ->receiveNotification(msg);
+    }
+  }
+}
+
+bool TcrEndpoint::hasCqBatchListener(const TcrMessage& msg) {
+  auto queryService = getQueryService();
+  return queryService != nullptr &&
+         static_cast<RemoteQueryService*>(queryService.get())
+             ->hasCqBatchListener(msg);
+}
+
+void TcrEndpoint::dispatchCqNotifications(
+    const std::vector<TcrMessage*>& msgs) {
+  LOGDEBUG("receive %zu cq notifications", msgs.size());
+  auto queryService = getQueryService();
+  if (queryService != nullptr) {
+    static_cast<RemoteQueryService*>(queryService.get())
+        ->receiveNotifications(msgs);
+  }
+}
+
 inline bool TcrEndpoint::compareTransactionIds(int32_t reqTransId,
                                                int32_t replyTransId,
                                                std::string& failReason,
@@ -746,49 +952,48 @@ GfErrType TcrEndpoint::sendRequestConn(const TcrMessage& request,
                                        TcrMessageReply& reply,
                                        TcrConnection* conn,
                                        std::string& failReason) {
+  auto receiveTimeout = writeRequestConn(request, reply, conn);
+  return readReplyConn(request, reply, conn, receiveTimeout, failReason);
+}
+
+std::chrono::microseconds TcrEndpoint::writeRequestConn(
+    const TcrMessage& request, TcrMessageReply& reply, TcrConnection* conn) {
   int32_t type = request.getMessageType();
-  GfErrType error = GF_NOERR;
 
   LOGFINER("Sending request type %d to endpoint [%s] via connection [%p]", type,
            m_name.c_str(), conn);
   // TcrMessage * req = const_cast<TcrMessage *>(&request);
   LOGDEBUG("TcrEndpoint::sendRequestConn  = %p", m_baseDM);
   if (m_baseDM != nullptr) m_baseDM->beforeSendingRequest(request, conn);
-  if (type == TcrMessage::REGISTER_INTEREST_LIST ||
-      type == TcrMessage::REGISTER_INTEREST || type == TcrMessage::QUERY ||
-      type == TcrMessage::QUERY_WITH_PARAMETERS ||
-      type == TcrMessage::GET_ALL_70 ||
-      type == TcrMessage::GET_ALL_WITH_CALLBACK || type == TcrMessage::PUTALL ||
-      type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
-      type == TcrMessage::REMOVE_ALL ||
-      ((type == TcrMessage::EXECUTE_FUNCTION ||
-        type == TcrMessage::EXECUTE_REGION_FUNCTION) &&
-       (request.hasResult() & 2)) ||
-      type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-      type == TcrMessage::EXECUTECQ_MSG_TYPE ||
-      type == TcrMessage::STOPCQ_MSG_TYPE ||
-      type == TcrMessage::CLOSECQ_MSG_TYPE || type == TcrMessage::KEY_SET ||
-      type == TcrMessage::CLOSECLIENTCQS_MSG_TYPE ||
-      type == TcrMessage::GETCQSTATS_MSG_TYPE ||
-      type == TcrMessage::MONITORCQ_MSG_TYPE ||
-      type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE ||
-      type == TcrMessage::GETDURABLECQS_MSG_TYPE) {
-    conn->sendRequestForChunkedResponse(request, request.getMsgLength(), reply,
-                                        request.getTimeout(),
-                                        reply.getTimeout());
+  if (hasChunkedReply(request)) {
+    return conn->sendRequestForChunkedResponseAsync(
+        request, request.getMsgLength(), reply, request.getTimeout(),
+        reply.getTimeout());
+  }
+
+  // Chk request type to request if so request.getCallBackArg flag & setCall
+  // back arg flag to true, and in response chk for this flag.
+  if (request.getMessageType() == TcrMessage::REQUEST) {
+    if (request.isCallBackArguement()) {
+      reply.setCallBackArguement(true);
+    }
+  }
+  return conn->sendRequestAsync(request.getMsgData(), request.getMsgLength(),
+                                request.getTimeout(), reply.getTimeout());
+}
+
+GfErrType TcrEndpoint::readReplyConn(
+    const TcrMessage& request, TcrMessageReply& reply, TcrConnection* conn,
+    std::chrono::microseconds receiveTimeout, std::string& failReason) {
+  int32_t type = request.getMessageType();
+  GfErrType error = GF_NOERR;
+
+  if (hasChunkedReply(request)) {
+    conn->receiveChunkedResponse(request, reply, receiveTimeout);
     LOGDEBUG("sendRequestConn: calling sendRequestForChunkedResponse DONE");
   } else {
-    // Chk request type to request if so request.getCallBackArg flag & setCall
-    // back arg flag to true, and in response chk for this flag.
-    if (request.getMessageType() == TcrMessage::REQUEST) {
-      if (request.isCallBackArguement()) {
-        reply.setCallBackArguement(true);
-      }
-    }
     size_t dataLen;
-    auto data = conn->sendRequest(request.getMsgData(), request.getMsgLength(),
-                                  &dataLen, request.getTimeout(),
-                                  reply.getTimeout(), request.getMessageType());
+    auto data = conn->receiveResponse(&dataLen, receiveTimeout, type);
     reply.setMessageTypeRequest(type);
     reply.setData(
         data, static_cast<int32_t>(dataLen), getDistributedMemberID(),
@@ -836,6 +1041,134 @@ GfErrType TcrEndpoint::sendRequestConn(const TcrMessage& request,
   return error;
 }
 
+bool TcrEndpoint::hasChunkedReply(const TcrMessage& request) {
+  int32_t type = request.getMessageType();
+  return type == TcrMessage::REGISTER_INTEREST_LIST ||
+         type == TcrMessage::REGISTER_INTEREST || type == TcrMessage::QUERY ||
+         type == TcrMessage::QUERY_WITH_PARAMETERS ||
+         type == TcrMessage::GET_ALL_70 ||
+         type == TcrMessage::GET_ALL_WITH_CALLBACK ||
+         type == TcrMessage::PUTALL ||
+         type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
+         type == TcrMessage::REMOVE_ALL ||
+         ((type == TcrMessage::EXECUTE_FUNCTION ||
+           type == TcrMessage::EXECUTE_REGION_FUNCTION) &&
+          (request.hasResult() & 2)) ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
+         type == TcrMessage::EXECUTECQ_MSG_TYPE ||
+         type == TcrMessage::STOPCQ_MSG_TYPE ||
+         type == TcrMessage::CLOSECQ_MSG_TYPE || type == TcrMessage::KEY_SET ||
+         type == TcrMessage::CLOSECLIENTCQS_MSG_TYPE ||
+         type == TcrMessage::GETCQSTATS_MSG_TYPE ||
+         type == TcrMessage::MONITORCQ_MSG_TYPE ||
+         type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE ||
+         type == TcrMessage::GETDURABLECQS_MSG_TYPE;
+}
+
+GfErrType TcrEndpoint::sendRequestConnAsync(
+    const TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+    std::chrono::microseconds& receiveTimeout, bool isBgThread) {
+  if (!connected_) {
+    return GF_NOTCON;
+  }
+  return withoutRetry(request, reply, conn, isBgThread,
+                      [&](std::string&) {
+                        receiveTimeout = writeRequestConn(request, reply, conn);
+                        return GF_NOERR;
+                      });
+}
+
+GfErrType TcrEndpoint::receiveRequestConnReply(
+    const TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+    std::chrono::microseconds receiveTimeout, bool isBgThread) {
+  auto error = withoutRetry(
+      request, reply, conn, isBgThread, [&](std::string& failReason) {
+        return readReplyConn(request, reply, conn, receiveTimeout, failReason);
+      });
+  if (error == GF_NOERR) {
+    m_msgSent = true;
+  }
+  return error;
+}
+
+GfErrType TcrEndpoint::withoutRetry(
+    const TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+    bool isBgThread,
+    const std::function<GfErrType(std::string&)>& operation) {
+  // the error handling of one attempt in sendRequestWithRetry
+  GfErrType error;
+  bool epFailure = false;
+  std::string failReason;
+  int reqTransId = request.getTransId();
+  try {
+    error = operation(failReason);
+    if (error == GF_IOERR) {
+      epFailure = true;
+      failReason = "received INVALID reply from server";
+      handleIOException(failReason, conn, isBgThread);
+    } else if (error == GF_NOTCON) {
+      epFailure = true;
+    }
+  } catch (const TimeoutException&) {
+    error = GF_TIMEOUT;
+    LOGFINE(
+        "Send timed out for endpoint %s. "
+        "Message txid = %d",
+        m_name.c_str(), reqTransId);
+    closeFailedConnection(conn);
+    int32_t type = request.getMessageType();
+    epFailure = (type != TcrMessage::QUERY && type != TcrMessage::PUTALL &&
+                 type != TcrMessage::PUT_ALL_WITH_CALLBACK &&
+                 type != TcrMessage::EXECUTE_FUNCTION &&
+                 type != TcrMessage::EXECUTE_REGION_FUNCTION &&
+                 type != TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP &&
+                 type != TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE);
+    failReason = "timed out waiting for endpoint";
+  } catch (const GeodeIOException& ex) {
+    error = GF_IOERR;
+    epFailure = true;
+    failReason = "IO error for endpoint";
+    handleIOException(ex.what(), conn, isBgThread);
+  } catch (const Exception& ex) {
+    failReason = ex.getName();
+    failReason.append(": ");
+    failReason.append(ex.what());
+    LOGWARN("Error during send for endpoint %s due to %s", m_name.c_str(),
+            failReason.c_str());
+    if (compareTransactionIds(reqTransId, reply.getTransId(), failReason,
+                              conn)) {
+      LOGWARN("Stack trace: %s", ex.getStackTrace().c_str());
+      error = GF_MSG;
+      closeConnection(conn);
+    } else {
+      error = GF_NOTCON;
+      epFailure = true;
+    }
+  } catch (...) {
+    failReason = "unexpected exception";
+    LOGERROR(
+        "Unexpected exception while sending request to "
+        "endpoint %s",
+        m_name.c_str());
+    if (compareTransactionIds(reqTransId, reply.getTransId(), failReason,
+                              conn)) {
+      error = GF_MSG;
+      closeConnection(conn);
+    } else {
+      error = GF_NOTCON;
+      epFailure = true;
+    }
+  }
+
+  if (error != GF_NOERR && epFailure) {
+    LOGFINE("Giving up for endpoint %s; reason: %s.", m_name.c_str(),
+            failReason.c_str());
+    setConnectionStatus(false);
+  }
+
+  return error;
+}
+
 bool TcrEndpoint::isMultiUserMode() {
   LOGDEBUG("TcrEndpoint::isMultiUserMode %d", m_isMultiUserMode);
   return m_isMultiUserMode;
@@ -1253,6 +1586,28 @@ void TcrEndpoint::setServerQueueStatus(ServerQueueStatus queueStatus,
 
 bool TcrEndpoint::isQueueHosted() { return m_isQueueHosted; }
 
+void TcrEndpoint::beginOperation() {
+  auto inFlight = ++m_inFlightOps;
+  auto peak = m_peakInFlightOps.load();
+  while (inFlight > peak &&
+         !m_peakInFlightOps.compare_exchange_weak(peak, inFlight)) {
+  }
+}
+
+void TcrEndpoint::endOperation(std::chrono::nanoseconds duration) {
+  --m_inFlightOps;
+  m_busyNanos += duration.count();
+}
+
+int32_t TcrEndpoint::takePeakInFlightOperations() {
+  // Start the next interval's peak at what is in flight now.
+  return m_peakInFlightOps.exchange(m_inFlightOps);
+}
+
+std::chrono::nanoseconds TcrEndpoint::takeBusyTime() {
+  return std::chrono::nanoseconds(m_busyNanos.exchange(0));
+}
+
 void TcrEndpoint::processMarker() {
   m_cacheImpl->tcrConnectionManager().processMarker();
 }
@@ -1267,6 +1622,8 @@ void TcrEndpoint::closeFailedConnection(TcrConnection*& conn) {
 
 void TcrEndpoint::handleNotificationStats(int64_t) {}
 
+void TcrEndpoint::handleConflatedNotification() {}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
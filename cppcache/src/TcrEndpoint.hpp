@@ -21,11 +21,14 @@
 #define GEODE_TCRENDPOINT_H_
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <geode/internal/geode_base.hpp>
 #include <geode/internal/geode_globals.hpp>
@@ -42,6 +45,7 @@ namespace client {
 
 class ThinClientRegion;
 class TcrMessage;
+class TcrMessageReply;
 class ThinClientBaseDM;
 class CacheImpl;
 class ThinClientPoolHADM;
@@ -86,6 +90,19 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
                                      TcrConnection*& conn,
                                      bool isBgThread = false);
 
+  // Send request on conn and read its reply in two steps, so that one thread
+  // can have requests in flight to several servers at once. Neither retries;
+  // on error conn may have been closed and set to nullptr.
+  GfErrType sendRequestConnAsync(const TcrMessage& request,
+                                 TcrMessageReply& reply, TcrConnection*& conn,
+                                 std::chrono::microseconds& receiveTimeout,
+                                 bool isBgThread = false);
+  GfErrType receiveRequestConnReply(const TcrMessage& request,
+                                    TcrMessageReply& reply,
+                                    TcrConnection*& conn,
+                                    std::chrono::microseconds receiveTimeout,
+                                    bool isBgThread = false);
+
   void stopNotifyReceiverAndCleanup();
   void stopNoBlock();
 
@@ -169,6 +186,18 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
 
   int32_t numberOfTimesFailed() { return m_numberOfTimesFailed; }
 
+  // Load of pool operations on this endpoint, sampled by adaptive sizing.
+  void beginOperation();
+  void endOperation(std::chrono::nanoseconds duration);
+  int32_t getInFlightOperations() const { return m_inFlightOps; }
+  int32_t takePeakInFlightOperations();
+  std::chrono::nanoseconds takeBusyTime();
+
+  // Open connections to this endpoint, used to place new pool connections.
+  void connectionOpened() { ++m_connections; }
+  void connectionClosed() { --m_connections; }
+  int32_t getConnectionCount() const { return m_connections; }
+
   virtual uint16_t getDistributedMemberID() { return m_distributedMemId; }
   virtual void setDistributedMemberID(uint16_t memId) {
     m_distributedMemId = memId;
@@ -189,6 +218,7 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   bool m_isQueueHosted;
 
   static const char* NC_Notification;
+  static const char* NC_Notification_Dispatcher;
 
   std::shared_ptr<Properties> getCredentials();
   virtual bool checkDupAndAdd(std::shared_ptr<EventId> eventid);
@@ -198,12 +228,37 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   virtual void closeFailedConnection(TcrConnection*& conn);
   void closeConnection(TcrConnection*& conn);
   virtual void handleNotificationStats(int64_t byteLength);
+  virtual void handleConflatedNotification();
+  virtual void dispatchNotification(TcrMessageReply& msg);
+  virtual void dispatchCqNotifications(const std::vector<TcrMessage*>& msgs);
+  virtual bool hasCqBatchListener(const TcrMessage& msg);
+
+  /**
+   * Starts applying the notifications passed to deliverNotification on a
+   * dispatcher thread, which conflates the ones it has not got to yet if
+   * conflate is true.
+   */
+  void startNotificationDispatcher(bool conflate);
+
+  /**
+   * Drops the notifications still queued and stops the dispatcher thread
+   * once the one being applied is done.
+   */
+  void stopNotificationDispatcher();
+
+  /**
+   * Queues msg to the dispatcher if it is started, or applies it. Starts the
+   * dispatcher for the first CQ event that reaches a CqBatchListener.
+   */
+  void deliverNotification(std::unique_ptr<TcrMessageReply> msg);
   virtual void closeNotification();
 
   virtual bool handleIOException(const std::string& message,
                                  TcrConnection*& conn, bool isBgThread = false);
 
  private:
+  class NotificationDispatcher;
+
   int64_t m_uniqueId;
   binary_semaphore& failover_semaphore_;
   binary_semaphore& cleanup_semaphore_;
@@ -232,11 +287,28 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   uint16_t m_distributedMemId;
   bool m_isServerQueueStatusSet;
   volatile bool m_connCreatedWhenMaxConnsIsZero;
+  std::atomic<int32_t> m_inFlightOps;
+  std::atomic<int32_t> m_peakInFlightOps;
+  std::atomic<int64_t> m_busyNanos;
+  std::atomic<int32_t> m_connections;
+  std::unique_ptr<NotificationDispatcher> m_notificationDispatcher;
 
   bool compareTransactionIds(int32_t reqTransId, int32_t replyTransId,
                              std::string& failReason, TcrConnection* conn);
   void closeConnections();
   void setRetry(const TcrMessage& request, int& maxSendRetries);
+  static bool hasChunkedReply(const TcrMessage& request);
+  std::chrono::microseconds writeRequestConn(const TcrMessage& request,
+                                             TcrMessageReply& reply,
+                                             TcrConnection* conn);
+  GfErrType readReplyConn(const TcrMessage& request, TcrMessageReply& reply,
+                          TcrConnection* conn,
+                          std::chrono::microseconds receiveTimeout,
+                          std::string& failReason);
+  GfErrType withoutRetry(
+      const TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+      bool isBgThread,
+      const std::function<GfErrType(std::string&)>& operation);
 };
 }  // namespace client
 }  // namespace geode
@@ -143,6 +143,10 @@ void TcrPoolEndPoint::handleNotificationStats(int64_t byteLength) {
   m_dm->getStats().incMessageBeingReceived();
 }
 
+void TcrPoolEndPoint::handleConflatedNotification() {
+  m_dm->getStats().incClientEventsConflated();
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
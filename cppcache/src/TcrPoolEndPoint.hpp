@@ -50,6 +50,7 @@ class TcrPoolEndPoint : public TcrEndpoint {
   bool handleIOException(const std::string& message, TcrConnection*& conn,
                          bool isBgThread = false) override;
   void handleNotificationStats(int64_t byteLength) override;
+  void handleConflatedNotification() override;
   ~TcrPoolEndPoint() override { m_dm = nullptr; }
   bool isMultiUserMode() override;
 
@@ -49,7 +49,7 @@ namespace client {
 const size_t DEFAULT_CONNECTION_RETRIES = 3;
 
 ThinClientLocatorHelper::ThinClientLocatorHelper(
-    const std::vector<std::string>& locators, const ThinClientPoolDM* poolDM)
+    const std::vector<std::string>& locators, ThinClientPoolDM* poolDM)
     : locators_(locators.begin(), locators.end()),
       m_poolDM(poolDM),
       m_sniProxyHost(""),
@@ -57,7 +57,7 @@ ThinClientLocatorHelper::ThinClientLocatorHelper(
 
 ThinClientLocatorHelper::ThinClientLocatorHelper(
     const std::vector<std::string>& locators, const std::string& sniProxyHost,
-    int sniProxyPort, const ThinClientPoolDM* poolDM)
+    int sniProxyPort, ThinClientPoolDM* poolDM)
     : locators_(locators.begin(), locators.end()),
       m_poolDM(poolDM),
       m_sniProxyHost(sniProxyHost),
@@ -96,21 +96,27 @@ std::unique_ptr<Connector> ThinClientLocatorHelper::createConnection(
   const auto& hostname = location.getServerName();
   auto buffer_size = m_poolDM->getSocketBufferSize();
 
+  auto& resolver =
+      m_poolDM->getConnectionManager().getCacheImpl()->getDnsResolver();
+
   if (sys_prop.sslEnabled()) {
+    auto& ssl_context =
+        m_poolDM->getConnectionManager().getCacheImpl()->getSslContext();
+    std::unique_ptr<TcpSslConn> conn;
     if (m_sniProxyHost.empty()) {
-      return std::unique_ptr<Connector>(new TcpSslConn(
-          hostname, static_cast<uint16_t>(port), timeout, buffer_size,
-          sys_prop.sslTrustStore(), sys_prop.sslKeyStore(),
-          sys_prop.sslKeystorePassword()));
+      conn.reset(new TcpSslConn(hostname, static_cast<uint16_t>(port), timeout,
+                                buffer_size, resolver, ssl_context));
     } else {
-      return std::unique_ptr<Connector>(new TcpSslConn(
-          hostname, static_cast<uint16_t>(port), m_sniProxyHost, m_sniProxyPort,
-          timeout, buffer_size, sys_prop.sslTrustStore(),
-          sys_prop.sslKeyStore(), sys_prop.sslKeystorePassword()));
+      conn.reset(new TcpSslConn(hostname, static_cast<uint16_t>(port),
+                                m_sniProxyHost, m_sniProxyPort, timeout,
+                                buffer_size, resolver, ssl_context));
     }
+    m_poolDM->getStats().incSslHandshakes(conn->isSessionReused(),
+                                          conn->getHandshakeTime());
+    return std::unique_ptr<Connector>(std::move(conn));
   } else {
     return std::unique_ptr<Connector>(new TcpConn(
-        hostname, static_cast<uint16_t>(port), timeout, buffer_size));
+        hostname, static_cast<uint16_t>(port), timeout, buffer_size, resolver));
   }
 }
 
@@ -48,10 +48,10 @@ class ThinClientLocatorHelper {
   ThinClientLocatorHelper& operator=(const ThinClientLocatorHelper&) = delete;
 
   ThinClientLocatorHelper(const std::vector<std::string>& locators,
-                          const ThinClientPoolDM* poolDM);
+                          ThinClientPoolDM* poolDM);
   ThinClientLocatorHelper(const std::vector<std::string>& locators,
                           const std::string& sniProxyHost, int sniProxyPort,
-                          const ThinClientPoolDM* poolDM);
+                          ThinClientPoolDM* poolDM);
   GfErrType getEndpointForNewFwdConn(
       ServerLocation& outEndpoint, std::string& additionalLoc,
       const std::set<ServerLocation>& exclEndPts,
@@ -110,7 +110,7 @@ class ThinClientLocatorHelper {
    */
   mutable boost::shared_mutex mutex_;
   std::vector<ServerLocation> locators_;
-  const ThinClientPoolDM* m_poolDM;
+  ThinClientPoolDM* m_poolDM;
   std::string m_sniProxyHost;
   int m_sniProxyPort;
 };
@@ -18,7 +18,10 @@
 #include "ThinClientPoolDM.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <exception>
 #include <thread>
+#include <unordered_map>
 
 #include <geode/AuthInitialize.hpp>
 #include <geode/PoolManager.hpp>
@@ -63,7 +66,7 @@ class GetAllWork : public PooledWork<GfErrType> {
   std::string m_regionName;
   const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_keys;
   const std::shared_ptr<Region> m_region;
-  TcrChunkedResult* m_resultCollector;
+  ChunkedGetAllResponse* m_resultCollector;
   const std::shared_ptr<Serializable>& m_aCallbackArgument;
 
  public:
@@ -127,10 +130,73 @@ class GetAllWork : public PooledWork<GfErrType> {
   }
 };
 
+class PrefillWork : public PooledWork<bool> {
+  ThinClientPoolDM* m_poolDM;
+  std::atomic<bool>& m_isRunning;
+
+ public:
+  PrefillWork(ThinClientPoolDM* poolDM, std::atomic<bool>& isRunning)
+      : m_poolDM(poolDM), m_isRunning(isRunning) {}
+
+  bool execute() override {
+    m_poolDM->prefillConnections(m_isRunning);
+    return true;
+  }
+};
+
+// Records an operation's time on its endpoint for adaptive sizing.
+class EndpointOperation {
+ public:
+  explicit EndpointOperation(TcrEndpoint* endpoint)
+      : endpoint_(endpoint), start_(std::chrono::steady_clock::now()) {
+    if (endpoint_) {
+      endpoint_->beginOperation();
+    }
+  }
+
+  ~EndpointOperation() {
+    if (endpoint_) {
+      endpoint_->endOperation(std::chrono::steady_clock::now() - start_);
+    }
+  }
+
+  EndpointOperation(const EndpointOperation&) = delete;
+  EndpointOperation& operator=(const EndpointOperation&) = delete;
+
+ private:
+  TcrEndpoint* endpoint_;
+  std::chrono::steady_clock::time_point start_;
+};
+
 const char* ThinClientPoolDM::NC_Ping_Thread = "NC Ping Thread";
 const char* ThinClientPoolDM::NC_MC_Thread = "NC MC Thread";
+const char* ThinClientPoolDM::NC_AS_Thread = "NC AS Thread";
 #define PRIMARY_QUEUE_NOT_AVAILABLE -2
 
+namespace {
+
+// Bounds on the keys per single hop getAll message to one server.
+constexpr size_t GETALL_BATCH_TARGET_BYTES = 4 * 1024 * 1024;
+constexpr size_t GETALL_BATCH_MIN_KEYS = 100;
+constexpr size_t GETALL_BATCH_MAX_KEYS = 100000;
+constexpr size_t GETALL_BATCH_INITIAL_KEYS = 1000;
+
+// Requests that carry their own timeout instead of the pool read timeout,
+// and whose timeout is not retried on another server.
+bool hasOwnTimeout(const TcrMessage& request) {
+  auto type = request.getMessageType();
+  return type == TcrMessage::QUERY ||
+         type == TcrMessage::QUERY_WITH_PARAMETERS ||
+         type == TcrMessage::PUTALL ||
+         type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
+         type == TcrMessage::EXECUTE_FUNCTION ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
+         type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE;
+}
+
+}  // namespace
+
 ThinClientPoolDM::ThinClientPoolDM(const char* name,
                                    std::shared_ptr<PoolAttributes> poolAttrs,
                                    TcrConnectionManager& connManager)
@@ -146,15 +212,22 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       m_destroyPendingHADM(false),
       m_isMultiUserMode(false),
       m_locHelper(nullptr),
+      m_getAllBatchSizer(GETALL_BATCH_TARGET_BYTES, GETALL_BATCH_MIN_KEYS,
+                         GETALL_BATCH_MAX_KEYS, GETALL_BATCH_INITIAL_KEYS),
       m_poolSize(0),
       m_numRegions(0),
       m_server(0),
       conn_semaphore_(0),
+      adaptive_sizing_semaphore_(0),
       m_connManageTask(nullptr),
       m_pingTask(nullptr),
       m_updateLocatorListTask(nullptr),
       m_clientOps(0),
       connected_endpoints_(0),
+      m_prefillMissing(0),
+      m_prefillAttempts(0),
+      m_prefillRestored(0),
+      m_poolReady(false),
       m_PoolStatsSampler(nullptr),
       m_clientMetadataService(nullptr),
       m_primaryServerQueueSize(PRIMARY_QUEUE_NOT_AVAILABLE) {
@@ -191,6 +264,12 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
   m_locHelper = new ThinClientLocatorHelper(m_attrs->m_initLocList,
                                             m_attrs->m_sniProxyHost,
                                             m_attrs->m_sniProxyPort, this);
+  auto snapshotInterval = m_attrs->getServerSnapshotInterval();
+  if (!m_attrs->m_initLocList.empty() &&
+      snapshotInterval > std::chrono::milliseconds::zero()) {
+    m_serverSnapshot = std::unique_ptr<ServerLoadSnapshot>(
+        new ServerLoadSnapshot(snapshotInterval));
+  }
 
   m_stats = new PoolStats(
       cacheImpl->getStatisticsManager().getStatisticsFactory(), m_poolName);
@@ -227,7 +306,22 @@ void ThinClientPoolDM::init() {
 
   m_connManager.init(true);
 
+  m_startTime = std::chrono::steady_clock::now();
   ThinClientPoolDM::startBackgroundThreads();
+  checkPoolReady();
+
+  auto timeout = m_attrs->getPrefillTimeout();
+  if (timeout > std::chrono::milliseconds::zero()) {
+    std::unique_lock<std::mutex> lock(m_poolReadyMutex);
+    if (!m_poolReadyCondition.wait_for(lock, timeout,
+                                       [this] { return m_poolReady.load(); })) {
+      LOGWARN(
+          "ThinClientPoolDM::init: pool %s has %d of %d minimum connections "
+          "after waiting %s",
+          m_poolName.c_str(), m_poolSize.load(), getMinConnections(),
+          to_string(timeout).c_str());
+    }
+  }
 
   LOGDEBUG("ThinClientPoolDM::init: Completed initialization");
 }
@@ -319,6 +413,10 @@ void ThinClientPoolDM::startBackgroundThreads() {
       std::unique_ptr<Task<ThinClientPoolDM>>(new Task<ThinClientPoolDM>(
           this, &ThinClientPoolDM::manageConnections, NC_MC_Thread));
   m_connManageTask->start();
+  if (getMinConnections() > 0) {
+    // Fill the pool now rather than on the first scheduled run.
+    conn_semaphore_.release();
+  }
 
   auto idle = getIdleTimeout();
   auto load = getLoadConditioningInterval();
@@ -343,6 +441,22 @@ void ThinClientPoolDM::startBackgroundThreads() {
         manager.schedule(std::move(task), std::chrono::seconds(1), idle);
   }
 
+  if (m_attrs->getAdaptiveSizingEnabled()) {
+    LOGDEBUG(
+        "ThinClientPoolDM::startBackgroundThreads: Starting adaptive sizing "
+        "thread");
+    m_adaptiveSizingTask =
+        std::unique_ptr<Task<ThinClientPoolDM>>(new Task<ThinClientPoolDM>(
+            this, &ThinClientPoolDM::adaptConnections, NC_AS_Thread));
+    m_adaptiveSizingTask->start();
+
+    auto& manager = m_connManager.getCacheImpl()->getExpiryTaskManager();
+    auto task = std::make_shared<FunctionExpiryTask>(
+        manager, [this] { adaptive_sizing_semaphore_.release(); });
+    adaptive_sizing_task_id_ = manager.schedule(
+        std::move(task), std::chrono::seconds(1), std::chrono::seconds(1));
+  }
+
   LOGDEBUG(
       "ThinClientPoolDM::startBackgroundThreads: Starting remote query "
       "service");
@@ -528,27 +642,215 @@ void ThinClientPoolDM::restoreMinConnections(std::atomic<bool>& isRunning) {
   LOGDEBUG("Restoring minimum connection level");
 
   int min = m_attrs->getMinConnections();
-  int limit = 2 * min;
+  int missing = min - m_poolSize;
 
+  m_prefillRestored = 0;
+
+  if (missing > 0) {
+    m_prefillMissing = missing;
+    m_prefillAttempts = 2 * min;
+
+    // Connections are opened by this thread and up to parallelism - 1
+    // works on the cache's thread pool, which all stop when this thread is
+    // asked to.
+    auto helpers = std::min(m_attrs->getPrefillParallelism(), missing) - 1;
+    auto& threadPool = m_connManager.getCacheImpl()->getThreadPool();
+    std::vector<std::shared_ptr<PrefillWork>> works;
+    for (int i = 0; i < helpers; i++) {
+      auto work = std::make_shared<PrefillWork>(this, isRunning);
+      threadPool.perform(work);
+      works.push_back(std::move(work));
+    }
+
+    prefillConnections(isRunning);
+
+    for (auto& work : works) {
+      work->getResult();
+    }
+  }
+
+  LOGDEBUG("Restored %d connections", m_prefillRestored.load());
+  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+}
+
+void ThinClientPoolDM::prefillConnections(std::atomic<bool>& isRunning) {
+  // Each thread keeps its own excluded servers so that one failing server
+  // does not stop the others from connecting to it on their next attempt.
   std::set<ServerLocation> excludeServers;
 
-  int restored = 0;
+  while (isRunning && m_prefillAttempts-- > 0) {
+    if (m_prefillMissing-- <= 0) {
+      ++m_prefillMissing;
+      break;
+    }
 
-  if (m_poolSize < min) {
-    while (m_poolSize < min && limit-- && isRunning) {
-      TcrConnection* conn = nullptr;
+    TcrConnection* conn = nullptr;
+    try {
       bool maxConnLimit = false;
       createPoolConnection(conn, excludeServers, maxConnLimit);
-      if (conn) {
-        put(conn, false);
-        restored++;
-        getStats().incMinPoolSizeConnects();
+    } catch (const Exception& e) {
+      LOGERROR("ThinClientPoolDM::prefillConnections: Geode Exception: \"%s\"",
+               e.what());
+    } catch (const std::exception& e) {
+      LOGERROR(
+          "ThinClientPoolDM::prefillConnections: Standard exception: \"%s\"",
+          e.what());
+    } catch (...) {
+      LOGERROR("ThinClientPoolDM::prefillConnections: Unexpected exception");
+    }
+
+    if (conn) {
+      put(conn, false);
+      ++m_prefillRestored;
+      getStats().incMinPoolSizeConnects();
+      checkPoolReady();
+    } else {
+      ++m_prefillMissing;
+    }
+  }
+}
+
+void ThinClientPoolDM::checkPoolReady() {
+  if (m_poolSize < m_attrs->getMinConnections() || m_poolReady.exchange(true)) {
+    return;
+  }
+
+  auto timeToReady = std::chrono::steady_clock::now() - m_startTime;
+  getStats().setTimeToReady(timeToReady);
+  LOGFINE("Pool %s reached %d minimum connections in %s", m_poolName.c_str(),
+          getMinConnections(), to_string(timeToReady).c_str());
+
+  std::lock_guard<std::mutex> guard(m_poolReadyMutex);
+  m_poolReadyCondition.notify_all();
+}
+
+void ThinClientPoolDM::adaptConnections(std::atomic<bool>& isRunning) {
+  LOGFINE("Starting adaptive sizing thread for pool %s", m_poolName.c_str());
+
+  auto lastSample = std::chrono::steady_clock::now();
+  adaptive_sizing_semaphore_.acquire();
+  while (isRunning) {
+    auto now = std::chrono::steady_clock::now();
+    if (!m_connManager.isNetDown()) {
+      try {
+        adaptConnectionsInternal(now - lastSample, isRunning);
+      } catch (const Exception& e) {
+        LOGERROR("ThinClientPoolDM::adaptConnections: Geode Exception: \"%s\"",
+                 e.what());
+      } catch (const std::exception& e) {
+        LOGERROR(
+            "ThinClientPoolDM::adaptConnections: Standard exception: \"%s\"",
+            e.what());
+      } catch (...) {
+        LOGERROR("ThinClientPoolDM::adaptConnections: Unexpected exception");
       }
     }
+    lastSample = now;
+
+    adaptive_sizing_semaphore_.acquire();
   }
 
-  LOGDEBUG("Restored %d connections", restored);
-  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+  LOGFINE("Ending adaptive sizing thread for pool %s", m_poolName.c_str());
+}
+
+void ThinClientPoolDM::adaptConnectionsInternal(
+    std::chrono::nanoseconds interval, std::atomic<bool>& isRunning) {
+  // Only checkouts that found no idle connection and blocked count as
+  // waiting, see ConnectionQueue::takeBlockedTime.
+  auto waitTime = takeBlockedTime();
+
+  std::vector<std::shared_ptr<TcrEndpoint>> endpoints;
+  {
+    std::lock_guard<decltype(m_endpointsLock)> guard(m_endpointsLock);
+    for (const auto& it : m_endpoints) {
+      if (it.second->connected()) {
+        endpoints.push_back(it.second);
+      }
+    }
+  }
+
+  std::unordered_map<TcrEndpoint*, int32_t> idle;
+  {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    for (const auto& conn : queue_) {
+      ++idle[conn->getEndpointObject()];
+    }
+  }
+
+  std::vector<AdaptivePoolSizer::EndpointLoad> loads;
+  loads.reserve(endpoints.size());
+  for (const auto& ep : endpoints) {
+    loads.push_back({idle[ep.get()] + ep->getInFlightOperations(),
+                     ep->takePeakInFlightOperations(), ep->takeBusyTime()});
+  }
+
+  auto targets = AdaptivePoolSizer(getMinConnections(), getMaxConnections())
+                     .resize(loads, interval, waitTime);
+
+  int32_t target = 0;
+  int32_t opened = 0;
+  int32_t closed = 0;
+  for (size_t i = 0; i < endpoints.size() && isRunning; i++) {
+    auto ep = endpoints[i].get();
+    target += targets[i];
+
+    for (auto n = targets[i] - loads[i].connections; n > 0 && isRunning; n--) {
+      TcrConnection* conn = nullptr;
+      bool maxConnLimit = false;
+      if (createPoolConnectionToAEndPoint(conn, ep, maxConnLimit) !=
+              GF_NOERR ||
+          conn == nullptr) {
+        break;
+      }
+      put(conn, false);
+      ++opened;
+    }
+
+    // Leave connections to servers hosting our subscription queue to the
+    // idle timeout, as canItBeDeleted does.
+    if (ep->isQueueHosted()) {
+      continue;
+    }
+
+    for (auto n = loads[i].connections - targets[i]; n > 0; n--) {
+      auto conn = getFromEP(ep);
+      if (conn == nullptr) {
+        break;
+      }
+      try {
+        GF_SAFE_DELETE_CON(conn);
+      } catch (...) {
+      }
+      removeEPConnections(1, false);
+      ++closed;
+    }
+  }
+
+  getStats().setAdaptiveTargetConnections(target);
+  if (opened > 0) {
+    getStats().incAdaptiveConnects(opened);
+  }
+  if (closed > 0) {
+    getStats().incAdaptiveDisconnects(closed);
+  }
+  getStats().setCurPoolConnections(m_poolSize);
+
+  LOGDEBUG("Adaptive sizing opened %d and closed %d connections, target %d",
+           opened, closed, target);
+}
+
+void ThinClientPoolDM::stopAdaptiveSizingThread() {
+  if (m_adaptiveSizingTask) {
+    LOGFINE("ThinClientPoolDM::destroy(): Closing adaptive sizing thread.");
+    m_adaptiveSizingTask->stopNoblock();
+    adaptive_sizing_semaphore_.release();
+    m_adaptiveSizingTask->wait();
+    m_adaptiveSizingTask = nullptr;
+    if (adaptive_sizing_task_id_ != ExpiryTask::invalid()) {
+      auto& manager = m_connManager.getCacheImpl()->getExpiryTaskManager();
+      manager.cancel(adaptive_sizing_task_id_);
+    }
+  }
 }
 
 void ThinClientPoolDM::manageConnectionsInternal(std::atomic<bool>& isRunning) {
@@ -578,6 +880,12 @@ std::string ThinClientPoolDM::selectEndpoint(
     std::set<ServerLocation>& excludeServers,
     const TcrConnection* currentServer) {
   if (!m_attrs->m_initLocList.empty()) {  // query locators
+    std::string snapshotEndpoint;
+    if (currentServer == nullptr && m_serverSnapshot &&
+        selectEndpointFromSnapshot(excludeServers, snapshotEndpoint)) {
+      return snapshotEndpoint;
+    }
+
     ServerLocation outEndpoint;
     std::string additionalLoc;
     LOGFINE("Asking locator for server from group [%s]",
@@ -631,6 +939,48 @@ std::string ThinClientPoolDM::selectEndpoint(
   }
 }
 
+bool ThinClientPoolDM::selectEndpointFromSnapshot(
+    const std::set<ServerLocation>& excludeServers, std::string& epNameStr) {
+  if (m_serverSnapshot->claimRefresh()) {
+    std::vector<std::shared_ptr<ServerLocation>> servers;
+    try {
+      getStats().incLoctorRequests();
+      m_locHelper->getAllServers(servers, m_attrs->m_serverGrp);
+    } catch (...) {
+      m_serverSnapshot->refreshFailed();
+      throw;
+    }
+
+    std::vector<ServerLocation> locations;
+    locations.reserve(servers.size());
+    for (const auto& server : servers) {
+      locations.push_back(*server);
+    }
+    LOGFINE("ThinClientPoolDM: Refreshed server snapshot with %zu servers",
+            locations.size());
+    m_serverSnapshot->update(std::move(locations));
+    getStats().incLoctorResposes();
+  }
+
+  // Without server load from the locator, weigh servers by how many
+  // connections this client already has to them.
+  ServerLocation selected;
+  if (!m_serverSnapshot->select(
+          excludeServers,
+          [this](const ServerLocation& server) {
+            auto ep = getEndpoint(server.toString());
+            return ep ? ep->getConnectionCount() : 0;
+          },
+          selected)) {
+    return false;
+  }
+
+  epNameStr = selected.toString();
+  LOGFINE("ThinClientPoolDM: Selected endpoint [%s] from server snapshot",
+          epNameStr.c_str());
+  return true;
+}
+
 void ThinClientPoolDM::addConnection(TcrConnection* conn) {
   std::lock_guard<decltype(mutex_)> lock(mutex_);
   put(conn, false);
@@ -643,7 +993,11 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
     std::shared_ptr<CacheableString>& exceptionPtr) {
   getStats().setCurClientOps(++m_clientOps);
 
-  auto resultCollectorLock = std::make_shared<std::recursive_mutex>();
+  // a streaming collector takes its results without a lock
+  std::shared_ptr<std::recursive_mutex> resultCollectorLock;
+  if (!std::dynamic_pointer_cast<StreamingResultCollector>(rs)) {
+    resultCollectorLock = std::make_shared<std::recursive_mutex>();
+  }
 
   auto csArray = getServers();
 
@@ -652,10 +1006,10 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
     return GF_NOSERVER_FOUND;
   }
 
-  std::vector<std::shared_ptr<FunctionExecution>> fePtrList;
+  std::vector<std::unique_ptr<FunctionExecution>> fePtrList;
+  std::vector<FanOutWork*> fanOut;
   fePtrList.reserve(csArray->length());
-  auto& threadPool = m_connManager.getCacheImpl()->getThreadPool();
-  auto userAttr = UserAttributes::threadLocalUserAttributes;
+  fanOut.reserve(csArray->length());
   for (int i = 0; i < csArray->length(); i++) {
     auto cs = (*csArray)[i];
     auto endpointStr = cs->value();
@@ -668,12 +1022,13 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
           "%s ",
           cs->value().c_str());
     }
-    auto funcExe = std::make_shared<FunctionExecution>();
-    funcExe->setParameters(func, getResult, timeout, args, ep.get(), this,
-                           resultCollectorLock, &rs, userAttr);
-    fePtrList.push_back(funcExe);
-    threadPool.perform(funcExe);
+    auto funcExe = std::unique_ptr<FunctionExecution>(
+        new FunctionExecution(func, getResult, timeout, args, ep.get(), this,
+                              resultCollectorLock, &rs));
+    fanOut.push_back(funcExe.get());
+    fePtrList.push_back(std::move(funcExe));
   }
+  sendFanOut(fanOut);
   GfErrType finalErrorReturn = GF_NOERR;
 
   for (auto& funcExe : fePtrList) {
@@ -720,6 +1075,273 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
   return finalErrorReturn;
 }
 
+void ThinClientPoolDM::sendFanOut(const std::vector<FanOutWork*>& works) {
+  // every reply in flight is read even if another work throws
+  std::exception_ptr exception;
+  for (auto work : works) {
+    try {
+      if (!work->isCancelled()) {
+        sendFanOutRequest(*work);
+      }
+    } catch (...) {
+      if (!exception) exception = std::current_exception();
+    }
+  }
+
+  for (auto work : works) {
+    try {
+      if (work->m_sentTo != nullptr) {
+        work->m_result = work->complete(receiveFanOutReply(*work));
+      } else if (work->isCancelled()) {
+        // the caller has the results it needs, no need to ask this server
+        work->m_result = GF_NOERR;
+      } else if (work->m_noConnection) {
+        work->m_result = work->complete(failFanOutRequest(*work));
+      } else {
+        work->m_result = work->complete(sendFanOutRequestSync(*work));
+      }
+    } catch (...) {
+      if (!exception) exception = std::current_exception();
+    }
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThinClientPoolDM::sendFanOutRequest(FanOutWork& work) {
+  auto& request = work.request();
+  auto& reply = work.reply();
+  if (request.forTransaction()) {
+    // leave the transaction's sticky connection to sendSyncRequest
+    return;
+  }
+
+  TcrConnection* conn = nullptr;
+  if (work.m_endpoint != nullptr) {
+    conn = getFromEP(work.m_endpoint);
+    if (conn == nullptr) {
+      bool maxConnLimit = false;
+      createPoolConnectionToAEndPoint(conn, work.m_endpoint, maxConnLimit);
+    }
+  } else {
+    GfErrType queueErr = GF_NOERR;
+    std::set<ServerLocation> excludeServers;
+    bool match = false;
+    work.m_connFound = false;
+    conn = getConnectionFromQueueW(&queueErr, excludeServers,
+                                   work.m_isBGThread, request, work.m_version,
+                                   match, work.m_connFound,
+                                   work.m_serverLocation);
+    if (conn == nullptr) {
+      // the pool has waited for a connection already
+      work.m_sendError = queueErr;
+      work.m_noConnection = true;
+      return;
+    }
+  }
+  if (conn == nullptr) {
+    // sendFanOutRequestSync reports the error, or finds another connection
+    return;
+  }
+
+  auto ep = conn->getEndpointObject();
+  if (TcrMessage::isUserInitiativeOps(request) &&
+      (m_isSecurityOn || m_isMultiUserMode)) {
+    auto authenticated = ep->isAuthenticated();
+    if (m_isMultiUserMode) {
+      auto userAttr = UserAttributes::threadLocalUserAttributes;
+      authenticated = userAttr && userAttr->isEndpointAuthenticated(ep);
+    }
+    if (!authenticated) {
+      // sendFanOutRequestSync sends the credentials first
+      if (work.m_endpoint != nullptr) {
+        put(conn, false);
+      } else {
+        putInQueue(conn,
+                   work.m_isBGThread || bypassesStickyConnection(request));
+      }
+      return;
+    }
+  }
+
+  if (!hasOwnTimeout(request)) {
+    reply.setTimeout(getReadTimeout());
+    request.setTimeout(getReadTimeout());
+  }
+  reply.setDM(this);
+
+  if (work.m_endpoint == nullptr) {
+    getStats().setCurClientOps(++m_clientOps);
+    if (m_attrs->getAdaptiveSizingEnabled()) {
+      ep->beginOperation();
+    }
+  }
+  work.m_sendTime = std::chrono::steady_clock::now();
+  work.m_sendError = ep->sendRequestConnAsync(
+      request, reply, conn, work.m_receiveTimeout, work.m_isBGThread);
+  work.m_conn = conn;
+  work.m_sentTo = ep;
+}
+
+GfErrType ThinClientPoolDM::receiveFanOutReply(FanOutWork& work) {
+  auto& request = work.request();
+  auto& reply = work.reply();
+  auto ep = work.m_sentTo;
+  auto conn = work.m_conn;
+  work.m_sentTo = nullptr;
+  work.m_conn = nullptr;
+
+  auto error = work.m_sendError;
+  if (error == GF_NOERR) {
+    error = ep->receiveRequestConnReply(request, reply, conn,
+                                        work.m_receiveTimeout,
+                                        work.m_isBGThread);
+  }
+
+  if (work.m_endpoint != nullptr) {
+    // as sendRequestToEP
+    if (error == GF_NOERR) {
+      auto replyMsgType = reply.getMessageType();
+      if (replyMsgType == TcrMessage::EXCEPTION ||
+          replyMsgType == TcrMessage::CQ_EXCEPTION_TYPE ||
+          replyMsgType == TcrMessage::CQDATAERROR_MSG_TYPE) {
+        error = ThinClientRegion::handleServerException(
+            "ThinClientPoolDM::sendFanOut", reply.getException());
+      }
+      put(conn, false);
+    } else {
+      ep->setConnectionStatus(false);
+      if (conn) {
+        GF_SAFE_DELETE_CON(conn);
+      }
+      removeEPConnections(1);
+      removeEPFromMetadataIfError(error, ep);
+    }
+
+    if (needsReauthentication(reply, ep)) {
+      return sendRequestToEP(request, reply, ep);
+    }
+    return error;
+  }
+
+  // as one attempt of sendSyncRequest
+  if (m_attrs->getAdaptiveSizingEnabled()) {
+    ep->endOperation(std::chrono::steady_clock::now() - work.m_sendTime);
+  }
+  error = handleEPError(ep, reply, error);
+  if (error == GF_NOERR) {
+    putInQueue(conn, work.m_isBGThread || bypassesStickyConnection(request));
+  } else {
+    if (error != GF_TIMEOUT) removeEPConnections(ep);
+    // Update stats for the connection that failed.
+    removeEPConnections(1, false);
+    setStickyNull(work.m_isBGThread || bypassesStickyConnection(request));
+    if (conn) {
+      try {
+        GF_SAFE_DELETE_CON(conn);
+      } catch (...) {
+      }
+    }
+    removeEPFromMetadataIfError(error, ep);
+  }
+  getStats().setCurClientOps(--m_clientOps);
+
+  if (error == GF_NOERR) {
+    if (needsReauthentication(reply, ep)) {
+      return sendSyncRequest(request, reply, work.m_attemptFailover,
+                             work.m_isBGThread, work.m_serverLocation);
+    }
+    refreshMetadataIfStale(request, reply, work.m_version, work.m_connFound);
+    getStats().incSucceedClientOps();
+    return GF_NOERR;
+  }
+
+  if (work.m_attemptFailover &&
+      !(error == GF_TIMEOUT && hasOwnTimeout(request))) {
+    request.updateHeaderForRetry();
+    return sendSyncRequest(request, reply, true, work.m_isBGThread,
+                           work.m_serverLocation);
+  }
+
+  if (error == GF_TIMEOUT) {
+    getStats().incTimeoutClientOps();
+  } else {
+    getStats().incFailedClientOps();
+  }
+  // Top-level only sees NotConnectedException
+  if (error == GF_IOERR) {
+    error = GF_NOTCON;
+  }
+  return error;
+}
+
+GfErrType ThinClientPoolDM::failFanOutRequest(FanOutWork& work) {
+  auto& request = work.request();
+  auto& reply = work.reply();
+  auto error = work.m_sendError;
+  work.m_noConnection = false;
+
+  // as the first attempt of sendSyncRequest, without waiting for a
+  // connection again
+  if (error == GF_CLIENT_WAIT_TIMEOUT) {
+    LOGFINE("Request timeout at client only");
+    return error;
+  } else if (error == GF_CLIENT_WAIT_TIMEOUT_REFRESH_PRMETADATA) {
+    refreshMetadataAfterWaitTimeout(request, reply);
+    return error;
+  } else if (error == GF_NOERR) {
+    getStats().incFailedClientOps();
+    return GF_ALL_CONNECTIONS_IN_USE_EXCEPTION;
+  }
+
+  if (work.m_attemptFailover) {
+    request.updateHeaderForRetry();
+    return sendSyncRequest(request, reply, true, work.m_isBGThread,
+                           work.m_serverLocation);
+  }
+
+  getStats().incFailedClientOps();
+  // Top-level only sees NotConnectedException
+  if (error == GF_IOERR) {
+    error = GF_NOTCON;
+  }
+  return error;
+}
+
+GfErrType ThinClientPoolDM::sendFanOutRequestSync(FanOutWork& work) {
+  if (work.m_endpoint != nullptr) {
+    return sendRequestToEP(work.request(), work.reply(), work.m_endpoint);
+  }
+  return sendSyncRequest(work.request(), work.reply(), work.m_attemptFailover,
+                         work.m_isBGThread, work.m_serverLocation);
+}
+
+bool ThinClientPoolDM::needsReauthentication(TcrMessageReply& reply,
+                                             TcrEndpoint* ep) {
+  if (!(m_isSecurityOn || m_isMultiUserMode) ||
+      reply.getMessageType() != TcrMessage::EXCEPTION ||
+      !isAuthRequireException(reply.getException())) {
+    return false;
+  }
+
+  LOGFINEST("After getting AuthenticationRequiredException trying again.");
+  if (!m_isMultiUserMode) {
+    ep->setAuthenticated(false);
+  } else if (auto userAttr = UserAttributes::threadLocalUserAttributes) {
+    userAttr->unAuthenticateEP(ep);
+  }
+  return true;
+}
+
+bool ThinClientPoolDM::bypassesStickyConnection(const TcrMessage& request) {
+  auto type = request.getMessageType();
+  return type == TcrMessage::GET_ALL_70 ||
+         type == TcrMessage::GET_ALL_WITH_CALLBACK ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP;
+}
+
 const std::shared_ptr<CacheableStringArray> ThinClientPoolDM::getLocators()
     const {
   std::vector<std::shared_ptr<CacheableString>> locators;
@@ -809,6 +1431,8 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
       cacheImpl->getExpiryTaskManager().cancel(conns_mgmt_task_id_);
     }
 
+    stopAdaptiveSizingThread();
+
     LOGDEBUG("Closing PoolStatsSampler thread.");
     // TODO suspect
     // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -1226,15 +1850,21 @@ GfErrType ThinClientPoolDM::sendSyncRequest(TcrMessage& request,
     auto responseHandler =
         static_cast<ChunkedGetAllResponse*>(reply.getChunkedResultHandler());
 
+    // Each server gets its keys in batches that are in flight together, so
+    // no request buffer grows with the whole getAll and replies of one batch
+    // are read into the cache while the server still works on the others.
+    const auto batchSize = m_getAllBatchSizer.nextBatchSize();
     for (const auto& locationIter : *locationMap) {
       const auto& serverLocation = locationIter.first;
-      const auto& keys = locationIter.second;
-      auto worker = std::make_shared<GetAllWork>(
-          this, region, serverLocation, keys, attemptFailover, isBGThread,
-          responseHandler->getAddToLocalCache(), responseHandler,
-          request.getCallbackArgument());
-      threadPool.perform(worker);
-      getAllWorkers.push_back(worker);
+      for (const auto& batch :
+           GetAllBatchSizer::split(locationIter.second, batchSize)) {
+        auto worker = std::make_shared<GetAllWork>(
+            this, region, serverLocation, batch, attemptFailover, isBGThread,
+            responseHandler->getAddToLocalCache(), responseHandler,
+            request.getCallbackArgument());
+        threadPool.perform(worker);
+        getAllWorkers.push_back(worker);
+      }
     }
     reply.setMessageType(TcrMessage::RESPONSE);
 
@@ -1276,16 +1906,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   std::shared_ptr<UserAttributes> userAttr = nullptr;
   reply.setDM(this);
 
-  int32_t type = request.getMessageType();
-
-  if (!(type == TcrMessage::QUERY ||
-        type == TcrMessage::QUERY_WITH_PARAMETERS ||
-        type == TcrMessage::PUTALL ||
-        type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
-        type == TcrMessage::EXECUTE_FUNCTION ||
-        type == TcrMessage::EXECUTE_REGION_FUNCTION ||
-        type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-        type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE)) {
+  if (!hasOwnTimeout(request)) {
     // set only when message is not query, putall and executeCQ
     reply.setTimeout(getReadTimeout());
     request.setTimeout(getReadTimeout());
@@ -1298,7 +1919,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   auto retry = m_attrs->getRetryAttempts() + 1;
   TcrConnection* conn = nullptr;
   std::set<ServerLocation> excludeServers;
-  type = request.getMessageType();
+  auto type = request.getMessageType();
   bool isAuthRequireExcep = false;
   int isAuthRequireExcepMaxTry = 2;
   bool firstTry = true;
@@ -1309,15 +1930,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
     if (!firstTry) request.updateHeaderForRetry();
     // if it's a query or putall and we had a timeout, just return with the
     // newly selected endpoint without failover-retry
-    if ((type == TcrMessage::QUERY ||
-         type == TcrMessage::QUERY_WITH_PARAMETERS ||
-         type == TcrMessage::PUTALL ||
-         type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
-         type == TcrMessage::EXECUTE_FUNCTION ||
-         type == TcrMessage::EXECUTE_REGION_FUNCTION ||
-         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-         type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE) &&
-        error == GF_TIMEOUT) {
+    if (hasOwnTimeout(request) && error == GF_TIMEOUT) {
       return error;
     }
 
@@ -1355,20 +1968,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
       LOGFINE("Request timeout at client only");
       return GF_CLIENT_WAIT_TIMEOUT;
     } else if (queueErr == GF_CLIENT_WAIT_TIMEOUT_REFRESH_PRMETADATA) {
-      // need to refresh meta data
-      auto region =
-          m_connManager.getCacheImpl()->getRegion(request.getRegionName());
-
-      if (region != nullptr) {
-        LOGFINE(
-            "Need to refresh pr-meta-data timeout in client only  with "
-            "refresh "
-            "metadata");
-        auto* tcrRegion = dynamic_cast<ThinClientRegion*>(region.get());
-        tcrRegion->setMetaDataRefreshed(false);
-        m_clientMetadataService->enqueueForMetadataRefresh(
-            region->getFullPath(), reply.getserverGroupVersion());
-      }
+      refreshMetadataAfterWaitTimeout(request, reply);
       return GF_CLIENT_WAIT_TIMEOUT_REFRESH_PRMETADATA;
     }
 
@@ -1415,7 +2015,22 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
       }
 
       if (userCredMsgErr == GF_NOERR) {
-        error = ep->sendRequestConnWithRetry(request, reply, conn);
+        {
+          EndpointOperation operation(
+              m_attrs->getAdaptiveSizingEnabled() ? ep : nullptr);
+          auto start = std::chrono::steady_clock::now();
+          error = ep->sendRequestConnWithRetry(request, reply, conn);
+          if (error == GF_NOERR && serverLocation != nullptr &&
+              (type == TcrMessage::GET_ALL_70 ||
+               type == TcrMessage::GET_ALL_WITH_CALLBACK)) {
+            // only the time on the connection, not waiting for one
+            auto responseHandler = static_cast<ChunkedGetAllResponse*>(
+                reply.getChunkedResultHandler());
+            m_getAllBatchSizer.record(request.getKeys()->size(),
+                                      responseHandler->getBytesReceived(),
+                                      std::chrono::steady_clock::now() - start);
+          }
+        }
         error = handleEPError(ep, reply, error);
       } else {
         error = userCredMsgErr;
@@ -1424,13 +2039,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
       if (!isServerException) {
         if (error == GF_NOERR) {
           LOGDEBUG("putting connection back in queue");
-          putInQueue(conn,
-                     isBGThread ||
-                         request.getMessageType() == TcrMessage::GET_ALL_70 ||
-                         request.getMessageType() ==
-                             TcrMessage::GET_ALL_WITH_CALLBACK ||
-                         request.getMessageType() ==
-                             TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP,
+          putInQueue(conn, isBGThread || bypassesStickyConnection(request),
                      request.forTransaction());  // connFound is only relevant
                                                  // for Sticky conn.
           LOGDEBUG("putting connection back in queue DONE");
@@ -1438,12 +2047,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
           if (error != GF_TIMEOUT) removeEPConnections(ep);
           // Update stats for the connection that failed.
           removeEPConnections(1, false);
-          setStickyNull(isBGThread ||
-                        request.getMessageType() == TcrMessage::GET_ALL_70 ||
-                        request.getMessageType() ==
-                            TcrMessage::GET_ALL_WITH_CALLBACK ||
-                        request.getMessageType() ==
-                            TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP);
+          setStickyNull(isBGThread || bypassesStickyConnection(request));
           if (conn) {
             try {
               GF_SAFE_DELETE_CON(conn);
@@ -1481,31 +2085,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
           }
         }
       }
-      LOGFINER(
-          "reply Metadata version is %d & bsl version is %d "
-          "reply.isFEAnotherHop()=%d",
-          reply.getMetaDataVersion(), version, reply.isFEAnotherHop());
-      if (m_clientMetadataService && request.forSingleHop() &&
-          (reply.getMetaDataVersion() != 0 ||
-           (request.getMessageType() == TcrMessage::EXECUTE_REGION_FUNCTION &&
-            request.getKeyRef() != nullptr && reply.isFEAnotherHop()))) {
-        // Need to get direct access to Region's name to avoid referencing
-        // temp data and causing crashes
-        auto region =
-            m_connManager.getCacheImpl()->getRegion(request.getRegionName());
-
-        if (region != nullptr) {
-          if (!connFound)  // max limit case then don't refresh otherwise
-                           // always refresh
-          {
-            LOGFINE("Need to refresh pr-meta-data");
-            auto* tcrRegion = dynamic_cast<ThinClientRegion*>(region.get());
-            tcrRegion->setMetaDataRefreshed(false);
-          }
-          m_clientMetadataService->enqueueForMetadataRefresh(
-              region->getFullPath(), reply.getserverGroupVersion());
-        }
-      }
+      refreshMetadataIfStale(request, reply, version, connFound);
     }
 
     if (excludeServers.size() == lastExcludeSize) {
@@ -1552,6 +2132,53 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   return error;
 }
 
+void ThinClientPoolDM::refreshMetadataIfStale(TcrMessage& request,
+                                              TcrMessageReply& reply,
+                                              int8_t version, bool connFound) {
+  LOGFINER(
+      "reply Metadata version is %d & bsl version is %d "
+      "reply.isFEAnotherHop()=%d",
+      reply.getMetaDataVersion(), version, reply.isFEAnotherHop());
+  if (m_clientMetadataService && request.forSingleHop() &&
+      (reply.getMetaDataVersion() != 0 ||
+       (request.getMessageType() == TcrMessage::EXECUTE_REGION_FUNCTION &&
+        request.getKeyRef() != nullptr && reply.isFEAnotherHop()))) {
+    // Need to get direct access to Region's name to avoid referencing
+    // temp data and causing crashes
+    auto region =
+        m_connManager.getCacheImpl()->getRegion(request.getRegionName());
+
+    if (region != nullptr) {
+      if (!connFound)  // max limit case then don't refresh otherwise
+                       // always refresh
+      {
+        LOGFINE("Need to refresh pr-meta-data");
+        auto* tcrRegion = dynamic_cast<ThinClientRegion*>(region.get());
+        tcrRegion->setMetaDataRefreshed(false);
+      }
+      m_clientMetadataService->enqueueForMetadataRefresh(
+          region->getFullPath(), reply.getserverGroupVersion());
+    }
+  }
+}
+
+void ThinClientPoolDM::refreshMetadataAfterWaitTimeout(
+    TcrMessage& request, TcrMessageReply& reply) {
+  auto region =
+      m_connManager.getCacheImpl()->getRegion(request.getRegionName());
+
+  if (region != nullptr) {
+    LOGFINE(
+        "Need to refresh pr-meta-data timeout in client only  with "
+        "refresh "
+        "metadata");
+    auto* tcrRegion = dynamic_cast<ThinClientRegion*>(region.get());
+    tcrRegion->setMetaDataRefreshed(false);
+    m_clientMetadataService->enqueueForMetadataRefresh(
+        region->getFullPath(), reply.getserverGroupVersion());
+  }
+}
+
 void ThinClientPoolDM::removeEPFromMetadataIfError(const GfErrType& error,
                                                    const TcrEndpoint* ep) {
   if ((error == GF_IOERR || error == GF_TIMEOUT) && (m_clientMetadataService)) {
@@ -2411,52 +3038,53 @@ std::shared_ptr<TcrEndpoint> ThinClientPoolDM::createEP(
       m_connManager.redundancy_semaphore_, this);
 }
 
-GfErrType FunctionExecution::execute() {
-  GuardUserAttributes gua;
-
-  if (m_userAttr) {
-    gua.setAuthenticatedView(m_userAttr->getAuthenticatedView());
-  }
-
-  std::string funcName(m_func);
-  TcrMessageExecuteFunction request(
-      new DataOutput(
-          m_poolDM->getConnectionManager().getCacheImpl()->createDataOutput()),
-      funcName, m_args, m_getResult, m_poolDM, m_timeout);
-  TcrMessageReply reply(true, m_poolDM);
-  auto resultProcessor = std::unique_ptr<ChunkedFunctionExecutionResponse>(
-      new ChunkedFunctionExecutionResponse(reply, (m_getResult & 2) == 2, *m_rc,
-                                           m_resultCollectorLock));
-  reply.setChunkedResultHandler(resultProcessor.get());
-  reply.setTimeout(m_timeout);
-  reply.setDM(m_poolDM);
-
-  LOGDEBUG(
-      "ThinClientPoolDM::sendRequestToAllServer sendRequest on endpoint[%s]!",
-      m_ep->name().c_str());
-
-  m_error = m_poolDM->sendRequestToEP(request, reply, m_ep);
-  m_error = m_poolDM->handleEPError(m_ep, reply, m_error);
-  if (m_error != GF_NOERR) {
-    if (m_error == GF_NOTCON) {
+FunctionExecution::FunctionExecution(
+    const char* func, uint8_t getResult, std::chrono::milliseconds timeout,
+    std::shared_ptr<Cacheable> args, TcrEndpoint* ep, ThinClientPoolDM* poolDM,
+    const std::shared_ptr<std::recursive_mutex>& rCL,
+    std::shared_ptr<ResultCollector>* rs)
+    : FanOutWork(ep), m_ep(ep), m_rc(rs) {
+  auto cacheImpl = poolDM->getConnectionManager().getCacheImpl();
+  m_request = std::unique_ptr<TcrMessageExecuteFunction>(
+      new TcrMessageExecuteFunction(
+          new DataOutput(cacheImpl->createDataOutput()), func, args,
+          getResult, poolDM, timeout));
+  m_reply = std::unique_ptr<TcrMessageReply>(new TcrMessageReply(true, poolDM));
+  m_resultProcessor = std::unique_ptr<ChunkedFunctionExecutionResponse>(
+      new ChunkedFunctionExecutionResponse(*m_reply, (getResult & 2) == 2,
+                                           *m_rc, rCL));
+  m_reply->setChunkedResultHandler(m_resultProcessor.get());
+  m_reply->setTimeout(timeout);
+  m_reply->setDM(poolDM);
+}
+
+bool FunctionExecution::isCancelled() {
+  auto streaming = dynamic_cast<StreamingResultCollector*>(m_rc->get());
+  return streaming != nullptr && streaming->isCancelled();
+}
+
+GfErrType FunctionExecution::complete(GfErrType error) {
+  error = ThinClientPoolDM::handleEPError(m_ep, *m_reply, error);
+  if (error != GF_NOERR) {
+    if (error == GF_NOTCON) {
       return GF_NOERR;  // if server is unavailable its not an error for
       // functionexec OnServers() case
     }
     LOGDEBUG("FunctionExecution::execute failed on endpoint[%s]!. Error = %d ",
-             m_ep->name().c_str(), m_error);
-    if (reply.getMessageType() == TcrMessage::EXCEPTION) {
-      exceptionPtr = CacheableString::create(reply.getException());
+             m_ep->name().c_str(), error);
+    if (m_reply->getMessageType() == TcrMessage::EXCEPTION) {
+      exceptionPtr = CacheableString::create(m_reply->getException());
     }
 
-    return m_error;
-  } else if (reply.getMessageType() == TcrMessage::EXCEPTION ||
-             reply.getMessageType() == TcrMessage::EXECUTE_FUNCTION_ERROR) {
-    m_error = ThinClientRegion::handleServerException("Execute",
-                                                      reply.getException());
-    exceptionPtr = CacheableString::create(reply.getException());
+    return error;
+  } else if (m_reply->getMessageType() == TcrMessage::EXCEPTION ||
+             m_reply->getMessageType() == TcrMessage::EXECUTE_FUNCTION_ERROR) {
+    error = ThinClientRegion::handleServerException("Execute",
+                                                    m_reply->getException());
+    exceptionPtr = CacheableString::create(m_reply->getException());
   }
 
-  return m_error;
+  return error;
 }
 
 OnRegionFunctionExecution::OnRegionFunctionExecution(
@@ -2464,12 +3092,10 @@ OnRegionFunctionExecution::OnRegionFunctionExecution(
     std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
     std::chrono::milliseconds timeout, ThinClientPoolDM* poolDM,
     const std::shared_ptr<std::recursive_mutex>& rCL,
-    std::shared_ptr<ResultCollector> rs,
-    std::shared_ptr<UserAttributes> userAttr, bool isBGThread,
+    std::shared_ptr<ResultCollector> rs, bool isBGThread,
     const std::shared_ptr<BucketServerLocation>& serverLocation,
     bool allBuckets)
-    : m_serverLocation(serverLocation),
-      m_isBGThread(isBGThread),
+    : FanOutWork(serverLocation, !(getResult & 1), isBGThread),
       m_poolDM(poolDM),
       m_func(func),
       m_getResult(getResult),
@@ -2478,7 +3104,6 @@ OnRegionFunctionExecution::OnRegionFunctionExecution(
       m_routingObj(routingObj),
       m_rc(rs),
       m_resultCollectorLock(rCL),
-      m_userAttr(userAttr),
       m_region(region),
       m_allBuckets(allBuckets) {
   m_request = new TcrMessageExecuteRegionFunctionSingleHop(
@@ -21,6 +21,7 @@
 #define GEODE_THINCLIENTPOOLDM_H_
 
 #include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -30,11 +31,14 @@
 #include <geode/Pool.hpp>
 #include <geode/ResultCollector.hpp>
 
+#include "AdaptivePoolSizer.hpp"
 #include "ConnectionQueue.hpp"
 #include "ExecutionImpl.hpp"
+#include "GetAllBatchSizer.hpp"
 #include "PoolAttributes.hpp"
 #include "PoolStatistics.hpp"
 #include "RemoteQueryService.hpp"
+#include "ServerLoadSnapshot.hpp"
 #include "TXState.hpp"
 #include "Task.hpp"
 #include "TcrPoolEndPoint.hpp"
@@ -61,6 +65,61 @@ class CacheImpl;
 class FunctionExecution;
 class ClientMetadataService;
 
+/**
+ * A request to one server of a fan-out. ThinClientPoolDM::sendFanOut sends
+ * the requests of all the works before it reads any reply, so the servers
+ * work on them together while only the calling thread waits.
+ */
+class FanOutWork {
+ public:
+  virtual ~FanOutWork() noexcept = default;
+
+  GfErrType getResult() const { return m_result; }
+
+ protected:
+  // Sent to the server hosting serverLocation and failed over like
+  // ThinClientPoolDM::sendSyncRequest.
+  FanOutWork(const std::shared_ptr<BucketServerLocation>& serverLocation,
+             bool attemptFailover, bool isBGThread)
+      : m_serverLocation(serverLocation),
+        m_endpoint(nullptr),
+        m_attemptFailover(attemptFailover),
+        m_isBGThread(isBGThread) {}
+
+  // Sent to endpoint like ThinClientPoolDM::sendRequestToEP.
+  explicit FanOutWork(TcrEndpoint* endpoint)
+      : m_endpoint(endpoint), m_attemptFailover(false), m_isBGThread(false) {}
+
+  virtual TcrMessage& request() = 0;
+  virtual TcrMessageReply& reply() = 0;
+
+  // Whether the caller no longer needs the reply of this server.
+  virtual bool isCancelled() { return false; }
+
+  // Turns the error of the request into the result of the work.
+  virtual GfErrType complete(GfErrType error) { return error; }
+
+ private:
+  std::shared_ptr<BucketServerLocation> m_serverLocation;
+  TcrEndpoint* m_endpoint;
+  bool m_attemptFailover;
+  bool m_isBGThread;
+  GfErrType m_result = GF_NOERR;
+
+  // state of the request while its reply is outstanding
+  TcrConnection* m_conn = nullptr;
+  TcrEndpoint* m_sentTo = nullptr;
+  GfErrType m_sendError = GF_NOERR;
+  std::chrono::microseconds m_receiveTimeout{};
+  std::chrono::steady_clock::time_point m_sendTime;
+  int8_t m_version = 0;
+  bool m_connFound = false;
+  // the pool had no connection for the request, m_sendError says why
+  bool m_noConnection = false;
+
+  friend class ThinClientPoolDM;
+};
+
 class ThinClientPoolDM
     : public ThinClientBaseDM,
       public Pool,
@@ -98,6 +157,12 @@ class ThinClientPoolDM
 
   GfErrType sendRequestToEP(const TcrMessage& request, TcrMessageReply& reply,
                             TcrEndpoint* currentEndpoint) override;
+
+  // Sends the request of every work before reading any reply, then reads the
+  // replies in turn and completes each work on the calling thread. A request
+  // that cannot be sent this way, or has to fail over, is sent again through
+  // sendSyncRequest or sendRequestToEP.
+  void sendFanOut(const std::vector<FanOutWork*>& works);
   void addConnection(TcrConnection* conn);
 
   std::shared_ptr<TcrEndpoint> addEP(ServerLocation& serverLoc);
@@ -150,6 +215,8 @@ class ThinClientPoolDM
 
   virtual inline PoolStats& getStats() { return *m_stats; }
 
+  inline const PoolStats& getStats() const { return *m_stats; }
+
   size_t getNumberOfEndPoints() const override { return m_endpoints.size(); }
 
   int32_t GetPDXIdForType(std::shared_ptr<Serializable> pdxType);
@@ -241,6 +308,18 @@ class ThinClientPoolDM
  private:
   bool hasExpired(TcrConnection* conn);
 
+  void sendFanOutRequest(FanOutWork& work);
+  GfErrType receiveFanOutReply(FanOutWork& work);
+  GfErrType failFanOutRequest(FanOutWork& work);
+  GfErrType sendFanOutRequestSync(FanOutWork& work);
+  bool needsReauthentication(TcrMessageReply& reply, TcrEndpoint* ep);
+  void refreshMetadataIfStale(TcrMessage& request, TcrMessageReply& reply,
+                              int8_t version, bool connFound);
+  void refreshMetadataAfterWaitTimeout(TcrMessage& request,
+                                       TcrMessageReply& reply);
+  // Requests whose connection does not stick to the calling thread.
+  static bool bypassesStickyConnection(const TcrMessage& request);
+
   std::shared_ptr<Properties> getCredentials(TcrEndpoint* ep);
   GfErrType sendUserCredentials(std::shared_ptr<Properties> credentials,
                                 TcrConnection*& conn, bool isBGThread,
@@ -275,6 +354,8 @@ class ThinClientPoolDM
 
   std::string selectEndpoint(std::set<ServerLocation>&,
                              const TcrConnection* currentServer = nullptr);
+  bool selectEndpointFromSnapshot(const std::set<ServerLocation>&,
+                                  std::string& epNameStr);
   // TODO global - m_memId was volatile
   std::unique_ptr<ClientProxyMembershipID> m_memId;
   virtual std::shared_ptr<TcrEndpoint> createEP(const char* endpointName);
@@ -283,6 +364,8 @@ class ThinClientPoolDM
   bool excludeServer(std::string, std::set<ServerLocation>&);
 
   ThinClientLocatorHelper* m_locHelper;
+  std::unique_ptr<ServerLoadSnapshot> m_serverSnapshot;
+  GetAllBatchSizer m_getAllBatchSizer;
 
   std::atomic<int32_t> m_poolSize;  // Actual Size of Pool
   int m_numRegions;
@@ -293,19 +376,36 @@ class ThinClientPoolDM
   // Manage Connection thread
 
   binary_semaphore conn_semaphore_;
+  binary_semaphore adaptive_sizing_semaphore_;
   std::unique_ptr<Task<ThinClientPoolDM>> m_connManageTask;
   std::unique_ptr<Task<ThinClientPoolDM>> m_pingTask;
   std::unique_ptr<Task<ThinClientPoolDM>> m_updateLocatorListTask;
+  std::unique_ptr<Task<ThinClientPoolDM>> m_adaptiveSizingTask;
   ExpiryTask::id_t ping_task_id_{ExpiryTask::invalid()};
   ExpiryTask::id_t update_locators_task_id_{ExpiryTask::invalid()};
   ExpiryTask::id_t conns_mgmt_task_id_{ExpiryTask::invalid()};
+  ExpiryTask::id_t adaptive_sizing_task_id_{ExpiryTask::invalid()};
 
   void manageConnections(std::atomic<bool>& isRunning);
   void manageConnectionsInternal(std::atomic<bool>& isRunning);
   void cleanStaleConnections(std::atomic<bool>& isRunning);
   void restoreMinConnections(std::atomic<bool>& isRunning);
+  void prefillConnections(std::atomic<bool>& isRunning);
+  void checkPoolReady();
+  void adaptConnections(std::atomic<bool>& isRunning);
+  void adaptConnectionsInternal(std::chrono::nanoseconds interval,
+                                std::atomic<bool>& isRunning);
+  void stopAdaptiveSizingThread();
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
   std::atomic<int32_t> connected_endpoints_;
+  // Shared by the threads of one restoreMinConnections pass.
+  std::atomic<int32_t> m_prefillMissing;
+  std::atomic<int32_t> m_prefillAttempts;
+  std::atomic<int32_t> m_prefillRestored;
+  std::chrono::steady_clock::time_point m_startTime;
+  std::atomic<bool> m_poolReady;
+  std::mutex m_poolReadyMutex;
+  std::condition_variable m_poolReadyCondition;
   std::unique_ptr<statistics::PoolStatsSampler> m_PoolStatsSampler;
   std::unique_ptr<ClientMetadataService> m_clientMetadataService;
   bool m_keepAlive;
@@ -313,70 +413,45 @@ class ThinClientPoolDM
   friend class CacheImpl;
   friend class ThinClientStickyManager;
   friend class FunctionExecution;
+  friend class PrefillWork;
   static const char* NC_Ping_Thread;
   static const char* NC_MC_Thread;
+  static const char* NC_AS_Thread;
   int m_primaryServerQueueSize;
   void removeEPFromMetadataIfError(const GfErrType& error,
                                    const TcrEndpoint* ep);
 };
 
-class FunctionExecution : public PooledWork<GfErrType> {
-  ThinClientPoolDM* m_poolDM;
+class FunctionExecution : public FanOutWork {
   TcrEndpoint* m_ep;
-  const char* m_func;
-  uint8_t m_getResult;
-  std::chrono::milliseconds m_timeout;
-  std::shared_ptr<Cacheable> m_args;
-  GfErrType m_error;
+  std::unique_ptr<TcrMessageExecuteFunction> m_request;
+  std::unique_ptr<TcrMessageReply> m_reply;
+  std::unique_ptr<ChunkedFunctionExecutionResponse> m_resultProcessor;
   std::shared_ptr<ResultCollector>* m_rc;
-  std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
   std::shared_ptr<CacheableString> exceptionPtr;
-  std::shared_ptr<UserAttributes> m_userAttr;
 
  public:
-  FunctionExecution() {
-    m_poolDM = nullptr;
-    m_ep = nullptr;
-    m_func = nullptr;
-    m_getResult = 0;
-    m_error = GF_NOERR;
-    m_rc = nullptr;
-    m_resultCollectorLock = nullptr;
-    m_userAttr = nullptr;
-  }
+  FunctionExecution(const char* func, uint8_t getResult,
+                    std::chrono::milliseconds timeout,
+                    std::shared_ptr<Cacheable> args, TcrEndpoint* ep,
+                    ThinClientPoolDM* poolDM,
+                    const std::shared_ptr<std::recursive_mutex>& rCL,
+                    std::shared_ptr<ResultCollector>* rs);
 
   ~FunctionExecution() noexcept override = default;
 
   std::shared_ptr<CacheableString> getException() { return exceptionPtr; }
 
-  void setParameters(const char* func, uint8_t getResult,
-                     std::chrono::milliseconds timeout,
-                     std::shared_ptr<Cacheable> args, TcrEndpoint* ep,
-                     ThinClientPoolDM* poolDM,
-                     const std::shared_ptr<std::recursive_mutex>& rCL,
-                     std::shared_ptr<ResultCollector>* rs,
-                     std::shared_ptr<UserAttributes> userAttr) {
-    exceptionPtr = nullptr;
-    m_resultCollectorLock = rCL;
-    m_rc = rs;
-    m_error = GF_NOTCON;
-    m_func = func;
-    m_getResult = getResult;
-    m_timeout = timeout;
-    m_args = args;
-    m_ep = ep;
-    m_poolDM = poolDM;
-    m_userAttr = userAttr;
-  }
-
-  GfErrType execute(void) override;
+ protected:
+  TcrMessage& request() override { return *m_request; }
+  TcrMessageReply& reply() override { return *m_reply; }
+  bool isCancelled() override;
+  GfErrType complete(GfErrType error) override;
 };
 
-class OnRegionFunctionExecution : public PooledWork<GfErrType> {
-  std::shared_ptr<BucketServerLocation> m_serverLocation;
+class OnRegionFunctionExecution : public FanOutWork {
   TcrMessage* m_request;
   TcrMessageReply* m_reply;
-  bool m_isBGThread;
   ThinClientPoolDM* m_poolDM;
   std::string m_func;
   uint8_t m_getResult;
@@ -386,7 +461,6 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
   std::shared_ptr<ResultCollector> m_rc;
   TcrChunkedResult* m_resultCollector;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
-  std::shared_ptr<UserAttributes> m_userAttr;
   const Region* m_region;
   bool m_allBuckets;
 
@@ -396,8 +470,7 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
       std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
       std::chrono::milliseconds timeout, ThinClientPoolDM* poolDM,
       const std::shared_ptr<std::recursive_mutex>& rCL,
-      std::shared_ptr<ResultCollector> rs,
-      std::shared_ptr<UserAttributes> userAttr, bool isBGThread,
+      std::shared_ptr<ResultCollector> rs, bool isBGThread,
       const std::shared_ptr<BucketServerLocation>& serverLocation,
       bool allBuckets);
 
@@ -417,16 +490,10 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
     return static_cast<ChunkedFunctionExecutionResponse*>(m_resultCollector);
   }
 
-  GfErrType execute(void) override {
-    GuardUserAttributes gua;
-
-    if (m_userAttr) {
-      gua.setAuthenticatedView(m_userAttr->getAuthenticatedView());
-    }
-
-    return m_poolDM->sendSyncRequest(*m_request, *m_reply, !(m_getResult & 1),
-                                     m_isBGThread, m_serverLocation);
-  }
+ protected:
+  TcrMessage& request() override { return *m_request; }
+  TcrMessageReply& reply() override { return *m_reply; }
+  bool isCancelled() override { return getResultCollector()->isCancelled(); }
 };
 
 }  // namespace client
@@ -17,17 +17,32 @@
 
 #include "ThinClientPoolHADM.hpp"
 
+#include <exception>
+
 #include <geode/SystemProperties.hpp>
 
 #include "CacheImpl.hpp"
 #include "FunctionExpiryTask.hpp"
 #include "TcrConnectionManager.hpp"
+#include "ThreadPool.hpp"
 #include "util/exception.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+class RecoverInterestWork : public PooledWork<GfErrType> {
+  std::function<GfErrType()> m_recovery;
+
+ public:
+  explicit RecoverInterestWork(std::function<GfErrType()> recovery)
+      : m_recovery(std::move(recovery)) {}
+
+  ~RecoverInterestWork() noexcept override = default;
+
+  GfErrType execute() override { return m_recovery(); }
+};
+
 const char* ThinClientPoolHADM::NC_Redundancy = "NC Redundancy";
 ThinClientPoolHADM::ThinClientPoolHADM(const char* name,
                                        std::shared_ptr<PoolAttributes> poolAttr,
@@ -186,16 +201,59 @@ void ThinClientPoolHADM::sendNotificationCloseMsgs() {
 
 GfErrType ThinClientPoolHADM::registerInterestAllRegions(
     TcrEndpoint* ep, const TcrMessage* request, TcrMessageReply* reply) {
-  GfErrType err = GF_NOERR;
-
   std::lock_guard<decltype(regionsLock_)> guard(regionsLock_);
+  // only the region named in request uses reply, so the regions can go
+  // concurrently
+  std::vector<std::function<GfErrType()>> recoveries;
+  recoveries.reserve(regions_.size());
   for (const auto& region : regions_) {
-    auto opErr = region->registerKeys(ep, request, reply);
-    if (err == GF_NOERR) {
-      err = opErr;
+    recoveries.emplace_back([region, ep, request, reply] {
+      return region->registerKeys(ep, request, reply);
+    });
+  }
+
+  return recoverInterest(m_connManager.getCacheImpl()->getThreadPool(),
+                         recoveries);
+}
+
+GfErrType ThinClientPoolHADM::recoverInterest(
+    ThreadPool& threadPool,
+    const std::vector<std::function<GfErrType()>>& recoveries) {
+  GfErrType err = GF_NOERR;
+  if (recoveries.size() < 2) {
+    for (const auto& recovery : recoveries) {
+      err = recovery();
     }
+    return err;
+  }
+
+  std::vector<std::shared_ptr<RecoverInterestWork>> works;
+  works.reserve(recoveries.size());
+  for (const auto& recovery : recoveries) {
+    auto work = std::make_shared<RecoverInterestWork>(recovery);
+    threadPool.perform(work);
+    works.push_back(std::move(work));
   }
 
+  // the recoveries refer to the caller's request and reply, so every one
+  // must be done before returning, even if another one threw
+  std::exception_ptr exception;
+  for (const auto& work : works) {
+    try {
+      auto opErr = work->getResult();
+      if (err == GF_NOERR) {
+        err = opErr;
+      }
+    } catch (...) {
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
   return err;
 }
 
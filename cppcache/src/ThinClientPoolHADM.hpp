@@ -21,8 +21,10 @@
 #define GEODE_THINCLIENTPOOLHADM_H_
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "PoolAttributes.hpp"
 #include "Task.hpp"
@@ -35,6 +37,7 @@ namespace client {
 
 class TcrConnectionManager;
 class ThinClientRedundancyManager;
+class ThreadPool;
 
 class ThinClientPoolHADM : public ThinClientPoolDM {
  public:
@@ -59,6 +62,16 @@ class ThinClientPoolHADM : public ThinClientPoolDM {
                                        const TcrMessage* request,
                                        TcrMessageReply* reply);
 
+  /**
+   * Runs the interest recovery of each region, concurrently on threadPool
+   * when there is more than one, and returns the first error. Returns only
+   * once every recovery is done; the first exception thrown by one is
+   * rethrown then.
+   */
+  static GfErrType recoverInterest(
+      ThreadPool& threadPool,
+      const std::vector<std::function<GfErrType()>>& recoveries);
+
   void destroy(bool keepAlive = false) override;
 
   void readyForEvents();
@@ -31,6 +31,7 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "DataInputInternal.hpp"
+#include "DeserializationArena.hpp"
 #include "PutAllPartialResultServerException.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "RemoteQuery.hpp"
@@ -51,14 +52,11 @@ namespace client {
 
 void setThreadLocalExceptionMessage(std::string exMsg);
 
-class PutAllWork : public PooledWork<GfErrType> {
+class PutAllWork : public FanOutWork {
   ThinClientPoolDM* m_poolDM;
   std::shared_ptr<BucketServerLocation> m_serverLocation;
   TcrMessage* m_request;
   TcrMessageReply* m_reply;
-  bool m_attemptFailover;
-  bool m_isBGThread;
-  std::shared_ptr<UserAttributes> m_userAttribute;
   const std::shared_ptr<Region> m_region;
   std::shared_ptr<HashMapOfCacheable> m_map;
   std::shared_ptr<VersionedCacheableObjectPartList> m_verObjPartListPtr;
@@ -77,11 +75,9 @@ class PutAllWork : public PooledWork<GfErrType> {
       const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> keys,
       std::chrono::milliseconds timeout,
       const std::shared_ptr<Serializable>& aCallbackArgument)
-      : m_poolDM(poolDM),
+      : FanOutWork(serverLocation, attemptFailover, isBGThread),
+        m_poolDM(poolDM),
         m_serverLocation(serverLocation),
-        m_attemptFailover(attemptFailover),
-        m_isBGThread(isBGThread),
-        m_userAttribute(nullptr),
         m_region(region),
         m_map(map),
         m_timeout(timeout),
@@ -96,10 +92,6 @@ class PutAllWork : public PooledWork<GfErrType> {
     m_verObjPartListPtr =
         std::make_shared<VersionedCacheableObjectPartList>(keys, responseLock);
 
-    if (m_poolDM->isMultiUserMode()) {
-      m_userAttribute = UserAttributes::threadLocalUserAttributes;
-    }
-
     m_request->setTimeout(m_timeout);
     m_reply->setTimeout(m_timeout);
     m_resultCollector = new ChunkedPutAllResponse(
@@ -126,17 +118,12 @@ class PutAllWork : public PooledWork<GfErrType> {
   }
 
   void init() {}
-  GfErrType execute(void) override {
-    GuardUserAttributes gua;
-
-    if (m_userAttribute != nullptr) {
-      gua.setAuthenticatedView(m_userAttribute->getAuthenticatedView());
-    }
 
-    GfErrType err = GF_NOERR;
-    err = m_poolDM->sendSyncRequest(*m_request, *m_reply, m_attemptFailover,
-                                    m_isBGThread, m_serverLocation);
+ protected:
+  TcrMessage& request() override { return *m_request; }
+  TcrMessageReply& reply() override { return *m_reply; }
 
+  GfErrType complete(GfErrType err) override {
     // Set Version Tags
     LOGDEBUG(" m_verObjPartListPtr size = %d err = %d ",
              m_resultCollector->getList()->size(), err);
@@ -185,14 +172,11 @@ class PutAllWork : public PooledWork<GfErrType> {
   }
 };
 
-class RemoveAllWork : public PooledWork<GfErrType> {
+class RemoveAllWork : public FanOutWork {
   ThinClientPoolDM* m_poolDM;
   std::shared_ptr<BucketServerLocation> m_serverLocation;
   TcrMessage* m_request;
   TcrMessageReply* m_reply;
-  bool m_attemptFailover;
-  bool m_isBGThread;
-  std::shared_ptr<UserAttributes> m_userAttribute;
   const std::shared_ptr<Region> m_region;
   const std::shared_ptr<Serializable>& m_aCallbackArgument;
   std::shared_ptr<VersionedCacheableObjectPartList> m_verObjPartListPtr;
@@ -209,11 +193,9 @@ class RemoveAllWork : public PooledWork<GfErrType> {
       bool isBGThread,
       const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> keys,
       const std::shared_ptr<Serializable>& aCallbackArgument)
-      : m_poolDM(poolDM),
+      : FanOutWork(serverLocation, attemptFailover, isBGThread),
+        m_poolDM(poolDM),
         m_serverLocation(serverLocation),
-        m_attemptFailover(attemptFailover),
-        m_isBGThread(isBGThread),
-        m_userAttribute(nullptr),
         m_region(region),
         m_aCallbackArgument(aCallbackArgument),
         m_papException(nullptr) {
@@ -226,10 +208,6 @@ class RemoveAllWork : public PooledWork<GfErrType> {
     m_verObjPartListPtr =
         std::make_shared<VersionedCacheableObjectPartList>(keys, responseLock);
 
-    if (m_poolDM->isMultiUserMode()) {
-      m_userAttribute = UserAttributes::threadLocalUserAttributes;
-    }
-
     m_resultCollector =
         new ChunkedRemoveAllResponse(m_region, *m_reply, m_verObjPartListPtr);
     m_reply->setChunkedResultHandler(m_resultCollector);
@@ -252,17 +230,12 @@ class RemoveAllWork : public PooledWork<GfErrType> {
   }
 
   void init() {}
-  GfErrType execute(void) override {
-    GuardUserAttributes gua;
-
-    if (m_userAttribute != nullptr) {
-      gua.setAuthenticatedView(m_userAttribute->getAuthenticatedView());
-    }
 
-    GfErrType err = GF_NOERR;
-    err = m_poolDM->sendSyncRequest(*m_request, *m_reply, m_attemptFailover,
-                                    m_isBGThread, m_serverLocation);
+ protected:
+  TcrMessage& request() override { return *m_request; }
+  TcrMessageReply& reply() override { return *m_reply; }
 
+  GfErrType complete(GfErrType err) override {
     // Set Version Tags
     LOGDEBUG(" m_verObjPartListPtr size = %d err = %d ",
              m_resultCollector->getList()->size(), err);
@@ -1218,12 +1191,11 @@ GfErrType ThinClientRegion::singleHopPutAllNoThrow_remote(
    * (locationIter.second()) and its corr. values from the user Map.
    *  c. create new instance of PutAllWork, i.e worker with required params.
    *     //TODO:: Add details of each parameter later
-   *  d. enqueue the worker for thread from threadPool to perform/run execute
-   * method.
-   *  e. insert the worker into the vector.
+   *  d. insert the worker into the vector.
+   *  e. send the requests of all the workers together.
    */
   std::vector<std::shared_ptr<PutAllWork>> putAllWorkers;
-  auto& threadPool = m_cacheImpl->getThreadPool();
+  std::vector<FanOutWork*> fanOut;
   int locationMapIndex = 0;
   for (const auto& locationIter : *locationMap) {
     const auto& serverLocation = locationIter.first;
@@ -1246,10 +1218,11 @@ GfErrType ThinClientRegion::singleHopPutAllNoThrow_remote(
     auto worker = std::make_shared<PutAllWork>(
         tcrdm, serverLocation, region, true /*attemptFailover*/,
         false /*isBGThread*/, filteredMap, keys, timeout, aCallbackArgument);
-    threadPool.perform(worker);
+    fanOut.push_back(worker.get());
     putAllWorkers.push_back(worker);
     locationMapIndex++;
   }
+  tcrdm->sendFanOut(fanOut);
 
   // TODO::CHECK, do we need to set following ..??
   // reply.setMessageType(TcrMessage::RESPONSE);
@@ -1272,8 +1245,7 @@ GfErrType ThinClientRegion::singleHopPutAllNoThrow_remote(
   auto failedServers = FailedServersMap();
 
   for (const auto& worker : putAllWorkers) {
-    auto err =
-        worker->getResult();  // wait() or blocking call for worker thread.
+    auto err = worker->getResult();
     LOGDEBUG("Error code :: %s:%d err = %d ", __FILE__, __LINE__, err);
 
     if (GF_NOERR == err) {
@@ -1594,12 +1566,11 @@ GfErrType ThinClientRegion::singleHopRemoveAllNoThrow_remote(
    * (locationIter.second()) and its corr. values from the user Map.
    *  c. create new instance of RemoveAllWork, i.e worker with required params.
    *     //TODO:: Add details of each parameter later
-   *  d. enqueue the worker for thread from threadPool to perform/run execute
-   * method.
-   *  e. insert the worker into the vector.
+   *  d. insert the worker into the vector.
+   *  e. send the requests of all the workers together.
    */
   std::vector<std::shared_ptr<RemoveAllWork>> removeAllWorkers;
-  auto& threadPool = m_cacheImpl->getThreadPool();
+  std::vector<FanOutWork*> fanOut;
   int locationMapIndex = 0;
   for (const auto& locationIter : *locationMap) {
     const auto& serverLocation = locationIter.first;
@@ -1610,10 +1581,11 @@ GfErrType ThinClientRegion::singleHopRemoveAllNoThrow_remote(
     auto worker = std::make_shared<RemoveAllWork>(
         tcrdm, serverLocation, region, true /*attemptFailover*/,
         false /*isBGThread*/, mappedkeys, aCallbackArgument);
-    threadPool.perform(worker);
+    fanOut.push_back(worker.get());
     removeAllWorkers.push_back(worker);
     locationMapIndex++;
   }
+  tcrdm->sendFanOut(fanOut);
   // TODO::CHECK, do we need to set following ..??
   // reply.setMessageType(TcrMessage::RESPONSE);
 
@@ -1634,8 +1606,7 @@ GfErrType ThinClientRegion::singleHopRemoveAllNoThrow_remote(
   auto resultMap = ResultMap();
   auto failedServers = FailedServersMap();
   for (const auto& worker : removeAllWorkers) {
-    auto err =
-        worker->getResult();  // wait() or blocking call for worker thread.
+    auto err = worker->getResult();
     LOGDEBUG("Error code :: %s:%d err = %d ", __FILE__, __LINE__, err);
 
     if (GF_NOERR == err) {
@@ -1940,6 +1911,50 @@ GfErrType ThinClientRegion::registerStoredRegex(
   return retVal;
 }
 
+constexpr size_t ThinClientRegion::INTEREST_RECOVERY_BATCH_SIZE;
+
+// Registers the keys in batches so that no single message, nor the values
+// it loads for KEYS_VALUES, holds up the region for long.
+GfErrType ThinClientRegion::registerStoredKeys(
+    TcrEndpoint* endpoint,
+    const std::vector<std::shared_ptr<CacheableKey>>& keys, bool isDurable,
+    InterestResultPolicy interestPolicy, bool receiveValues) {
+  auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm.get());
+  return registerInBatches(
+      keys, INTEREST_RECOVERY_BATCH_SIZE,
+      poolDM != nullptr ? &poolDM->getStats() : nullptr,
+      [&](const std::vector<std::shared_ptr<CacheableKey>>& batch) {
+        return registerKeysNoThrow(batch, false, endpoint, isDurable,
+                                   interestPolicy, receiveValues);
+      });
+}
+
+GfErrType ThinClientRegion::registerInBatches(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys, size_t batchSize,
+    PoolStats* stats,
+    const std::function<GfErrType(
+        const std::vector<std::shared_ptr<CacheableKey>>&)>& registerBatch) {
+  for (size_t begin = 0; begin < keys.size(); begin += batchSize) {
+    auto end = std::min(keys.size(), begin + batchSize);
+    std::vector<std::shared_ptr<CacheableKey>> batch(keys.begin() + begin,
+                                                     keys.begin() + end);
+
+    auto start = std::chrono::steady_clock::now();
+    auto err = registerBatch(batch);
+    if (err != GF_NOERR) {
+      // the endpoint is most likely gone, do not wait on the other batches
+      return err;
+    }
+
+    if (stats != nullptr) {
+      stats->incInterestRecoveryBatches(
+          batch.size(), std::chrono::steady_clock::now() - start);
+    }
+  }
+
+  return GF_NOERR;
+}
+
 void ThinClientRegion::clearKeysOfInterest() {
   if (!getAttributes().getCachingEnabled()) {
     return;
@@ -1978,20 +1993,19 @@ GfErrType ThinClientRegion::registerKeys(TcrEndpoint* endpoint,
   std::vector<std::shared_ptr<CacheableKey>> keysVec;
   InterestResultPolicy interestPolicy =
       copyInterestList(keysVec, m_interestList);
-  opErr = registerKeysNoThrow(keysVec, false, endpoint, false, interestPolicy);
+  opErr = registerStoredKeys(endpoint, keysVec, false, interestPolicy);
   err = opErr != GF_NOERR ? opErr : err;
 
   std::vector<std::shared_ptr<CacheableKey>> keysVecForUpdatesAsInvalidates;
   interestPolicy = copyInterestList(keysVecForUpdatesAsInvalidates,
                                     m_interestListForUpdatesAsInvalidates);
-  opErr = registerKeysNoThrow(keysVecForUpdatesAsInvalidates, false, endpoint,
-                              false, interestPolicy, false);
+  opErr = registerStoredKeys(endpoint, keysVecForUpdatesAsInvalidates, false,
+                             interestPolicy, false);
   err = opErr != GF_NOERR ? opErr : err;
 
   std::vector<std::shared_ptr<CacheableKey>> keysVecDurable;
   interestPolicy = copyInterestList(keysVecDurable, m_durableInterestList);
-  opErr = registerKeysNoThrow(keysVecDurable, false, endpoint, true,
-                              interestPolicy);
+  opErr = registerStoredKeys(endpoint, keysVecDurable, true, interestPolicy);
   err = opErr != GF_NOERR ? opErr : err;
 
   std::vector<std::shared_ptr<CacheableKey>>
@@ -1999,8 +2013,8 @@ GfErrType ThinClientRegion::registerKeys(TcrEndpoint* endpoint,
   interestPolicy =
       copyInterestList(keysVecDurableForUpdatesAsInvalidates,
                        m_durableInterestListForUpdatesAsInvalidates);
-  opErr = registerKeysNoThrow(keysVecDurableForUpdatesAsInvalidates, false,
-                              endpoint, true, interestPolicy, false);
+  opErr = registerStoredKeys(endpoint, keysVecDurableForUpdatesAsInvalidates,
+                             true, interestPolicy, false);
   err = opErr != GF_NOERR ? opErr : err;
 
   if (request != nullptr && request->getRegionName() == m_fullPath &&
@@ -3029,22 +3043,33 @@ bool ThinClientRegion::executeFunctionSH(
     std::shared_ptr<CacheableHashSet>& failedNodes,
     std::chrono::milliseconds timeout, bool allBuckets) {
   bool reExecute = false;
-  auto resultCollectorLock = std::make_shared<std::recursive_mutex>();
-  const auto& userAttr = UserAttributes::threadLocalUserAttributes;
+  // a streaming collector takes its results without a lock
+  std::shared_ptr<std::recursive_mutex> resultCollectorLock;
+  if (!std::dynamic_pointer_cast<StreamingResultCollector>(rc)) {
+    resultCollectorLock = std::make_shared<std::recursive_mutex>();
+  }
+  auto clearResults = [&rc, &resultCollectorLock] {
+    if (resultCollectorLock) {
+      std::lock_guard<std::recursive_mutex> guard(*resultCollectorLock);
+      rc->clearResults();
+    } else {
+      rc->clearResults();
+    }
+  };
+  auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm.get());
   std::vector<std::shared_ptr<OnRegionFunctionExecution>> feWorkers;
-  auto& threadPool =
-      CacheRegionHelper::getCacheImpl(&getCache())->getThreadPool();
+  std::vector<FanOutWork*> fanOut;
 
   for (const auto& locationIter : *locationMap) {
     const auto& serverLocation = locationIter.first;
     const auto& routingObj = locationIter.second;
     auto worker = std::make_shared<OnRegionFunctionExecution>(
-        func, this, args, routingObj, getResult, timeout,
-        dynamic_cast<ThinClientPoolDM*>(m_tcrdm.get()), resultCollectorLock, rc,
-        userAttr, false, serverLocation, allBuckets);
-    threadPool.perform(worker);
+        func, this, args, routingObj, getResult, timeout, poolDM,
+        resultCollectorLock, rc, false, serverLocation, allBuckets);
+    fanOut.push_back(worker.get());
     feWorkers.push_back(worker);
   }
+  poolDM->sendFanOut(fanOut);
 
   GfErrType abortError = GF_NOERR;
 
@@ -3075,11 +3100,7 @@ bool ThinClientRegion::executeFunctionSH(
         } else if (getResult & 1) {  // isHA = true
           reExecute = true;
           worker->getResultCollector()->reset();
-          {
-            std::lock_guard<decltype(*resultCollectorLock)> guard(
-                *resultCollectorLock);
-            rc->clearResults();
-          }
+          clearResults();
           std::shared_ptr<CacheableHashSet> failedNodeIds(
               currentReply->getFailedNode());
           if (failedNodeIds) {
@@ -3109,11 +3130,7 @@ bool ThinClientRegion::executeFunctionSH(
         } else if (getResult & 1) {  // isHA = true
           reExecute = true;
           worker->getResultCollector()->reset();
-          {
-            std::lock_guard<decltype(*resultCollectorLock)> guard(
-                *resultCollectorLock);
-            rc->clearResults();
-          }
+          clearResults();
         }
       } else {
         if (ThinClientBaseDM::isFatalClientError(err)) {
@@ -3349,6 +3366,7 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
                                        const CacheImpl* cacheImpl) {
   LOGDEBUG("ChunkedQueryResponse::handleChunk..");
   auto input = cacheImpl->createDataInput(chunk, chunkLen, m_msg.getPool());
+  DeserializationArena::Scope arenaScope(input, getArena(cacheImpl));
 
   uint32_t partLen;
   auto objType = TcrMessageHelper::readChunkPartHeader(
@@ -3488,6 +3506,7 @@ void ChunkedFunctionExecutionResponse::handleChunk(
     const CacheImpl* cacheImpl) {
   LOGDEBUG("ChunkedFunctionExecutionResponse::handleChunk");
   auto input = cacheImpl->createDataInput(chunk, chunkLen, m_msg.getPool());
+  DeserializationArena::Scope arenaScope(input, getArena(cacheImpl));
 
   uint32_t partLen;
 
@@ -3513,6 +3532,14 @@ void ChunkedFunctionExecutionResponse::handleChunk(
     return;
   }
 
+  if (isCancelled()) {
+    // the caller has all the results it needs, skip the rest of the part
+    // without deserializing it; the array type byte is already read
+    input.advanceCursor(partLen - 1);
+    m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+    return;
+  }
+
   // from here need to look value part + memberid AND -1 for array type
   auto startLen = static_cast<size_t>(input.getBytesRead() - 1);
 
@@ -3615,6 +3642,7 @@ void ChunkedFunctionExecutionResponse::handleChunk(
 
 void ChunkedGetAllResponse::reset() {
   m_keysOffset = 0;
+  m_bytesReceived = 0;
   if (m_resultKeys != nullptr && m_resultKeys->size() > 0) {
     m_resultKeys->clear();
   }
@@ -3624,7 +3652,10 @@ void ChunkedGetAllResponse::reset() {
 void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
                                         uint8_t isLastChunkWithSecurity,
                                         const CacheImpl* cacheImpl) {
+  m_bytesReceived += chunkLen;
   auto input = cacheImpl->createDataInput(chunk, chunkLen, m_msg.getPool());
+  DeserializationArena::Scope arenaScope(
+      input, m_addToLocalCache ? nullptr : getArena(cacheImpl));
 
   uint32_t partLen;
   if (TcrMessageHelper::readChunkPartHeader(
@@ -20,10 +20,12 @@
 #ifndef GEODE_THINCLIENTREGION_H_
 #define GEODE_THINCLIENTREGION_H_
 
+#include <functional>
 #include <mutex>
 #include <unordered_map>
 
 #include <geode/ResultCollector.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/internal/functional.hpp>
 
 #include "CacheableObjectPartList.hpp"
@@ -38,6 +40,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class PoolStats;
 class ThinClientBaseDM;
 class TcrEndpoint;
 
@@ -117,6 +120,21 @@ class ThinClientRegion : public LocalRegion {
                          const TcrMessage* request = nullptr,
                          TcrMessageReply* reply = nullptr);
   GfErrType unregisterKeys();
+
+  /** keys per register interest message when recovering interest */
+  static constexpr size_t INTEREST_RECOVERY_BATCH_SIZE = 10000;
+
+  /**
+   * Passes keys to registerBatch in consecutive batches of at most batchSize
+   * keys and records each registered batch in stats, unless it is null.
+   * Stops at the first batch that fails and returns its error.
+   */
+  static GfErrType registerInBatches(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      size_t batchSize, PoolStats* stats,
+      const std::function<GfErrType(
+          const std::vector<std::shared_ptr<CacheableKey>>&)>& registerBatch);
+
   void addKeys(const std::vector<std::shared_ptr<CacheableKey>>& keys,
                bool isDurable, bool receiveValues,
                InterestResultPolicy interestpolicy);
@@ -312,6 +330,10 @@ class ThinClientRegion : public LocalRegion {
       TcrEndpoint*,
       std::unordered_map<std::string, InterestResultPolicy>& interestListRegex,
       bool isDurable = false, bool receiveValues = true);
+  GfErrType registerStoredKeys(
+      TcrEndpoint* endpoint,
+      const std::vector<std::shared_ptr<CacheableKey>>& keys, bool isDurable,
+      InterestResultPolicy interestPolicy, bool receiveValues = true);
   GfErrType unregisterStoredRegex(
       std::unordered_map<std::string, InterestResultPolicy>& interestListRegex);
   GfErrType unregisterStoredRegexLocalDestroy(
@@ -454,12 +476,17 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
   // std::shared_ptr<CacheableVector>  m_functionExecutionResults;
   bool m_getResult;
   std::shared_ptr<ResultCollector> m_rc;
+  StreamingResultCollector* m_streaming;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
 
  public:
   inline ChunkedFunctionExecutionResponse(TcrMessage& msg, bool getResult,
                                           std::shared_ptr<ResultCollector> rc)
-      : TcrChunkedResult(), m_msg(msg), m_getResult(getResult), m_rc(rc) {}
+      : TcrChunkedResult(),
+        m_msg(msg),
+        m_getResult(getResult),
+        m_rc(rc),
+        m_streaming(dynamic_cast<StreamingResultCollector*>(rc.get())) {}
 
   inline ChunkedFunctionExecutionResponse(
       TcrMessage& msg, bool getResult, std::shared_ptr<ResultCollector> rc,
@@ -468,6 +495,7 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
+        m_streaming(dynamic_cast<StreamingResultCollector*>(rc.get())),
         m_resultCollectorLock(resultCollectorLock) {}
 
   ChunkedFunctionExecutionResponse(const ChunkedFunctionExecutionResponse&) =
@@ -479,6 +507,13 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
 
   inline bool getResult() const { return m_getResult; }
 
+  /**
+   * True if the results are streamed to a caller that needs no more of them.
+   */
+  inline bool isCancelled() const {
+    return m_streaming != nullptr && m_streaming->isCancelled();
+  }
+
   void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                    uint8_t isLastChunkWithSecurity,
                    const CacheImpl* cacheImpl) override;
@@ -502,6 +537,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   int32_t m_destroyTracker;
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
+  size_t m_bytesReceived;
   std::recursive_mutex& m_responseLock;
 
  public:
@@ -525,6 +561,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
         m_destroyTracker(destroyTracker),
         m_addToLocalCache(addToLocalCache),
         m_keysOffset(0),
+        m_bytesReceived(0),
         m_responseLock(responseLock) {}
 
   ChunkedGetAllResponse(const ChunkedGetAllResponse&) = delete;
@@ -546,6 +583,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   }
   MapOfUpdateCounters& getUpdateCounters() { return m_trackerMap; }
   std::recursive_mutex& getResponseLock() { return m_responseLock; }
+  size_t getBytesReceived() const { return m_bytesReceived; }
 };
 
 /**
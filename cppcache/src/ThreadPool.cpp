@@ -14,8 +14,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
 #include "ThreadPool.hpp"
 
+#include "CachePerfStats.hpp"
 #include "DistributedSystemImpl.hpp"
 #include "util/Log.hpp"
 
@@ -23,39 +25,37 @@ namespace apache {
 namespace geode {
 namespace client {
 
-ThreadPool::ThreadPool(size_t threadPoolSize)
-    : shutdown_(false), appDomainContext_(createAppDomainContext()) {
-  workers_.reserve(threadPoolSize);
-
-  std::function<void()> executeWork = [this] {
-    Log::setThreadName("NC Pool Thread");
-    while (true) {
-      std::unique_lock<decltype(queueMutex_)> lock(queueMutex_);
-      queueCondition_.wait(lock,
-                           [this] { return shutdown_ || !queue_.empty(); });
-
-      if (shutdown_) {
-        break;
-      }
+namespace {
 
-      auto work = queue_.front();
-      queue_.pop_front();
+// Pool and deque owned by the current thread, if it is a pool thread.
+thread_local ThreadPool* currentPool = nullptr;
+thread_local size_t currentQueue = 0;
 
-      lock.unlock();
+}  // namespace
 
-      try {
-        work->call();
-      } catch (...) {
-        // ignore
-      }
-    }
-  };
+ThreadPool::ThreadPool(size_t threadPoolSize)
+    : shutdown_(false),
+      nextQueue_(0),
+      pending_(0),
+      sleeping_(0),
+      stats_(nullptr),
+      appDomainContext_(createAppDomainContext()) {
+  queues_.reserve(threadPoolSize);
+  workers_.reserve(threadPoolSize);
 
-  if (appDomainContext_) {
-    executeWork = [executeWork, this] { appDomainContext_->run(executeWork); };
+  for (size_t i = 0; i < threadPoolSize; i++) {
+    queues_.emplace_back(new WorkQueue());
   }
 
   for (size_t i = 0; i < threadPoolSize; i++) {
+    std::function<void()> executeWork = [this, i] { run(i); };
+
+    if (appDomainContext_) {
+      executeWork = [executeWork, this] {
+        appDomainContext_->run(executeWork);
+      };
+    }
+
     workers_.emplace_back(executeWork);
   }
 }
@@ -63,33 +63,111 @@ ThreadPool::ThreadPool(size_t threadPoolSize)
 ThreadPool::~ThreadPool() { shutDown(); }
 
 void ThreadPool::perform(std::shared_ptr<Callable> req) {
+  if (queues_.empty()) {
+    // No workers; PooledWork runs when its result is requested.
+    return;
+  }
+
+  auto index = currentPool == this
+                   ? currentQueue
+                   : nextQueue_.fetch_add(1) % queues_.size();
+  auto& queue = *queues_[index];
   {
-    std::lock_guard<decltype(queueMutex_)> lock(queueMutex_);
-    queue_.push_back(std::move(req));
-    if (queue_.size() > 1) {
-      return;
-    }
+    std::lock_guard<decltype(queue.mutex)> lock(queue.mutex);
+    queue.tasks.push_back({std::move(req), std::chrono::steady_clock::now()});
+    ++pending_;
   }
 
-  queueCondition_.notify_all();
+  if (sleeping_ > 0) {
+    // Serialize with a worker between checking pending_ and waiting.
+    { std::lock_guard<decltype(sleepMutex_)> lock(sleepMutex_); }
+    sleepCondition_.notify_one();
+  }
 }
 
 void ThreadPool::shutDown(void) {
   {
-    std::lock_guard<decltype(queueMutex_)> lock(queueMutex_);
+    std::lock_guard<decltype(sleepMutex_)> lock(sleepMutex_);
     if (shutdown_) {
       return;
     }
     shutdown_ = true;
   }
 
-  queueCondition_.notify_all();
+  sleepCondition_.notify_all();
 
   for (auto& worker : workers_) {
     worker.join();
   }
 }
 
+void ThreadPool::setCachePerfStats(CachePerfStats* stats) { stats_ = stats; }
+
+void ThreadPool::run(size_t index) {
+  Log::setThreadName("NC Pool Thread");
+  currentPool = this;
+  currentQueue = index;
+
+  Task task;
+  while (!shutdown_) {
+    if (take(index, task)) {
+      execute(task);
+      continue;
+    }
+
+    std::unique_lock<decltype(sleepMutex_)> lock(sleepMutex_);
+    ++sleeping_;
+    sleepCondition_.wait(lock, [this] { return shutdown_ || pending_ > 0; });
+    --sleeping_;
+  }
+
+  currentPool = nullptr;
+}
+
+bool ThreadPool::take(size_t index, Task& task) {
+  {
+    auto& own = *queues_[index];
+    std::lock_guard<decltype(own.mutex)> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      --pending_;
+      return true;
+    }
+  }
+
+  for (size_t i = 1; i < queues_.size(); i++) {
+    auto& victim = *queues_[(index + i) % queues_.size()];
+    std::unique_lock<decltype(victim.mutex)> lock(victim.mutex,
+                                                  std::try_to_lock);
+    if (lock.owns_lock() && !victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      --pending_;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::execute(Task& task) {
+  if (auto stats = stats_.load()) {
+    stats->incThreadPoolTasks(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - task.queued)
+            .count());
+  }
+
+  try {
+    task.callable->call();
+  } catch (...) {
+    // ignore
+  }
+
+  task.callable = nullptr;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -21,8 +21,11 @@
 #define GEODE_THREADPOOL_H_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <exception>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -33,40 +36,71 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class CachePerfStats;
+
 class Callable {
  public:
   virtual ~Callable() noexcept = default;
   virtual void call() = 0;
 };
 
+/**
+ * Unit of work whose result is awaited with getResult(). If no pool thread
+ * has started the work by the time its result is requested, the requesting
+ * thread runs it inline, so fan-out from within a pool thread, or from a
+ * pool with no threads, cannot deadlock waiting for a free worker.
+ */
 template <class T>
 class PooledWork : public Callable {
  private:
+  enum class State { QUEUED, RUNNING, DONE };
+
   T m_retVal;
-  std::recursive_mutex m_mutex;
-  std::condition_variable_any m_cond;
-  bool m_done;
+  std::exception_ptr m_exception;
+  std::atomic<State> m_state;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+
+  bool claim() {
+    auto expected = State::QUEUED;
+    return m_state.compare_exchange_strong(expected, State::RUNNING);
+  }
+
+  void run() {
+    try {
+      m_retVal = execute();
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+      m_state = State::DONE;
+    }
+    m_cond.notify_all();
+  }
 
  public:
-  PooledWork() : m_mutex(), m_cond(), m_done(false) {}
+  PooledWork() : m_retVal(), m_state(State::QUEUED) {}
 
   ~PooledWork() noexcept override = default;
 
   void call() override {
-    T res = execute();
-
-    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-
-    m_retVal = res;
-    m_done = true;
-    m_cond.notify_all();
+    if (claim()) {
+      run();
+    }
   }
 
   T getResult(void) {
-    std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+    if (claim()) {
+      run();
+    } else if (m_state != State::DONE) {
+      std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+      m_cond.wait(lock, [this] { return m_state == State::DONE; });
+    }
 
-    while (!m_done) {
-      m_cond.wait(lock, [this] { return m_done; });
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
     }
 
     return m_retVal;
@@ -76,6 +110,12 @@ class PooledWork : public Callable {
   virtual T execute(void) = 0;
 };
 
+/**
+ * Work-stealing executor for fan-out operations. Each worker owns a deque;
+ * work submitted from a worker goes to that worker's deque and is taken
+ * newest first, while work submitted from other threads is spread across
+ * the deques. Idle workers steal the oldest work from their peers.
+ */
 class ThreadPool {
  public:
   explicit ThreadPool(size_t threadPoolSize);
@@ -85,13 +125,36 @@ class ThreadPool {
 
   void shutDown(void);
 
+  /**
+   * Records task counts and queue wait time in stats. The stats must
+   * outlive the pool threads, or be reset to nullptr first.
+   */
+  void setCachePerfStats(CachePerfStats* stats);
+
  private:
-  bool shutdown_;
+  struct Task {
+    std::shared_ptr<Callable> callable;
+    std::chrono::steady_clock::time_point queued;
+  };
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void run(size_t index);
+  bool take(size_t index, Task& task);
+  void execute(Task& task);
+
+  std::atomic<bool> shutdown_;
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
   std::vector<std::thread> workers_;
-  std::deque<std::shared_ptr<Callable>> queue_;
-  std::mutex queueMutex_;
-  std::condition_variable queueCondition_;
-  static const char* NC_Pool_Thread;
+  std::atomic<size_t> nextQueue_;
+  std::atomic<size_t> pending_;
+  std::atomic<size_t> sleeping_;
+  std::mutex sleepMutex_;
+  std::condition_variable sleepCondition_;
+  std::atomic<CachePerfStats*> stats_;
   AppDomainContext* appDomainContext_;
 };
 
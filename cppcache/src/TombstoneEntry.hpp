@@ -21,9 +21,10 @@
 #define GEODE_TOMBSTONEENTRY_H_
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
-#include "ExpiryTask.hpp"
 #include "MapEntry.hpp"
 
 namespace apache {
@@ -32,19 +33,37 @@ namespace client {
 
 class TombstoneEntry {
  public:
-  explicit TombstoneEntry(std::shared_ptr<MapEntryImpl> entry)
-      : entry_(std::move(entry)), task_id_(ExpiryTask::invalid()) {}
+  using clock = std::chrono::steady_clock;
+
+  TombstoneEntry(std::shared_ptr<MapEntryImpl> entry, uint16_t member_id,
+                 int64_t region_version)
+      : entry_(std::move(entry)),
+        member_id_(member_id),
+        region_version_(region_version) {}
 
   std::shared_ptr<MapEntryImpl> entry() { return entry_; }
-  ExpiryTask::id_t task_id() { return task_id_; }
-  void task_id(ExpiryTask::id_t task_id) { task_id_ = task_id; }
+
+  // version of the entry when it became a tombstone
+  uint16_t member_id() const { return member_id_; }
+  int64_t region_version() const { return region_version_; }
+
+  // where the tombstone is held in the generations of its TombstoneList
+  clock::time_point generation() const { return generation_; }
+  size_t generation_index() const { return generation_index_; }
+  void generation(clock::time_point generation, size_t index) {
+    generation_ = generation;
+    generation_index_ = index;
+  }
 
   void invalidate() { valid_ = false; }
   bool valid() const { return valid_; }
 
  protected:
   std::shared_ptr<MapEntryImpl> entry_;
-  ExpiryTask::id_t task_id_;
+  uint16_t member_id_;
+  int64_t region_version_;
+  clock::time_point generation_;
+  size_t generation_index_{0};
   bool valid_{true};
 };
 
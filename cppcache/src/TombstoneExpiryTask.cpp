@@ -18,30 +18,27 @@
 #include "TombstoneExpiryTask.hpp"
 
 #include "MapSegment.hpp"
-#include "TombstoneEntry.hpp"
 #include "Utils.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
-TombstoneExpiryTask::TombstoneExpiryTask(
-    ExpiryTaskManager& manager, MapSegment& segment,
-    std::shared_ptr<TombstoneEntry> tombstone)
-    : ExpiryTask(manager),
-      segment_(segment),
-      tombstone_(std::move(tombstone)) {}
+TombstoneExpiryTask::TombstoneExpiryTask(ExpiryTaskManager& manager,
+                                         MapSegment& segment)
+    : ExpiryTask(manager), segment_(segment) {}
 
 bool TombstoneExpiryTask::on_expire() {
-  std::shared_ptr<CacheableKey> key;
-  tombstone_->entry()->getKeyI(key);
-
-  LOGDEBUG(
-      "TombstoneExpiryTask::on_expire LOCAL_DESTROY "
-      "for region entry with key %s",
-      Utils::nullSafeToString(key).c_str());
-  segment_.remove_tomb_entry(tombstone_);
-  return true;
+  LOGDEBUG("TombstoneExpiryTask::on_expire expiring tombstones");
+
+  std::chrono::steady_clock::time_point next;
+  if (!segment_.expire_tombstones(next)) {
+    return true;
+  }
+
+  // keep the task for the next generation
+  reset(next);
+  return false;
 }
 
 }  // namespace client
@@ -29,23 +29,21 @@ namespace geode {
 namespace client {
 
 class MapSegment;
-class TombstoneEntry;
 
 /**
  * @class TombstoneExpiryTask TombstoneExpiryTask.hpp
  *
- * The task which gets triggered when a tombstone expires.
+ * The task which gets triggered when the oldest generation of tombstones of
+ * a segment expires.
  */
 class TombstoneExpiryTask : public ExpiryTask {
  public:
   /**
    * Class constructor
    * @param manager A reference to the expiry manager
-   * @param segment A reference to the MapSegment the entry sits in
-   * @param tombstone Tombstone entry
+   * @param segment A reference to the MapSegment the tombstones sit in
    */
-  TombstoneExpiryTask(ExpiryTaskManager& manager, MapSegment& segment,
-                      std::shared_ptr<TombstoneEntry> tombstone);
+  TombstoneExpiryTask(ExpiryTaskManager& manager, MapSegment& segment);
 
  protected:
   bool on_expire() override;
@@ -54,14 +52,9 @@ class TombstoneExpiryTask : public ExpiryTask {
   /// Member attributes
 
   /**
-   * Reference to the map segment in which the entry is
+   * Reference to the map segment in which the tombstones are
    */
   MapSegment& segment_;
-
-  /**
-   * Tombstone entry
-   */
-  std::shared_ptr<TombstoneEntry> tombstone_;
 };
 }  // namespace client
 }  // namespace geode
@@ -17,7 +17,7 @@
 
 #include "TombstoneList.hpp"
 
-#include <unordered_set>
+#include <algorithm>
 
 #include <geode/SystemProperties.hpp>
 
@@ -33,41 +33,76 @@ namespace client {
 // TODO. Review this overhead is OK
 #define SIZEOF_PTR (sizeof(void*))
 #define SIZEOF_SHAREDPTR (SIZEOF_PTR + 4)
-// 3 variables in expiry handler, two variables for ace_reactor expiry, one
-// pointer to expiry handle
-#define SIZEOF_EXPIRYHANDLER ((SIZEOF_PTR * 5) + 4)
 #define SIZEOF_TOMBSTONEENTRY (SIZEOF_PTR + 8 + 8)
 // one shared ptr for map entry, one sharedPtr for tombstone entry, one
 // sharedptr for key, one shared ptr for tombstone value,
 // one ptr for tombstone list, one ptr for mapsegment, one tombstone entry
 #define SIZEOF_TOMBSTONELISTENTRY \
   (SIZEOF_SHAREDPTR * 4 + SIZEOF_PTR * 2 + SIZEOF_TOMBSTONEENTRY)
+// one shared ptr in the generation, one version index node with three
+// pointers, color, version and tombstone pointer
+#define SIZEOF_TOMBSTONEINDEXES \
+  (SIZEOF_SHAREDPTR + SIZEOF_PTR * 5 + 8 + 8)
 #define SIZEOF_TOMBSTONEOVERHEAD \
-  (SIZEOF_EXPIRYHANDLER + SIZEOF_TOMBSTONELISTENTRY)
+  (SIZEOF_TOMBSTONELISTENTRY + SIZEOF_TOMBSTONEINDEXES)
 
-ExpiryTask::id_t TombstoneList::add(
-    const std::shared_ptr<MapEntryImpl>& entry) {
+namespace {
+
+// each generation spans this fraction of the tombstone timeout
+const int TOMBSTONE_GENERATIONS = 10;
+
+}  // namespace
+
+TombstoneList::TombstoneList(MapSegment& segment, CacheImpl& cache)
+    : task_id_(ExpiryTask::invalid()), segment_(segment), cache_(cache) {
+  auto timeout =
+      cache_.getDistributedSystem().getSystemProperties().tombstoneTimeout();
+  generation_span_ =
+      std::max<clock::duration>(timeout / TOMBSTONE_GENERATIONS,
+                                std::chrono::milliseconds(1));
+}
+
+void TombstoneList::add(const std::shared_ptr<MapEntryImpl>& entry) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment read TombstoneTImeout from systemProperties.
-  auto tombstone = std::make_shared<TombstoneEntry>(entry);
+  auto& version_stamp = entry->getVersionStamp();
+  auto tombstone = std::make_shared<TombstoneEntry>(
+      entry, version_stamp.getMemberId(), version_stamp.getRegionVersion());
   std::shared_ptr<CacheableKey> key;
   entry->getKeyI(key);
 
-  auto duration =
-      cache_.getDistributedSystem().getSystemProperties().tombstoneTimeout();
-  auto& manager = cache_.getExpiryTaskManager();
-  auto task =
-      std::make_shared<TombstoneExpiryTask>(manager, segment_, tombstone);
-  auto task_id = manager.schedule(std::move(task), duration);
-  tombstone->task_id(task_id);
-  tombstones_[key] = tombstone;
+  auto previous = tombstones_.find(key);
+  if (previous != tombstones_.end()) {
+    unindex(*previous->second);
+    ungenerate(*previous->second);
+    previous->second = tombstone;
+  } else {
+    tombstones_.emplace(key, tombstone);
 
-  auto& perf_stats = cache_.getCachePerfStats();
+    auto& perf_stats = cache_.getCachePerfStats();
+    perf_stats.incTombstoneCount();
+    perf_stats.incTombstoneSize(key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD);
+  }
 
-  perf_stats.incTombstoneCount();
-  perf_stats.incTombstoneSize(key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD);
+  versions_[tombstone->member_id()].emplace(tombstone->region_version(),
+                                            tombstone.get());
+
+  // the generation ends on the first span boundary after the expiry time
+  auto duration =
+      cache_.getDistributedSystem().getSystemProperties().tombstoneTimeout();
+  auto expiry = clock::now() + duration;
+  auto generation =
+      clock::time_point((expiry.time_since_epoch() / generation_span_ + 1) *
+                        generation_span_);
+  auto& members = generations_[generation];
+  tombstone->generation(generation, members.size());
+  members.push_back(tombstone);
 
-  return task_id;
+  if (task_id_ == ExpiryTask::invalid()) {
+    auto& manager = cache_.getExpiryTaskManager();
+    auto task = std::make_shared<TombstoneExpiryTask>(manager, segment_);
+    task_id_ = manager.schedule(std::move(task), generation - clock::now());
+  }
 }
 
 // Reaps the tombstones which have been gc'ed on server.
@@ -77,22 +112,19 @@ ExpiryTask::id_t TombstoneList::add(
 void TombstoneList::reap_tombstones(std::map<uint16_t, int64_t>& gcVersions) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  std::unordered_set<std::shared_ptr<CacheableKey>,
-                     dereference_hash<std::shared_ptr<CacheableKey>>,
-                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
-      tobeDeleted;
-  for (const auto& queIter : tombstones_) {
-    auto const& mapIter = gcVersions.find(
-        queIter.second->entry()->getVersionStamp().getMemberId());
-
-    if (mapIter == gcVersions.end()) {
+  std::vector<std::shared_ptr<CacheableKey>> tobeDeleted;
+  for (const auto& gcVersion : gcVersions) {
+    auto const& index = versions_.find(gcVersion.first);
+    if (index == versions_.end()) {
       continue;
     }
 
-    auto const& version = (*mapIter).second;
-    if (version >=
-        queIter.second->entry()->getVersionStamp().getRegionVersion()) {
-      tobeDeleted.insert(queIter.first);
+    auto const& versions = index->second;
+    auto const& last = versions.upper_bound(gcVersion.second);
+    for (auto iter = versions.begin(); iter != last; ++iter) {
+      std::shared_ptr<CacheableKey> key;
+      iter->second->entry()->getKeyI(key);
+      tobeDeleted.push_back(std::move(key));
     }
   }
 
@@ -115,8 +147,7 @@ bool TombstoneList::exists(const std::shared_ptr<CacheableKey>& key) const {
   return key != nullptr && tombstones_.find(key) != tombstones_.end();
 }
 
-bool TombstoneList::erase(const std::shared_ptr<CacheableKey>& key,
-                          bool cancel_task) {
+bool TombstoneList::erase(const std::shared_ptr<CacheableKey>& key) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
 
@@ -125,11 +156,8 @@ bool TombstoneList::erase(const std::shared_ptr<CacheableKey>& key,
     return false;
   }
 
-  iter->second->invalidate();
-
-  if (cancel_task) {
-    cache_.getExpiryTaskManager().cancel(iter->second->task_id());
-  }
+  unindex(*iter->second);
+  ungenerate(*iter->second);
 
   auto& perf_stats = cache_.getCachePerfStats();
 
@@ -140,12 +168,91 @@ bool TombstoneList::erase(const std::shared_ptr<CacheableKey>& key,
   return true;
 }
 
+size_t TombstoneList::expire(size_t limit, clock::time_point now) {
+  // This function is not guarded as all functions of this class are called from
+  // MapSegment
+  size_t visited = 0;
+  while (visited < limit && !generations_.empty() &&
+         generations_.begin()->first <= now) {
+    auto& generation = generations_.begin()->second;
+    while (visited < limit && !generation.empty()) {
+      auto tombstone = std::move(generation.back());
+      generation.pop_back();
+      ++visited;
+
+      std::shared_ptr<CacheableKey> key;
+      tombstone->entry()->getKeyI(key);
+      segment_.remove_entry(key);
+    }
+
+    if (generation.empty()) {
+      generations_.erase(generations_.begin());
+    }
+  }
+
+  return visited;
+}
+
+bool TombstoneList::next_generation(clock::time_point& at) {
+  if (generations_.empty()) {
+    task_id_ = ExpiryTask::invalid();
+    return false;
+  }
+
+  at = generations_.begin()->first;
+  return true;
+}
+
+void TombstoneList::unindex(const TombstoneEntry& tombstone) {
+  auto&& index = versions_.find(tombstone.member_id());
+  if (index == versions_.end()) {
+    return;
+  }
+
+  auto& versions = index->second;
+  auto&& range = versions.equal_range(tombstone.region_version());
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    if (iter->second == &tombstone) {
+      versions.erase(iter);
+      break;
+    }
+  }
+
+  if (versions.empty()) {
+    versions_.erase(index);
+  }
+}
+
+void TombstoneList::ungenerate(const TombstoneEntry& tombstone) {
+  auto&& generation = generations_.find(tombstone.generation());
+  if (generation == generations_.end()) {
+    return;
+  }
+
+  // expire() takes tombstones out of their generation before erasing them
+  auto& members = generation->second;
+  auto index = tombstone.generation_index();
+  if (index >= members.size() || members[index].get() != &tombstone) {
+    return;
+  }
+
+  if (index + 1 < members.size()) {
+    members[index] = std::move(members.back());
+    members[index]->generation(generation->first, index);
+  }
+  members.pop_back();
+
+  if (members.empty()) {
+    generations_.erase(generation);
+  }
+}
+
 void TombstoneList::cleanup() {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  auto& manager = cache_.getExpiryTaskManager();
-  for (const auto& iter : tombstones_) {
-    manager.cancel(iter.second->task_id());
+  if (task_id_ != ExpiryTask::invalid()) {
+    cache_.getExpiryTaskManager().cancel(task_id_);
+    task_id_ = ExpiryTask::invalid();
   }
 }
 
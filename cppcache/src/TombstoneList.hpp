@@ -21,8 +21,10 @@
 #define GEODE_TOMBSTONELIST_H_
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/internal/functional.hpp>
@@ -37,14 +39,24 @@ namespace client {
 class MapSegment;
 class TombstoneEntry;
 
+/**
+ * Tombstones of a MapSegment.
+ *
+ * Tombstones are grouped in generations by expiry time, each generation
+ * spanning a fraction of the tombstone timeout, and a single expiry task per
+ * segment expires whole generations at once. Tombstones are also indexed by
+ * member and region version so that server driven reaping only visits the
+ * tombstones it removes.
+ */
 class TombstoneList {
  public:
-  TombstoneList(MapSegment& segment, CacheImpl& cache)
-      : segment_(segment), cache_(cache) {}
+  using clock = std::chrono::steady_clock;
+
+  TombstoneList(MapSegment& segment, CacheImpl& cache);
   virtual ~TombstoneList() { cleanup(); }
 
-  ExpiryTask::id_t add(const std::shared_ptr<MapEntryImpl>& entry);
-  bool erase(const std::shared_ptr<CacheableKey>& key, bool cancel_task = true);
+  void add(const std::shared_ptr<MapEntryImpl>& entry);
+  bool erase(const std::shared_ptr<CacheableKey>& key);
   bool exists(const std::shared_ptr<CacheableKey>& key) const;
   void cleanup();
 
@@ -55,15 +67,40 @@ class TombstoneList {
   void reap_tombstones(std::map<uint16_t, int64_t>& gcVersions);
   void reap_tombstones(const std::shared_ptr<CacheableHashSet>& keys);
 
+  /**
+   * Removes up to limit tombstones of the generations that are due, together
+   * with their entries in the segment. Returns the number of tombstones
+   * visited, which is less than limit if no more are due.
+   */
+  size_t expire(size_t limit, clock::time_point now = clock::now());
+
+  /**
+   * Sets at to the expiry time of the oldest generation. Returns false and
+   * forgets the expiry task if there are no generations left.
+   */
+  bool next_generation(clock::time_point& at);
+
  protected:
   using tombstone_map_t =
       std::unordered_map<std::shared_ptr<CacheableKey>,
                          std::shared_ptr<TombstoneEntry>,
                          dereference_hash<std::shared_ptr<CacheableKey>>,
                          dereference_equal_to<std::shared_ptr<CacheableKey>>>;
+  using generation_map_t =
+      std::map<clock::time_point, std::vector<std::shared_ptr<TombstoneEntry>>>;
+  using version_index_t =
+      std::unordered_map<uint16_t, std::multimap<int64_t, TombstoneEntry*>>;
+
+  void unindex(const TombstoneEntry& tombstone);
+  void ungenerate(const TombstoneEntry& tombstone);
 
  protected:
   tombstone_map_t tombstones_;
+  // erased tombstones are taken out of their generation
+  generation_map_t generations_;
+  version_index_t versions_;
+  clock::duration generation_span_;
+  ExpiryTask::id_t task_id_;
   MapSegment& segment_;
   CacheImpl& cache_;
 };
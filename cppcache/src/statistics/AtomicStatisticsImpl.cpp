@@ -91,6 +91,7 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
     }
     if (doubleCount > 0) {
       doubleStorage = new std::atomic<double>[doubleCount];
+      doubleSuppliers.resize(doubleCount);
       for (int32_t i = 0; i < doubleCount; i++) {
         doubleStorage[i] = 0;  // Un-initialized state
       }
@@ -189,6 +190,9 @@ double AtomicStatisticsImpl::_getDouble(int32_t offset) const {
         "getDouble:The id(" + std::to_string(offset) +
         ") of the Statistic Descriptor is not valid");
   }
+  if (auto supplier = std::atomic_load(&doubleSuppliers[offset])) {
+    return (*supplier)();
+  }
   return doubleStorage[offset];
 }
 
@@ -325,6 +329,22 @@ void AtomicStatisticsImpl::setDouble(int32_t id, double value) {
   }
 }
 
+void AtomicStatisticsImpl::setDoubleSupplier(int32_t id,
+                                             std::function<double()> supplier) {
+  if (id < 0 || id >= statsType->getDoubleStatCount()) {
+    throw IllegalArgumentException(
+        "setDoubleSupplier:The id(" + std::to_string(id) +
+        ") of the Statistic Descriptor is not valid");
+  }
+
+  std::shared_ptr<const std::function<double()>> shared;
+  if (supplier) {
+    shared = std::make_shared<const std::function<double()>>(
+        std::move(supplier));
+  }
+  std::atomic_store(&doubleSuppliers[id], std::move(shared));
+}
+
 int32_t AtomicStatisticsImpl::getInt(const std::string& name) const {
   int32_t id = getIntId(nameToDescriptor(name));
   return getInt(id);
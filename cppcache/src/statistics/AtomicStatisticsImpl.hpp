@@ -21,7 +21,9 @@
 #define GEODE_STATISTICS_ATOMICSTATISTICSIMPL_H_
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <geode/internal/geode_globals.hpp>
 
@@ -66,6 +68,9 @@ class AtomicStatisticsImpl : public Statistics {
   /** An array containing the values of the double statistics */
   std::atomic<double>* doubleStorage;
 
+  /** Suppliers of double statistics computed when read */
+  std::vector<std::shared_ptr<const std::function<double()>>> doubleSuppliers;
+
   bool isOpen() const;
 
   int32_t getIntId(const std::shared_ptr<StatisticDescriptor> descriptor) const;
@@ -150,6 +155,9 @@ class AtomicStatisticsImpl : public Statistics {
 
   void setDouble(int32_t id, double value) override;
 
+  void setDoubleSupplier(int32_t id,
+                         std::function<double()> supplier) override;
+
   int32_t getInt(const std::string& name) const override;
 
   int32_t getInt(
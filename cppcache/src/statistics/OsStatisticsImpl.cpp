@@ -111,6 +111,7 @@ OsStatisticsImpl::OsStatisticsImpl(StatisticsType* typeArg,
     }
     if (doubleCount > 0) {
       doubleStorage = new double[doubleCount];
+      doubleSuppliers.resize(doubleCount);
       for (int32_t i = 0; i < doubleCount; i++) {
         doubleStorage[i] = 0;  // Un-initialized state
       }
@@ -208,6 +209,9 @@ double OsStatisticsImpl::_getDouble(int32_t offset) const {
         ") of the Statistic Descriptor is not valid");
   }
 
+  if (auto supplier = std::atomic_load(&doubleSuppliers[offset])) {
+    return (*supplier)();
+  }
   return doubleStorage[offset];
 }
 
@@ -337,6 +341,22 @@ void OsStatisticsImpl::setDouble(int32_t id, double value) {
     _setDouble(id, value);
   }
 }
+
+void OsStatisticsImpl::setDoubleSupplier(int32_t id,
+                                         std::function<double()> supplier) {
+  if (id < 0 || id >= statsType->getDoubleStatCount()) {
+    throw IllegalArgumentException(
+        "setDoubleSupplier:The id(" + std::to_string(id) +
+        ") of the Statistic Descriptor is not valid");
+  }
+
+  std::shared_ptr<const std::function<double()>> shared;
+  if (supplier) {
+    shared = std::make_shared<const std::function<double()>>(
+        std::move(supplier));
+  }
+  std::atomic_store(&doubleSuppliers[id], std::move(shared));
+}
 //////////////////////////Get INT Methods/////////////////////////////////////
 int32_t OsStatisticsImpl::getInt(const std::string& name) const {
   return getInt(nameToDescriptor(name));
@@ -20,6 +20,9 @@
 #ifndef GEODE_STATISTICS_OSSTATISTICSIMPL_H_
 #define GEODE_STATISTICS_OSSTATISTICSIMPL_H_
 
+#include <memory>
+#include <vector>
+
 #include "Statistics.hpp"
 #include "StatisticsFactory.hpp"
 #include "StatisticsTypeImpl.hpp"
@@ -58,6 +61,9 @@ class OsStatisticsImpl : public Statistics {
   /** An array containing the values of the double statistics */
   double* doubleStorage;
 
+  /** Suppliers of double statistics computed when read */
+  std::vector<std::shared_ptr<const std::function<double()>>> doubleSuppliers;
+
   bool isOpen() const;
 
   int32_t getIntId(const std::shared_ptr<StatisticDescriptor> descriptor) const;
@@ -141,6 +147,9 @@ class OsStatisticsImpl : public Statistics {
 
   void setDouble(int32_t id, double value) override;
 
+  void setDoubleSupplier(int32_t id,
+                         std::function<double()> supplier) override;
+
   int32_t getInt(const std::string& name) const override;
 
   int32_t getInt(
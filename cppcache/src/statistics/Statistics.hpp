@@ -20,6 +20,7 @@
 #ifndef GEODE_STATISTICS_STATISTICS_H_
 #define GEODE_STATISTICS_STATISTICS_H_
 
+#include <functional>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
@@ -236,6 +237,19 @@ class Statistics {
    */
   virtual void setDouble(const std::string& name, double value) = 0;
 
+  /**
+   * Makes the statistic with the given <code>id</code> whose type is
+   * <code>double</code> report the value returned by <code>supplier</code>
+   * whenever it is read, for example when it is sampled, instead of a stored
+   * value. Use it for values derived from other statistics so that they cost
+   * nothing to maintain. An empty supplier reverts to the stored value.
+   *
+   * @throws IllegalArgumentException
+   *         If the id is invalid.
+   */
+  virtual void setDoubleSupplier(int32_t id,
+                                 std::function<double()> supplier) = 0;
+
   ///////////////////////  get() Methods  ///////////////////////
 
   /**
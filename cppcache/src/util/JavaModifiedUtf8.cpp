@@ -17,9 +17,12 @@
 
 #include "JavaModifiedUtf8.hpp"
 
+#include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <locale>
 
+#include "simd.hpp"
 #include "string.hpp"
 
 namespace apache {
@@ -31,6 +34,12 @@ size_t JavaModifiedUtf8::encodedLength(const std::string& utf8) {
     return 0;
   }
 
+  if (ascii_length(utf8.data(), utf8.length()) == utf8.length()) {
+    // Only NUL needs more than one byte.
+    return utf8.length() +
+           static_cast<size_t>(std::count(utf8.begin(), utf8.end(), '\0'));
+  }
+
   return encodedLength(to_utf16(utf8));
 }
 
@@ -40,6 +49,28 @@ size_t JavaModifiedUtf8::encodedLength(const std::u16string& utf16) {
 
 size_t JavaModifiedUtf8::encodedLength(const char16_t* data, size_t length) {
   size_t encodedLen = 0;
+#if defined(GEODE_SIMD_SSE2)
+  if (length >= 8) {
+    // Each unit starts at 3 bytes and the comparison masks (-1 when true)
+    // subtract one for < 0x800, one for < 0x80 and add one back for NUL.
+    const auto zero = _mm_setzero_si128();
+    const auto ones = _mm_set1_epi16(1);
+    const auto nonAsciiBits = _mm_set1_epi16(static_cast<int16_t>(0xff80));
+    const auto nonTwoByteBits = _mm_set1_epi16(static_cast<int16_t>(0xf800));
+    auto adjust = _mm_setzero_si128();
+    for (; length >= 8; length -= 8, data += 8) {
+      auto v = load_unaligned_128(data);
+      auto isNul = _mm_cmpeq_epi16(v, zero);
+      auto isAscii = _mm_cmpeq_epi16(_mm_and_si128(v, nonAsciiBits), zero);
+      auto isTwoByte =
+          _mm_cmpeq_epi16(_mm_and_si128(v, nonTwoByteBits), zero);
+      auto delta = _mm_sub_epi16(_mm_add_epi16(isAscii, isTwoByte), isNul);
+      adjust = _mm_add_epi32(adjust, _mm_madd_epi16(delta, ones));
+      encodedLen += 24;
+    }
+    encodedLen -= static_cast<size_t>(-horizontal_sum_epi32(adjust));
+  }
+#endif
   while (length-- > 0) {
     const char16_t c = *(data++);
     if (c == 0) {
@@ -58,15 +89,28 @@ size_t JavaModifiedUtf8::encodedLength(const char16_t* data, size_t length) {
 }
 
 std::string JavaModifiedUtf8::fromString(const std::string& utf8) {
+  if (ascii_length(utf8.data(), utf8.length()) == utf8.length() &&
+      std::memchr(utf8.data(), 0, utf8.length()) == nullptr) {
+    // ASCII without NUL is already Java Modified UTF-8.
+    return utf8;
+  }
+
   return fromString(to_utf16(utf8));
 }
 
 std::string JavaModifiedUtf8::fromString(const std::u16string& utf16) {
+  const auto begin = utf16.data();
+  const auto end = begin + utf16.length();
+  const auto ascii =
+      std::find(begin, begin + ascii_length(begin, utf16.length()), u'\0');
+
   std::string jmutf8;
   jmutf8.reserve(utf16.length());
+  jmutf8.resize(static_cast<size_t>(ascii - begin));
+  utf16_to_ascii(begin, jmutf8.length(), &jmutf8[0]);
 
-  for (auto&& c : utf16) {
-    encode(c, jmutf8);
+  for (auto c = ascii; c < end; ++c) {
+    encode(*c, jmutf8);
   }
 
   return jmutf8;
@@ -91,8 +135,15 @@ void JavaModifiedUtf8::encode(const char16_t c, std::string& jmutf8) {
 }
 
 std::u16string JavaModifiedUtf8::decode(const char* buf, uint16_t len) {
-  std::u16string value;
   const auto end = buf + len;
+  const auto ascii = ascii_length(buf, len);
+
+  std::u16string value;
+  value.reserve(len);
+  value.resize(ascii);
+  ascii_to_utf16(buf, ascii, &value[0]);
+
+  buf += ascii;
   while (buf < end) {
     value += decodeJavaModifiedUtf8Char(&buf);
   }
@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_SINGLE_FLIGHT_H_
+#define GEODE_UTIL_CONCURRENT_SINGLE_FLIGHT_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Coalesces concurrent calls for the same key into one.
+ *
+ * The first caller for a key runs its function; callers arriving for that
+ * key while it runs wait and get a copy of its result instead of running
+ * their own. If the first caller throws, each waiting caller runs its own
+ * function instead.
+ *
+ * @tparam Key type of the key calls are coalesced on.
+ * @tparam Result type of the result shared between callers.
+ */
+template <class Key, class Result, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class single_flight {
+ public:
+  single_flight() = default;
+  single_flight(const single_flight&) = delete;
+  single_flight& operator=(const single_flight&) = delete;
+
+  /**
+   * Returns the result of function, or of the call for key already in
+   * flight. shared is set to true in the latter case.
+   */
+  template <class Function>
+  Result run(const Key& key, Function&& function, bool& shared) {
+    std::shared_ptr<call> inFlight;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto&& found = calls_.find(key);
+      if (found == calls_.end()) {
+        calls_.emplace(key, std::make_shared<call>());
+      } else {
+        inFlight = found->second;
+        ++inFlight->waiters;
+      }
+    }
+
+    if (inFlight) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      inFlight->done.wait(lock, [&inFlight] { return inFlight->finished; });
+      --inFlight->waiters;
+      if (!inFlight->failed) {
+        shared = true;
+        return inFlight->result;
+      }
+      lock.unlock();
+
+      shared = false;
+      return function();
+    }
+
+    shared = false;
+    try {
+      auto result = function();
+      finish(key, &result);
+      return result;
+    } catch (...) {
+      finish(key, nullptr);
+      throw;
+    }
+  }
+
+  /** Number of callers waiting on the call for key. */
+  size_t waiters(const Key& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto&& found = calls_.find(key);
+    return found == calls_.end() ? 0 : found->second->waiters;
+  }
+
+ private:
+  struct call {
+    std::condition_variable done;
+    bool finished = false;
+    bool failed = false;
+    size_t waiters = 0;
+    Result result{};
+  };
+
+  void finish(const Key& key, const Result* result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto&& found = calls_.find(key);
+    auto& finished = *found->second;
+    if (result) {
+      finished.result = *result;
+    } else {
+      finished.failed = true;
+    }
+    finished.finished = true;
+    finished.done.notify_all();
+    calls_.erase(found);
+  }
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<call>, Hash, KeyEqual> calls_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_CONCURRENT_SINGLE_FLIGHT_H_
@@ -0,0 +1,238 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hash.hpp"
+
+#include <geode/internal/functional.hpp>
+
+#include "simd.hpp"
+#include "string.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+/**
+ * Powers of 31 modulo 2^32, POW31[i] == 31^(i + 1).
+ */
+const uint32_t POW31[] = {
+    31u,         961u,        29791u,      923521u,
+    28629151u,   887503681u,  1742810335u, 2487512833u,
+    4098453791u, 2498015937u, 129082719u,  4001564289u,
+    3789408671u, 1507551809u, 3784433119u, 1353309697u};
+
+/**
+ * Eight bytes are folded per step with independent multiplies so the
+ * compiler can schedule (or vectorize) them in parallel rather than
+ * serializing on the h * 31 dependency chain. Arithmetic is done unsigned
+ * to get Java's wrap-around semantics without signed overflow.
+ */
+constexpr size_t kStride = 8;
+
+template <class _CharT>
+inline uint32_t fold8(uint32_t h, const _CharT* p) {
+  return h * POW31[7] + static_cast<uint32_t>(p[0]) * POW31[6] +
+         static_cast<uint32_t>(p[1]) * POW31[5] +
+         static_cast<uint32_t>(p[2]) * POW31[4] +
+         static_cast<uint32_t>(p[3]) * POW31[3] +
+         static_cast<uint32_t>(p[4]) * POW31[2] +
+         static_cast<uint32_t>(p[5]) * POW31[1] +
+         static_cast<uint32_t>(p[6]) * POW31[0] + static_cast<uint32_t>(p[7]);
+}
+
+inline uint32_t fold8_reverse(uint32_t h, const int8_t* p) {
+  return h * POW31[7] + static_cast<uint32_t>(p[7]) * POW31[6] +
+         static_cast<uint32_t>(p[6]) * POW31[5] +
+         static_cast<uint32_t>(p[5]) * POW31[4] +
+         static_cast<uint32_t>(p[4]) * POW31[3] +
+         static_cast<uint32_t>(p[3]) * POW31[2] +
+         static_cast<uint32_t>(p[2]) * POW31[1] +
+         static_cast<uint32_t>(p[1]) * POW31[0] + static_cast<uint32_t>(p[0]);
+}
+
+template <class _CharT>
+inline uint32_t java_hash_scalar(uint32_t h, const _CharT* data,
+                                 size_t length) {
+  auto end = data + length;
+
+  for (; static_cast<size_t>(end - data) >= kStride; data += kStride) {
+    h = fold8(h, data);
+  }
+  for (; data < end; ++data) {
+    h = 31 * h + static_cast<uint32_t>(*data);
+  }
+
+  return h;
+}
+
+inline int32_t pow31(size_t exponent) {
+  return static_cast<int32_t>(POW31[exponent - 1]);
+}
+
+#if defined(GEODE_SIMD_DISPATCH)
+
+/**
+ * Each lane accumulates every fourth (or eighth) unit already scaled by its
+ * power of 31 within the block, and the whole accumulator is scaled by
+ * 31^block per step. The seed rides in the last lane so it picks up
+ * 31^length with no extra bookkeeping.
+ */
+GEODE_SIMD_TARGET("sse4.1")
+uint32_t java_hash_sse41(uint32_t h, const char16_t* data, size_t length) {
+  const auto lowPowers = _mm_setr_epi32(pow31(7), pow31(6), pow31(5), pow31(4));
+  const auto highPowers = _mm_setr_epi32(pow31(3), pow31(2), pow31(1), 1);
+  const auto step = _mm_set1_epi32(pow31(8));
+
+  auto acc = _mm_setr_epi32(0, 0, 0, static_cast<int32_t>(h));
+  for (; length >= 8; length -= 8, data += 8) {
+    auto v = load_unaligned_128(data);
+    auto low = _mm_cvtepu16_epi32(v);
+    auto high = _mm_cvtepu16_epi32(_mm_srli_si128(v, 8));
+    acc = _mm_add_epi32(
+        _mm_mullo_epi32(acc, step),
+        _mm_add_epi32(_mm_mullo_epi32(low, lowPowers),
+                      _mm_mullo_epi32(high, highPowers)));
+  }
+
+  h = static_cast<uint32_t>(horizontal_sum_epi32(acc));
+
+  return java_hash_scalar(h, data, length);
+}
+
+GEODE_SIMD_TARGET("avx2")
+uint32_t java_hash_avx2(uint32_t h, const char16_t* data, size_t length) {
+  const auto lowPowers =
+      _mm256_setr_epi32(pow31(15), pow31(14), pow31(13), pow31(12), pow31(11),
+                        pow31(10), pow31(9), pow31(8));
+  const auto highPowers =
+      _mm256_setr_epi32(pow31(7), pow31(6), pow31(5), pow31(4), pow31(3),
+                        pow31(2), pow31(1), 1);
+  const auto step = _mm256_set1_epi32(pow31(16));
+
+  auto acc = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 0, static_cast<int32_t>(h));
+  for (; length >= 16; length -= 16, data += 16) {
+    auto v = _mm256_loadu_si256(
+        static_cast<const __m256i*>(static_cast<const void*>(data)));
+    auto low = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v));
+    auto high = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1));
+    acc = _mm256_add_epi32(
+        _mm256_mullo_epi32(acc, step),
+        _mm256_add_epi32(_mm256_mullo_epi32(low, lowPowers),
+                         _mm256_mullo_epi32(high, highPowers)));
+  }
+
+  h = static_cast<uint32_t>(horizontal_sum_epi32(_mm_add_epi32(
+      _mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1))));
+
+  return java_hash_scalar(h, data, length);
+}
+
+#endif
+
+}  // namespace
+
+int32_t java_hash(int32_t seed, const char16_t* data, size_t length) {
+  auto h = static_cast<uint32_t>(seed);
+#if defined(GEODE_SIMD_DISPATCH)
+  if (length >= 16 && cpu_supports_avx2()) {
+    return static_cast<int32_t>(java_hash_avx2(h, data, length));
+  } else if (length >= 8 && cpu_supports_sse41()) {
+    return static_cast<int32_t>(java_hash_sse41(h, data, length));
+  }
+#endif
+  return static_cast<int32_t>(java_hash_scalar(h, data, length));
+}
+
+int32_t java_hash(int32_t seed, const int8_t* data, size_t length) {
+  return static_cast<int32_t>(
+      java_hash_scalar(static_cast<uint32_t>(seed), data, length));
+}
+
+int32_t java_hash_reverse(int32_t seed, const int8_t* data, size_t length) {
+  auto h = static_cast<uint32_t>(seed);
+  auto end = data + length;
+
+  for (; static_cast<size_t>(end - data) >= kStride;) {
+    end -= kStride;
+    h = fold8_reverse(h, end);
+  }
+  while (end > data) {
+    h = 31 * h + static_cast<uint32_t>(*--end);
+  }
+
+  return static_cast<int32_t>(h);
+}
+
+namespace internal {
+
+int32_t geode_hash<std::u16string>::operator()(const std::u16string& val) {
+  return java_hash(0, val.data(), val.length());
+}
+
+int32_t geode_hash<std::string>::operator()(const std::string& val) {
+  // ASCII bytes are their own UTF-16 code units.
+  const auto ascii = ascii_length(val.data(), val.length());
+  auto hash = java_hash(0, reinterpret_cast<const int8_t*>(val.data()), ascii);
+
+  for (auto&& it = val.cbegin() + static_cast<std::ptrdiff_t>(ascii);
+       it < val.cend(); it++) {
+    auto cp = static_cast<uint32_t>(0xff & *it);
+    if (cp < 0x80) {
+      // 1 byte
+    } else if ((cp >> 5) == 0x6) {
+      // 2 bytes
+      ++it;
+      cp = ((cp << 6) & 0x7ff) + ((*it) & 0x3f);
+    } else if ((cp >> 4) == 0xe) {
+      // 3 bytes
+      ++it;
+      cp = ((cp << 12) & 0xffff) + (((0xff & *it) << 6) & 0xfff);
+      ++it;
+      cp += (*it) & 0x3f;
+    } else if ((cp >> 3) == 0x1e) {
+      // 4 bytes
+      ++it;
+      cp = ((cp << 18) & 0x1fffff) + (((0xff & *it) << 12) & 0x3ffff);
+      ++it;
+      cp += ((0xff & *it) << 6) & 0xfff;
+      ++it;
+      cp += (*it) & 0x3f;
+    } else {
+      // TODO throw exception
+    }
+
+    if (cp > 0xffff) {
+      // surrogate pair
+      hash = 31 * hash +
+             static_cast<uint16_t>((cp >> 10) + (0xD800 - (0x10000 >> 10)));
+      hash = 31 * hash + static_cast<uint16_t>((cp & 0x3ff) + 0xdc00u);
+    } else {
+      // single code unit
+      hash = 31 * hash + cp;
+    }
+  }
+
+  return hash;
+}
+
+}  // namespace internal
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
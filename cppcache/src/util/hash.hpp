@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_HASH_H_
+#define GEODE_UTIL_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Folds data[0] .. data[length - 1] into seed with the Java 31-polynomial,
+ * i.e. h = 31 * h + data[i] for each byte in order. With a seed of 1 this
+ * matches java.util.Arrays.hashCode(byte[]).
+ */
+int32_t java_hash(int32_t seed, const int8_t* data, size_t length);
+
+/**
+ * Folds data[length - 1] .. data[0] into seed with the Java 31-polynomial,
+ * the order in which PdxInstance hashes raw field bytes.
+ */
+int32_t java_hash_reverse(int32_t seed, const int8_t* data, size_t length);
+
+/**
+ * Folds UTF-16 code units data[0] .. data[length - 1] into seed with the
+ * Java 31-polynomial. With a seed of 0 this matches java.lang.String.hashCode.
+ * Uses AVX2 or SSE4.1 when the CPU supports them.
+ */
+int32_t java_hash(int32_t seed, const char16_t* data, size_t length);
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_HASH_H_
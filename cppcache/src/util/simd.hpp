@@ -0,0 +1,100 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_SIMD_H_
+#define GEODE_UTIL_SIMD_H_
+
+#include <cstdint>
+
+/**
+ * SSE2 is part of the x86-64 baseline so kernels restricted to it need no
+ * runtime check.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GEODE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * Wider kernels (SSE4.1, AVX2) are compiled per function with the target
+ * attribute and selected at runtime, so the library itself still runs on
+ * the baseline instruction set.
+ */
+#if defined(GEODE_SIMD_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define GEODE_SIMD_DISPATCH
+#define GEODE_SIMD_TARGET(features) __attribute__((target(features)))
+#include <immintrin.h>
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+
+#if defined(GEODE_SIMD_SSE2)
+
+/**
+ * Unaligned 128-bit load and store, taking untyped pointers so callers
+ * don't need casts that appear to increase alignment.
+ */
+inline __m128i load_unaligned_128(const void* p) {
+  return _mm_loadu_si128(static_cast<const __m128i*>(p));
+}
+
+inline void store_unaligned_128(void* p, __m128i v) {
+  _mm_storeu_si128(static_cast<__m128i*>(p), v);
+}
+
+/**
+ * Sums the four 32-bit lanes of v.
+ */
+inline int32_t horizontal_sum_epi32(__m128i v) {
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(v);
+}
+
+#endif
+
+#if defined(GEODE_SIMD_DISPATCH)
+
+inline bool cpu_supports_sse41() {
+  static const bool supported = __builtin_cpu_supports("sse4.1");
+  return supported;
+}
+
+inline bool cpu_supports_avx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+#else
+
+inline bool cpu_supports_sse41() { return false; }
+
+inline bool cpu_supports_avx2() { return false; }
+
+#endif
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_SIMD_H_
@@ -21,6 +21,7 @@
 #include <codecvt>
 #include <locale>
 
+#include "simd.hpp"
 #include "type_traits.hpp"
 
 namespace apache {
@@ -35,6 +36,12 @@ constexpr std::codecvt_mode codecvt_mode_native_endian =
                                      : static_cast<std::codecvt_mode>(0);
 
 std::u16string to_utf16(const std::string& utf8) {
+  if (ascii_length(utf8.data(), utf8.length()) == utf8.length()) {
+    std::u16string utf16(utf8.length(), u'\0');
+    ascii_to_utf16(utf8.data(), utf8.length(), &utf16[0]);
+    return utf16;
+  }
+
 #if defined(_MSC_VER) && _MSC_VER >= 1900
   /*
    * Workaround for missing std:codecvt identifier.
@@ -123,6 +130,12 @@ std::u32string to_ucs4(const std::u16string& utf16) {
 }
 
 std::string to_utf8(const std::u16string& utf16) {
+  if (ascii_length(utf16.data(), utf16.length()) == utf16.length()) {
+    std::string utf8(utf16.length(), '\0');
+    utf16_to_ascii(utf16.data(), utf16.length(), &utf8[0]);
+    return utf8;
+  }
+
 #if defined(_MSC_VER) && _MSC_VER >= 1900
   /*
    * Workaround for missing std:codecvt identifier.
@@ -161,6 +174,70 @@ bool equal_ignore_case(const std::string& str1, const std::string& str2) {
                      }));
 }
 
+size_t ascii_length(const char* data, size_t length) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  for (; i + 16 <= length; i += 16) {
+    auto v = load_unaligned_128(data + i);
+    if (_mm_movemask_epi8(v) != 0) {
+      break;
+    }
+  }
+#endif
+  while (i < length && (data[i] & 0x80) == 0) {
+    ++i;
+  }
+  return i;
+}
+
+size_t ascii_length(const char16_t* data, size_t length) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  const auto zero = _mm_setzero_si128();
+  const auto nonAsciiBits = _mm_set1_epi16(static_cast<int16_t>(0xff80));
+  for (; i + 8 <= length; i += 8) {
+    auto v = load_unaligned_128(data + i);
+    auto ascii = _mm_cmpeq_epi16(_mm_and_si128(v, nonAsciiBits), zero);
+    if (_mm_movemask_epi8(ascii) != 0xffff) {
+      break;
+    }
+  }
+#endif
+  while (i < length && data[i] < 0x80) {
+    ++i;
+  }
+  return i;
+}
+
+void ascii_to_utf16(const char* ascii, size_t length, char16_t* utf16) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    auto v = load_unaligned_128(ascii + i);
+    store_unaligned_128(utf16 + i, _mm_unpacklo_epi8(v, zero));
+    store_unaligned_128(utf16 + i + 8, _mm_unpackhi_epi8(v, zero));
+  }
+#endif
+  for (; i < length; ++i) {
+    utf16[i] = static_cast<char16_t>(ascii[i]);
+  }
+}
+
+void utf16_to_ascii(const char16_t* utf16, size_t length, char* ascii) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  for (; i + 16 <= length; i += 16) {
+    auto low = load_unaligned_128(utf16 + i);
+    auto high = load_unaligned_128(utf16 + i + 8);
+    store_unaligned_128(ascii + i, _mm_packus_epi16(low, high));
+  }
+#endif
+  for (; i < length; ++i) {
+    ascii[i] = static_cast<char>(utf16[i]);
+  }
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -45,6 +45,27 @@ std::string to_utf8(const std::u32string& ucs4);
 
 bool equal_ignore_case(const std::string& str1, const std::string& str2);
 
+/**
+ * Returns the number of leading code units in data that are 7-bit ASCII.
+ */
+size_t ascii_length(const char* data, size_t length);
+
+/**
+ * Returns the number of leading code units in data that are 7-bit ASCII.
+ */
+size_t ascii_length(const char16_t* data, size_t length);
+
+/**
+ * Widens length 7-bit ASCII bytes into UTF-16 code units.
+ */
+void ascii_to_utf16(const char* ascii, size_t length, char16_t* utf16);
+
+/**
+ * Narrows length UTF-16 code units, all of which must be 7-bit ASCII, into
+ * bytes.
+ */
+void utf16_to_ascii(const char16_t* utf16, size_t length, char* ascii);
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AdaptivePoolSizer.hpp"
+#include "ConnectionQueue.hpp"
+
+namespace {
+
+using apache::geode::client::AdaptivePoolSizer;
+using apache::geode::client::ConnectionQueue;
+
+using EndpointLoad = AdaptivePoolSizer::EndpointLoad;
+
+constexpr std::chrono::nanoseconds kInterval = std::chrono::seconds(1);
+constexpr std::chrono::nanoseconds kNoWait = std::chrono::nanoseconds::zero();
+
+class TestConnection {
+ public:
+  void close() {}
+};
+
+TEST(AdaptivePoolSizerTest, keepsSizeMatchingLoad) {
+  AdaptivePoolSizer sizer(1, -1);
+  // 4 connections busy on average with headroom for 5.
+  auto targets = sizer.resize({{5, 4, std::chrono::seconds(4)}}, kInterval,
+                              kNoWait);
+  EXPECT_EQ(std::vector<int32_t>({5}), targets);
+}
+
+TEST(AdaptivePoolSizerTest, growsTowardsLittlesLawEstimate) {
+  AdaptivePoolSizer sizer(1, -1);
+  // 8 connections busy on average needs 10, but growth is at most half.
+  auto targets = sizer.resize({{4, 4, std::chrono::seconds(8)}}, kInterval,
+                              kNoWait);
+  EXPECT_EQ(std::vector<int32_t>({6}), targets);
+}
+
+TEST(AdaptivePoolSizerTest, growsWhenCheckoutsWait) {
+  AdaptivePoolSizer sizer(1, -1);
+  auto targets = sizer.resize({{2, 2, std::chrono::milliseconds(100)}},
+                              kInterval, std::chrono::milliseconds(5));
+  EXPECT_EQ(std::vector<int32_t>({3}), targets);
+}
+
+TEST(AdaptivePoolSizerTest, shrinksOneAtATimeWhenIdle) {
+  AdaptivePoolSizer sizer(1, -1);
+  auto targets = sizer.resize({{10, 1, std::chrono::milliseconds(10)}},
+                              kInterval, kNoWait);
+  EXPECT_EQ(std::vector<int32_t>({9}), targets);
+}
+
+TEST(AdaptivePoolSizerTest, doesNotShrinkWhileCheckoutsWait) {
+  AdaptivePoolSizer sizer(1, -1);
+  auto targets = sizer.resize(
+      {{10, 10, std::chrono::seconds(9)}, {10, 1, std::chrono::seconds(0)}},
+      kInterval, std::chrono::milliseconds(5));
+  EXPECT_EQ(10, targets[1]);
+}
+
+TEST(AdaptivePoolSizerTest, staysWithinMaxConnections) {
+  AdaptivePoolSizer sizer(1, 12);
+  auto targets = sizer.resize(
+      {{5, 5, std::chrono::seconds(5)}, {5, 5, std::chrono::seconds(5)}},
+      kInterval, std::chrono::milliseconds(5));
+  EXPECT_EQ(12, targets[0] + targets[1]);
+  EXPECT_LE(5, targets[0]);
+  EXPECT_LE(5, targets[1]);
+}
+
+TEST(AdaptivePoolSizerTest, staysAboveMinConnections) {
+  AdaptivePoolSizer sizer(4, -1);
+  auto targets = sizer.resize(
+      {{2, 0, std::chrono::seconds(0)}, {2, 0, std::chrono::seconds(0)}},
+      kInterval, kNoWait);
+  EXPECT_EQ(std::vector<int32_t>({2, 2}), targets);
+}
+
+TEST(AdaptivePoolSizerTest, shrinksWhenCheckoutsFindIdleConnections) {
+  ConnectionQueue<TestConnection> pool;
+  for (int i = 0; i < 10; i++) {
+    pool.put(new TestConnection(), false);
+  }
+
+  // A steady trickle of operations, each served by an idle connection.
+  for (int i = 0; i < 100; i++) {
+    auto connection = pool.getUntil(std::chrono::seconds(1));
+    ASSERT_NE(nullptr, connection);
+    pool.put(connection, false);
+  }
+
+  auto waitTime = pool.takeBlockedTime();
+  EXPECT_EQ(kNoWait, waitTime);
+
+  AdaptivePoolSizer sizer(1, -1);
+  auto targets = sizer.resize({{10, 1, std::chrono::milliseconds(10)}},
+                              kInterval, waitTime);
+  EXPECT_EQ(std::vector<int32_t>({9}), targets);
+
+  pool.close();
+}
+
+TEST(AdaptivePoolSizerTest, doesNotShrinkWhenCheckoutsBlock) {
+  ConnectionQueue<TestConnection> pool;
+
+  std::thread returner([&pool] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    pool.put(new TestConnection(), false);
+  });
+  auto connection = pool.getUntil(std::chrono::seconds(10));
+  returner.join();
+  ASSERT_NE(nullptr, connection);
+  pool.put(connection, false);
+
+  auto waitTime = pool.takeBlockedTime();
+  EXPECT_LE(std::chrono::milliseconds(1), waitTime);
+  EXPECT_EQ(kNoWait, pool.takeBlockedTime());
+
+  AdaptivePoolSizer sizer(1, -1);
+  auto targets = sizer.resize({{10, 1, std::chrono::milliseconds(10)}},
+                              kInterval, waitTime);
+  EXPECT_EQ(std::vector<int32_t>({10}), targets);
+
+  pool.close();
+}
+
+}  // namespace
@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConflatingQueue.hpp"
+
+namespace {
+
+using apache::geode::client::ConflatingQueue;
+
+// An operation, 'u'pdate or 'd'estroy, and a value.
+using Event = std::pair<char, int>;
+
+class ConflatingQueueTest : public ::testing::Test {
+ protected:
+  ConflatingQueueTest()
+      : queue_(
+            [](const Event& pending, const Event& next) {
+              return pending.first == 'u' && next.first == 'u';
+            },
+            3) {}
+
+  std::vector<Event> drain() {
+    queue_.close();
+    std::vector<Event> events;
+    Event event;
+    while (queue_.pop(event)) {
+      events.push_back(event);
+    }
+    return events;
+  }
+
+  ConflatingQueue<std::string, Event> queue_;
+};
+
+TEST_F(ConflatingQueueTest, keepsLatestUpdateOfKey) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("b", {'u', 1}));
+  EXPECT_TRUE(queue_.push("a", {'u', 2}));
+  EXPECT_EQ(2u, queue_.size());
+
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'u', 2}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, keepsUpdatesAroundDestroy) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("a", {'d', 0}));
+  EXPECT_FALSE(queue_.push("a", {'u', 2}));
+  EXPECT_TRUE(queue_.push("a", {'u', 3}));
+
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'d', 0}, {'u', 3}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, doesNotConflateAcrossBarrier) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  queue_.pushBarrier({'m', 0});
+  EXPECT_FALSE(queue_.push("a", {'u', 2}));
+
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'m', 0}, {'u', 2}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, conflatesAgainAfterPop) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  Event event;
+  ASSERT_TRUE(queue_.pop(event));
+  EXPECT_FALSE(queue_.push("a", {'u', 2}));
+  EXPECT_TRUE(queue_.push("a", {'u', 3}));
+
+  EXPECT_EQ((std::vector<Event>{{'u', 3}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, popAllTakesQueuedEventsInOrder) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("b", {'d', 0}));
+  queue_.pushBarrier({'m', 0});
+  std::vector<Event> events;
+  ASSERT_TRUE(queue_.popAll(events));
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'d', 0}, {'m', 0}}), events);
+  EXPECT_EQ(0u, queue_.size());
+
+  EXPECT_FALSE(queue_.push("a", {'u', 2}));
+  queue_.close();
+  events.clear();
+  ASSERT_TRUE(queue_.popAll(events));
+  EXPECT_EQ((std::vector<Event>{{'u', 2}}), events);
+  EXPECT_FALSE(queue_.popAll(events));
+}
+
+TEST_F(ConflatingQueueTest, pushWaitsWhileFull) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("b", {'u', 1}));
+  queue_.pushBarrier({'m', 0});
+
+  std::atomic<bool> pushed{false};
+  std::thread writer([&] {
+    queue_.push("c", {'u', 1});
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(pushed);
+
+  Event event;
+  ASSERT_TRUE(queue_.pop(event));
+  writer.join();
+  EXPECT_TRUE(pushed);
+
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'m', 0}, {'u', 1}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, conflatingPushDoesNotWaitWhileFull) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("b", {'u', 1}));
+  EXPECT_FALSE(queue_.push("c", {'u', 1}));
+
+  EXPECT_TRUE(queue_.push("a", {'u', 2}));
+
+  EXPECT_EQ((std::vector<Event>{{'u', 1}, {'u', 1}, {'u', 2}}), drain());
+}
+
+TEST_F(ConflatingQueueTest, closeReleasesWaitingPush) {
+  EXPECT_FALSE(queue_.push("a", {'u', 1}));
+  EXPECT_FALSE(queue_.push("b", {'u', 1}));
+  EXPECT_FALSE(queue_.push("c", {'u', 1}));
+
+  std::thread writer([&] { queue_.push("d", {'u', 1}); });
+  queue_.close();
+  writer.join();
+
+  EXPECT_EQ(4u, queue_.size());
+}
+
+}  // namespace
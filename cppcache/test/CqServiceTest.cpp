@@ -0,0 +1,260 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/CqAttributesFactory.hpp>
+#include <geode/CqBatchListener.hpp>
+#include <geode/PoolFactory.hpp>
+#include <geode/PoolManager.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "CqQueryImpl.hpp"
+#include "CqService.hpp"
+#include "TcrMessage.hpp"
+#include "ThinClientPoolDM.hpp"
+#include "statistics/StatisticsManager.hpp"
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::SizeIs;
+using ::testing::StrictMock;
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::CqAttributesFactory;
+using apache::geode::client::CqBatchListener;
+using apache::geode::client::CqEvent;
+using apache::geode::client::CqQuery;
+using apache::geode::client::CqQueryImpl;
+using apache::geode::client::CqService;
+using apache::geode::client::CqState;
+using apache::geode::client::TcrMessage;
+using apache::geode::client::TcrMessageReply;
+using apache::geode::client::ThinClientPoolDM;
+
+namespace {
+
+using CqEvents = std::vector<std::reference_wrapper<const CqEvent>>;
+
+class MockCqBatchListener : public CqBatchListener {
+ public:
+  MOCK_METHOD1(onEvents, void(const CqEvents& events));
+  MOCK_METHOD1(onError, void(const CqEvent& event));
+  MOCK_METHOD0(close, void());
+};
+
+// A notification for a key, with an operation for each of its CQs.
+class TestCqNotification : public TcrMessageReply {
+ public:
+  TestCqNotification(const std::string& key,
+                     const std::map<std::string, int32_t>& cqOps)
+      : TcrMessageReply(true, nullptr) {
+    m_msgType = TcrMessage::LOCAL_UPDATE;
+    m_msgTypeForCq = TcrMessage::LOCAL_UPDATE;
+    m_key = CacheableString::create(key);
+    m_hasCqsPart = true;
+    initCqMap();
+    for (const auto& kv : cqOps) {
+      (*m_cqs)[kv.first] = kv.second;
+    }
+  }
+};
+
+// A loopback port nothing listens on, so connections to it are refused.
+uint16_t closedPort() {
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      io_context, {boost::asio::ip::make_address("127.0.0.1"), 0});
+  return acceptor.local_endpoint().port();
+}
+
+std::vector<std::string> keysOf(const CqEvents& events) {
+  std::vector<std::string> keys;
+  for (const auto& event : events) {
+    keys.push_back(event.get().getKey()->toString());
+  }
+  return keys;
+}
+
+}  // namespace
+
+class CqServiceTest : public ::testing::Test {
+ protected:
+  CqServiceTest()
+      : cache_(CacheFactory{}.set("log-level", "none").create()),
+        statisticsFactory_(CacheRegionHelper::getCacheImpl(&cache_)
+                               ->getStatisticsManager()
+                               .getStatisticsFactory()) {
+    auto pool = cache_.getPoolManager()
+                    .createFactory()
+                    .addServer("127.0.0.1", closedPort())
+                    .setMinConnections(0)
+                    .create("pool");
+    service_ = std::make_shared<CqService>(
+        std::dynamic_pointer_cast<ThinClientPoolDM>(pool).get(),
+        statisticsFactory_);
+  }
+
+  ~CqServiceTest() override {
+    // The CQs refer back to the service.
+    for (const auto& name : cqNames_) {
+      service_->removeCq(name);
+    }
+    cache_.close();
+  }
+
+  std::shared_ptr<StrictMock<MockCqBatchListener>> addRunningCq(
+      const std::string& name) {
+    auto listener = std::make_shared<StrictMock<MockCqBatchListener>>();
+    CqAttributesFactory attributesFactory;
+    attributesFactory.addCqListener(listener);
+    auto cq = std::make_shared<CqQueryImpl>(
+        service_, name, "SELECT * FROM /region", attributesFactory.create(),
+        statisticsFactory_);
+    cq->setCqState(CqState::RUNNING);
+    std::shared_ptr<CqQuery> query = cq;
+    service_->addCq(name, query);
+    cqNames_.push_back(name);
+    return listener;
+  }
+
+  void invoke(const std::vector<TestCqNotification*>& notifications) {
+    std::vector<TcrMessage*> msgs(notifications.begin(), notifications.end());
+    service_->invokeCqListeners(msgs);
+    for (auto msg : notifications) {
+      delete msg;
+    }
+  }
+
+  Cache cache_;
+  apache::geode::statistics::StatisticsFactory* statisticsFactory_;
+  std::shared_ptr<CqService> service_;
+  std::vector<std::string> cqNames_;
+};
+
+TEST_F(CqServiceTest, groupsEventsPerCq) {
+  auto first = addRunningCq("first");
+  auto second = addRunningCq("second");
+
+  std::vector<std::string> firstKeys;
+  std::vector<std::string> secondKeys;
+  EXPECT_CALL(*first, onEvents(SizeIs(2)))
+      .WillOnce(
+          Invoke([&](const CqEvents& events) { firstKeys = keysOf(events); }));
+  EXPECT_CALL(*second, onEvents(SizeIs(2)))
+      .WillOnce(
+          Invoke([&](const CqEvents& events) { secondKeys = keysOf(events); }));
+
+  invoke({new TestCqNotification("a", {{"first", TcrMessage::LOCAL_CREATE},
+                                       {"second", TcrMessage::LOCAL_CREATE}}),
+          new TestCqNotification("b", {{"first", TcrMessage::LOCAL_UPDATE}}),
+          new TestCqNotification("c",
+                                 {{"second", TcrMessage::LOCAL_DESTROY}})});
+
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), firstKeys);
+  EXPECT_EQ((std::vector<std::string>{"a", "c"}), secondKeys);
+}
+
+TEST_F(CqServiceTest, reusesPooledEventsAcrossBatches) {
+  auto listener = addRunningCq("cq");
+
+  std::vector<std::vector<const CqEvent*>> batches;
+  EXPECT_CALL(*listener, onEvents(SizeIs(2)))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](const CqEvents& events) {
+        batches.emplace_back();
+        for (const auto& event : events) {
+          batches.back().push_back(&event.get());
+        }
+      }));
+
+  for (int i = 0; i < 2; i++) {
+    invoke({new TestCqNotification("a", {{"cq", TcrMessage::LOCAL_UPDATE}}),
+            new TestCqNotification("b", {{"cq", TcrMessage::LOCAL_UPDATE}})});
+  }
+
+  ASSERT_EQ(2u, batches.size());
+  EXPECT_EQ(batches[0], batches[1]);
+  EXPECT_EQ(2u, service_->getPooledCqEventCount());
+}
+
+TEST_F(CqServiceTest, flushesEventsBeforeError) {
+  auto listener = addRunningCq("cq");
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(*listener, onEvents(SizeIs(1)));
+    EXPECT_CALL(*listener, onError(_));
+    EXPECT_CALL(*listener, onEvents(SizeIs(1)));
+  }
+
+  // getOperation() has no CqOperation for a region invalidate.
+  invoke({new TestCqNotification("a", {{"cq", TcrMessage::LOCAL_UPDATE}}),
+          new TestCqNotification("b", {{"cq", TcrMessage::INVALIDATE_REGION}}),
+          new TestCqNotification("c", {{"cq", TcrMessage::LOCAL_UPDATE}})});
+}
+
+TEST_F(CqServiceTest, flushesEventsBeforeRegionDestroyClosesCq) {
+  auto listener = addRunningCq("cq");
+
+  {
+    InSequence sequence;
+    EXPECT_CALL(*listener, onEvents(SizeIs(1)));
+    EXPECT_CALL(*listener, close());
+  }
+
+  invoke({new TestCqNotification("a", {{"cq", TcrMessage::LOCAL_UPDATE}}),
+          new TestCqNotification("b", {{"cq", TcrMessage::DESTROY_REGION}}),
+          new TestCqNotification("c", {{"cq", TcrMessage::LOCAL_UPDATE}})});
+
+  EXPECT_FALSE(service_->isCqExists("cq"));
+}
+
+TEST_F(CqServiceTest, trimsEventPoolAfterLargeBatch) {
+  auto listener = addRunningCq("cq");
+  const auto count = CqService::kMaxPooledCqEvents + 10;
+
+  EXPECT_CALL(*listener, onEvents(SizeIs(count)));
+
+  std::vector<TestCqNotification*> notifications;
+  for (size_t i = 0; i < count; i++) {
+    notifications.push_back(new TestCqNotification(
+        std::to_string(i), {{"cq", TcrMessage::LOCAL_UPDATE}}));
+  }
+  invoke(notifications);
+
+  EXPECT_EQ(CqService::kMaxPooledCqEvents,
+            service_->getPooledCqEventCount());
+}
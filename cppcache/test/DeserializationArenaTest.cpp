@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "DataInputInternal.hpp"
+#include "DeserializationArena.hpp"
+
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DeserializationArena;
+
+namespace {
+
+class Counted {
+ public:
+  explicit Counted(int& destroyed) : destroyed_(destroyed) {}
+  ~Counted() { ++destroyed_; }
+
+ private:
+  int& destroyed_;
+};
+
+}  // namespace
+
+TEST(DeserializationArenaTest, objectsOutliveArenaReference) {
+  int destroyed = 0;
+  auto arena = std::make_shared<DeserializationArena>();
+  auto first = arena->make<Counted>(destroyed);
+  auto second = arena->make<Counted>(destroyed);
+  arena.reset();
+
+  first.reset();
+  EXPECT_EQ(0, destroyed);
+
+  second.reset();
+  EXPECT_EQ(2, destroyed);
+}
+
+TEST(DeserializationArenaTest, alignsObjects) {
+  struct alignas(32) Aligned {
+    char value;
+  };
+
+  auto arena = std::make_shared<DeserializationArena>(256);
+  auto byte = arena->make<char>('a');
+  auto aligned = arena->make<Aligned>();
+  auto number = arena->make<int64_t>(1);
+  auto text = arena->make<std::string>("arena");
+
+  EXPECT_EQ('a', *byte);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(aligned.get()) % alignof(Aligned));
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(number.get()) % alignof(int64_t));
+  EXPECT_EQ(1, *number);
+  EXPECT_EQ("arena", *text);
+}
+
+TEST(DeserializationArenaTest, largeObjectsGetTheirOwnBlock) {
+  auto arena = std::make_shared<DeserializationArena>(256);
+  auto small = arena->make<int32_t>(1);
+  EXPECT_EQ(256u, arena->capacity());
+
+  auto large = arena->make<std::array<char, 1024>>();
+  EXPECT_LE(1024u + 256u, arena->capacity());
+
+  auto capacity = arena->capacity();
+  auto next = arena->make<int32_t>(2);
+  EXPECT_EQ(capacity, arena->capacity());
+  EXPECT_EQ(1, *small);
+  EXPECT_EQ(2, *next);
+}
+
+TEST(DeserializationArenaTest, scopeAppliesToItsInputOnThisThread) {
+  auto arena = std::make_shared<DeserializationArena>();
+  DataInputInternal input(nullptr, 0);
+  DataInputInternal other(nullptr, 0);
+  EXPECT_EQ(nullptr, DeserializationArena::current(input));
+
+  {
+    DeserializationArena::Scope scope(input, arena.get());
+    EXPECT_EQ(arena.get(), DeserializationArena::current(input));
+    EXPECT_EQ(nullptr, DeserializationArena::current(other));
+
+    {
+      DeserializationArena::Scope inner(other, nullptr);
+      EXPECT_EQ(arena.get(), DeserializationArena::current(input));
+    }
+    EXPECT_EQ(arena.get(), DeserializationArena::current(input));
+
+    std::thread([&] {
+      EXPECT_EQ(nullptr, DeserializationArena::current(input));
+    }).join();
+  }
+
+  EXPECT_EQ(nullptr, DeserializationArena::current(input));
+}
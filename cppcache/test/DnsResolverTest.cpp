@@ -0,0 +1,174 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <gtest/gtest.h>
+
+#include "DnsResolver.hpp"
+
+using apache::geode::client::DnsResolver;
+
+namespace {
+
+DnsResolver::Endpoints address(const char* ip, uint16_t port) {
+  return {boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(ip),
+                                         port)};
+}
+
+std::chrono::milliseconds operator"" _ms(unsigned long long ms) {
+  return std::chrono::milliseconds(ms);
+}
+
+}  // namespace
+
+TEST(DnsResolverTest, cachesAddressesWithinTtl) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(60000_ms, 60000_ms,
+                       [&lookups](const std::string&, uint16_t port) {
+                         ++lookups;
+                         return address("10.0.0.1", port);
+                       });
+
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+  EXPECT_EQ(1, lookups);
+
+  EXPECT_EQ(address("10.0.0.1", 40405), resolver.resolve("server", 40405));
+  EXPECT_EQ(2, lookups);
+}
+
+TEST(DnsResolverTest, cachesFailuresWithinNegativeTtl) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(60000_ms, 60000_ms,
+                       [&lookups](const std::string&, uint16_t) {
+                         ++lookups;
+                         throw boost::system::system_error{
+                             boost::asio::error::host_not_found};
+                         return DnsResolver::Endpoints{};
+                       });
+
+  EXPECT_THROW(resolver.resolve("missing", 40404), boost::system::system_error);
+  EXPECT_THROW(resolver.resolve("missing", 40404), boost::system::system_error);
+  EXPECT_EQ(1, lookups);
+}
+
+TEST(DnsResolverTest, retriesFailureAfterNegativeTtl) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(60000_ms, 20_ms,
+                       [&lookups](const std::string&, uint16_t port) {
+                         if (++lookups == 1) {
+                           throw boost::system::system_error{
+                               boost::asio::error::host_not_found};
+                         }
+                         return address("10.0.0.1", port);
+                       });
+
+  EXPECT_THROW(resolver.resolve("server", 40404), boost::system::system_error);
+  std::this_thread::sleep_for(30_ms);
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+  EXPECT_EQ(2, lookups);
+}
+
+TEST(DnsResolverTest, zeroTtlDisablesCaching) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(0_ms, 0_ms,
+                       [&lookups](const std::string&, uint16_t port) {
+                         ++lookups;
+                         return address("10.0.0.1", port);
+                       });
+
+  resolver.resolve("server", 40404);
+  resolver.resolve("server", 40404);
+  EXPECT_EQ(2, lookups);
+}
+
+TEST(DnsResolverTest, concurrentLookupsShareOneQuery) {
+  std::atomic<int> lookups(0);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  DnsResolver resolver(60000_ms, 60000_ms,
+                       [&lookups, released](const std::string&, uint16_t port) {
+                         ++lookups;
+                         released.wait();
+                         return address("10.0.0.1", port);
+                       });
+
+  std::vector<std::future<DnsResolver::Endpoints>> results;
+  for (int i = 0; i < 4; i++) {
+    results.push_back(std::async(std::launch::async, [&resolver] {
+      return resolver.resolve("server", 40404);
+    }));
+  }
+
+  std::this_thread::sleep_for(50_ms);
+  release.set_value();
+
+  for (auto& result : results) {
+    EXPECT_EQ(address("10.0.0.1", 40404), result.get());
+  }
+  EXPECT_EQ(1, lookups);
+}
+
+TEST(DnsResolverTest, servesExpiredAddressesWhileRefreshing) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(50_ms, 50_ms,
+                       [&lookups](const std::string&, uint16_t port) {
+                         auto host = ++lookups == 1 ? "10.0.0.1" : "10.0.0.2";
+                         return address(host, port);
+                       });
+
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+  std::this_thread::sleep_for(60_ms);
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (resolver.resolve("server", 40404) != address("10.0.0.2", 40404) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(5_ms);
+  }
+  EXPECT_EQ(address("10.0.0.2", 40404), resolver.resolve("server", 40404));
+}
+
+TEST(DnsResolverTest, keepsAddressesWhenRefreshFails) {
+  std::atomic<int> lookups(0);
+  DnsResolver resolver(20_ms, 60000_ms,
+                       [&lookups](const std::string&, uint16_t port) {
+                         if (++lookups > 1) {
+                           throw boost::system::system_error{
+                               boost::asio::error::host_not_found};
+                         }
+                         return address("10.0.0.1", port);
+                       });
+
+  resolver.resolve("server", 40404);
+  std::this_thread::sleep_for(30_ms);
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (lookups < 2 && std::chrono::steady_clock::now() < deadline) {
+    EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+    std::this_thread::sleep_for(5_ms);
+  }
+
+  EXPECT_EQ(2, lookups);
+  EXPECT_EQ(address("10.0.0.1", 40404), resolver.resolve("server", 40404));
+}
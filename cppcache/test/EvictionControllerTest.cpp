@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "CacheImpl.hpp"
+#include "CachePerfStats.hpp"
+#include "CacheRegionHelper.hpp"
+#include "EvictionController.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::EvictionController;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+std::shared_ptr<Region> createRegion(Cache& cache, const std::string& name,
+                                     int entries) {
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setLruEntriesLimit(10 * entries)
+                    .create(name);
+  for (int i = 0; i < entries; i++) {
+    region->put(std::to_string(i), "value");
+  }
+  return region;
+}
+
+TEST(EvictionControllerTest, evictsSliceOfEachRegisteredRegion) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto large = createRegion(cache, "large", 4000);
+  auto small = createRegion(cache, "small", 100);
+
+  EvictionController controller(1, 10,
+                                CacheRegionHelper::getCacheImpl(&cache));
+  controller.registerRegion("large");
+  controller.registerRegion("small");
+
+  EXPECT_EQ(2050, controller.evict(0.5f));
+  EXPECT_EQ(2000u, large->size());
+  EXPECT_EQ(50u, small->size());
+}
+
+TEST(EvictionControllerTest, skipsUnregisteredRegions) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = createRegion(cache, "region", 100);
+
+  EvictionController controller(1, 10,
+                                CacheRegionHelper::getCacheImpl(&cache));
+  controller.registerRegion("region");
+  controller.unregisterRegion("region");
+
+  EXPECT_EQ(0, controller.evict(0.5f));
+  EXPECT_EQ(100u, region->size());
+}
+
+TEST(EvictionControllerTest, writersEvictWhileOverLimit) {
+  auto cache = CacheFactory{}
+                   .set("log-level", "none")
+                   .set("heap-lru-limit", "1")
+                   .create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto region =
+      cache.createRegionFactory(RegionShortcut::LOCAL).create("region");
+  // keep the controller's thread away from the region, so that only the
+  // writers evict
+  cacheImpl->getEvictionController()->unregisterRegion("region");
+
+  const std::string value(10 * 1024, 'x');
+  const int entries = 400;
+  for (int i = 0; i < entries; i++) {
+    region->put(std::to_string(i), value);
+  }
+
+  EXPECT_LT(region->size(), 250u);
+  EXPECT_GT(cacheImpl->getCachePerfStats().getStat()->getInt("heapLruAssists"),
+            0);
+}
+
+}  // namespace
@@ -0,0 +1,79 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "FrequencySketch.hpp"
+
+using apache::geode::client::FrequencySketch;
+
+TEST(FrequencySketchTest, countsIncrements) {
+  FrequencySketch sketch(512);
+
+  EXPECT_EQ(0, sketch.frequency(42));
+  for (int i = 1; i <= 5; i++) {
+    sketch.increment(42);
+    EXPECT_EQ(i, sketch.frequency(42));
+  }
+  EXPECT_EQ(0, sketch.frequency(43));
+}
+
+TEST(FrequencySketchTest, saturatesAtMaxFrequency) {
+  FrequencySketch sketch(512);
+
+  for (int i = 0; i < 100; i++) {
+    sketch.increment(7);
+  }
+  EXPECT_EQ(FrequencySketch::MAX_FREQUENCY, sketch.frequency(7));
+}
+
+TEST(FrequencySketchTest, halvesCountersAfterSampleSize) {
+  FrequencySketch sketch(64);
+
+  for (int i = 0; i < 8; i++) {
+    sketch.increment(-1);
+  }
+  EXPECT_EQ(8, sketch.frequency(-1));
+
+  for (int32_t hash = 0; hash < static_cast<int32_t>(sketch.sampleSize());
+       hash++) {
+    sketch.increment(hash);
+  }
+  EXPECT_LT(sketch.frequency(-1), 8);
+  EXPECT_GE(sketch.frequency(-1), 4);
+}
+
+TEST(FrequencySketchTest, countsConcurrentIncrements) {
+  FrequencySketch sketch(512);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&sketch] {
+      for (int i = 0; i < 3; i++) {
+        sketch.increment(42);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(12, sketch.frequency(42));
+}
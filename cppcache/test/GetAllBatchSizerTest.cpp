@@ -0,0 +1,151 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+
+#include "GetAllBatchSizer.hpp"
+
+namespace {
+
+using apache::geode::client::CacheableString;
+using apache::geode::client::GetAllBatchSizer;
+using apache::geode::client::GetAllKeys;
+
+constexpr size_t kMiB = 1024 * 1024;
+
+// Time for a batch from a server taking 1us per key.
+std::chrono::nanoseconds elapsed(size_t keys, std::chrono::nanoseconds rtt) {
+  return rtt + std::chrono::microseconds(keys);
+}
+
+std::shared_ptr<GetAllKeys> makeKeys(size_t count) {
+  auto keys = std::make_shared<GetAllKeys>();
+  for (size_t i = 0; i < count; i++) {
+    keys->push_back(CacheableString::create("key-" + std::to_string(i)));
+  }
+  return keys;
+}
+
+TEST(GetAllBatchSizerTest, startsAtInitialSize) {
+  GetAllBatchSizer sizer(4 * kMiB, 100, 100000, 1000);
+  EXPECT_EQ(1000u, sizer.keysPerBatch());
+
+  GetAllBatchSizer clamped(4 * kMiB, 100, 100000, 10);
+  EXPECT_EQ(100u, clamped.keysPerBatch());
+}
+
+TEST(GetAllBatchSizerTest, shrinksToTargetBytes) {
+  GetAllBatchSizer sizer(1 * kMiB, 100, 100000, 1000);
+
+  // 4MiB per 1000 keys puts 250 keys in the target, reached by halving.
+  sizer.record(1000, 4 * kMiB, std::chrono::milliseconds(10));
+  EXPECT_EQ(500u, sizer.keysPerBatch());
+  sizer.record(1000, 4 * kMiB, std::chrono::milliseconds(10));
+  EXPECT_EQ(250u, sizer.keysPerBatch());
+}
+
+TEST(GetAllBatchSizerTest, growsWhileRoundTripDominates) {
+  GetAllBatchSizer sizer(1024 * kMiB, 100, 100000, 1000);
+
+  for (int i = 0; i < 20; i++) {
+    auto keys = sizer.keysPerBatch() / (i % 2 + 1);
+    sizer.record(keys, keys * 10,
+                 elapsed(keys, std::chrono::milliseconds(10)));
+  }
+
+  // The 10ms round trip is a tenth of a 90000 key batch.
+  EXPECT_NEAR(90000, sizer.keysPerBatch(), 10);
+}
+
+TEST(GetAllBatchSizerTest, shrinksWhenKeysDominate) {
+  GetAllBatchSizer sizer(1024 * kMiB, 100, 100000, 1000);
+
+  for (int i = 0; i < 20; i++) {
+    auto keys = sizer.keysPerBatch() / (i % 2 + 1);
+    sizer.record(keys, keys * 10,
+                 elapsed(keys, std::chrono::nanoseconds::zero()));
+  }
+
+  EXPECT_EQ(100u, sizer.keysPerBatch());
+}
+
+TEST(GetAllBatchSizerTest, probesHalfAndDoubleSize) {
+  GetAllBatchSizer sizer(4 * kMiB, 100, 100000, 1000);
+
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(500u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.nextBatchSize());
+  EXPECT_EQ(2000u, sizer.nextBatchSize());
+  EXPECT_EQ(1000u, sizer.keysPerBatch());
+}
+
+TEST(GetAllBatchSizerTest, growsWithProbedSizes) {
+  GetAllBatchSizer sizer(1024 * kMiB, 100, 100000, 1000);
+
+  for (int i = 0; i < 100; i++) {
+    auto keys = sizer.nextBatchSize();
+    sizer.record(keys, keys * 10,
+                 elapsed(keys, std::chrono::milliseconds(10)));
+  }
+
+  EXPECT_NEAR(90000, sizer.keysPerBatch(), 1000);
+}
+
+TEST(GetAllBatchSizerTest, splitsKeysInOrder) {
+  auto keys = makeKeys(25);
+
+  auto batches = GetAllBatchSizer::split(keys, 10);
+
+  ASSERT_EQ(3u, batches.size());
+  EXPECT_EQ(10u, batches[0]->size());
+  EXPECT_EQ(10u, batches[1]->size());
+  EXPECT_EQ(5u, batches[2]->size());
+
+  GetAllKeys joined;
+  for (const auto& batch : batches) {
+    joined.insert(joined.end(), batch->begin(), batch->end());
+  }
+  EXPECT_EQ(*keys, joined);
+}
+
+TEST(GetAllBatchSizerTest, splitsEvenlyWithoutEmptyTail) {
+  auto batches = GetAllBatchSizer::split(makeKeys(20), 10);
+
+  ASSERT_EQ(2u, batches.size());
+  EXPECT_EQ(10u, batches[1]->size());
+}
+
+TEST(GetAllBatchSizerTest, doesNotCopyKeysFittingOneBatch) {
+  auto keys = makeKeys(10);
+
+  auto batches = GetAllBatchSizer::split(keys, 10);
+
+  ASSERT_EQ(1u, batches.size());
+  EXPECT_EQ(keys, batches[0]);
+}
+
+}  // namespace
@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "HeapCalibrator.hpp"
+
+namespace {
+
+using apache::geode::client::HeapCalibrator;
+
+constexpr int64_t kMebibyte = 1024 * 1024;
+constexpr int64_t kMaxHeapSize = 1024 * kMebibyte;
+constexpr int64_t kBaseline = 64 * kMebibyte;
+
+TEST(HeapCalibratorTest, convergesToResidentGrowthRatio) {
+  HeapCalibrator calibrator(kMaxHeapSize, kBaseline);
+
+  for (int i = 0; i < 40; i++) {
+    calibrator.sample(500 * kMebibyte, kBaseline + 750 * kMebibyte);
+  }
+
+  EXPECT_NEAR(1.5, calibrator.calibration(), 0.01);
+}
+
+TEST(HeapCalibratorTest, ignoresSmallHeap) {
+  HeapCalibrator calibrator(kMaxHeapSize, kBaseline);
+
+  calibrator.sample(50 * kMebibyte, kBaseline + 200 * kMebibyte);
+
+  EXPECT_EQ(1.0, calibrator.calibration());
+}
+
+TEST(HeapCalibratorTest, recoversAfterEviction) {
+  HeapCalibrator calibrator(kMaxHeapSize, kBaseline);
+
+  for (int i = 0; i < 10; i++) {
+    calibrator.sample(800 * kMebibyte, kBaseline + 3200 * kMebibyte);
+  }
+  auto beforeEviction = calibrator.calibration();
+  EXPECT_GT(beforeEviction, 3.5);
+
+  // right after eviction the freed memory may still be resident
+  calibrator.sample(400 * kMebibyte, kBaseline + 480 * kMebibyte);
+  EXPECT_EQ(beforeEviction, calibrator.calibration());
+
+  for (int i = 0; i < 40; i++) {
+    calibrator.sample(400 * kMebibyte, kBaseline + 480 * kMebibyte);
+  }
+  EXPECT_NEAR(1.2, calibrator.calibration(), 0.01);
+}
+
+TEST(HeapCalibratorTest, movesBaselineForGrowthOutsideTheCache) {
+  HeapCalibrator calibrator(kMaxHeapSize, kBaseline);
+
+  for (int i = 0; i < 40; i++) {
+    calibrator.sample(500 * kMebibyte, kBaseline + 600 * kMebibyte);
+  }
+  ASSERT_NEAR(1.2, calibrator.calibration(), 0.01);
+
+  // the rest of the process allocates while the cache stays the same size
+  for (int i = 0; i < 10; i++) {
+    calibrator.sample(500 * kMebibyte, kBaseline + 2600 * kMebibyte);
+  }
+
+  EXPECT_EQ(kBaseline + 2000 * kMebibyte, calibrator.baselineRss());
+  EXPECT_NEAR(1.2, calibrator.calibration(), 0.01);
+}
+
+TEST(HeapCalibratorTest, boundsRatio) {
+  HeapCalibrator calibrator(kMaxHeapSize, kBaseline);
+
+  for (int i = 0; i < 40; i++) {
+    calibrator.sample(200 * kMebibyte + i, kBaseline + 8000 * kMebibyte);
+  }
+
+  EXPECT_NEAR(4.0, calibrator.calibration(), 0.01);
+}
+
+}  // namespace
@@ -0,0 +1,225 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PoolStatistics.hpp"
+#include "ThinClientPoolHADM.hpp"
+#include "ThinClientRedundancyManager.hpp"
+#include "ThinClientRegion.hpp"
+#include "ThreadPool.hpp"
+#include "statistics/StatisticsManager.hpp"
+
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PoolStats;
+using apache::geode::client::ThinClientPoolHADM;
+using apache::geode::client::ThinClientRegion;
+using apache::geode::client::ThreadPool;
+
+namespace {
+
+using Keys = std::vector<std::shared_ptr<CacheableKey>>;
+
+Keys makeKeys(size_t count) {
+  Keys keys;
+  keys.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    keys.push_back(CacheableString::create("key-" + std::to_string(i)));
+  }
+  return keys;
+}
+
+// Lets each recovery continue only once count recoveries are running.
+class Rendezvous {
+ public:
+  explicit Rendezvous(size_t count) : count_(count) {}
+
+  bool arrive() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (++arrived_ == count_) {
+      condition_.notify_all();
+    }
+    return condition_.wait_for(lock, std::chrono::seconds(10),
+                               [this] { return arrived_ >= count_; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t count_;
+  size_t arrived_ = 0;
+};
+
+}  // namespace
+
+TEST(InterestRecoveryTest, registersKeysInOrderedBatches) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  PoolStats stats(
+      cacheImpl->getStatisticsManager().getStatisticsFactory(), "pool");
+
+  auto keys = makeKeys(25000);
+  std::vector<Keys> batches;
+  auto err = ThinClientRegion::registerInBatches(
+      keys, ThinClientRegion::INTEREST_RECOVERY_BATCH_SIZE, &stats,
+      [&batches](const Keys& batch) {
+        batches.push_back(batch);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return GF_NOERR;
+      });
+
+  EXPECT_EQ(GF_NOERR, err);
+  ASSERT_EQ(3u, batches.size());
+  EXPECT_EQ(10000u, batches[0].size());
+  EXPECT_EQ(10000u, batches[1].size());
+  EXPECT_EQ(5000u, batches[2].size());
+
+  Keys registered;
+  for (const auto& batch : batches) {
+    registered.insert(registered.end(), batch.begin(), batch.end());
+  }
+  EXPECT_EQ(keys, registered);
+
+  EXPECT_EQ(25000, stats.getStats()->getLong("interestKeysRecovered"));
+  EXPECT_EQ(3, stats.getStats()->getInt("interestRecoveryBatches"));
+  EXPECT_GT(stats.getStats()->getLong("interestRecoveryTime"), 0);
+  stats.close();
+}
+
+TEST(InterestRecoveryTest, stopsAtFirstFailedBatch) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  PoolStats stats(
+      cacheImpl->getStatisticsManager().getStatisticsFactory(), "pool");
+
+  auto keys = makeKeys(25);
+  size_t calls = 0;
+  auto err = ThinClientRegion::registerInBatches(
+      keys, 10, &stats, [&calls](const Keys&) {
+        return ++calls == 2 ? GF_NOTCON : GF_NOERR;
+      });
+
+  EXPECT_EQ(GF_NOTCON, err);
+  EXPECT_EQ(2u, calls);
+  EXPECT_EQ(10, stats.getStats()->getLong("interestKeysRecovered"));
+  EXPECT_EQ(1, stats.getStats()->getInt("interestRecoveryBatches"));
+  stats.close();
+}
+
+TEST(InterestRecoveryTest, registersNoBatchForNoKeys) {
+  size_t calls = 0;
+  auto err = ThinClientRegion::registerInBatches(
+      Keys{}, 10, nullptr, [&calls](const Keys&) {
+        calls++;
+        return GF_NOERR;
+      });
+
+  EXPECT_EQ(GF_NOERR, err);
+  EXPECT_EQ(0u, calls);
+}
+
+TEST(InterestRecoveryTest, recoversRegionsConcurrently) {
+  constexpr size_t kRegions = 3;
+  ThreadPool threadPool(kRegions);
+  Rendezvous rendezvous(kRegions);
+  std::atomic<size_t> recovered{0};
+
+  std::vector<std::function<GfErrType()>> recoveries(kRegions, [&] {
+    if (!rendezvous.arrive()) {
+      return GF_TIMEOUT;
+    }
+    recovered++;
+    return GF_NOERR;
+  });
+
+  EXPECT_EQ(GF_NOERR,
+            ThinClientPoolHADM::recoverInterest(threadPool, recoveries));
+  EXPECT_EQ(kRegions, recovered);
+}
+
+TEST(InterestRecoveryTest, returnsFirstRecoveryError) {
+  ThreadPool threadPool(2);
+  std::atomic<size_t> recovered{0};
+
+  std::vector<std::function<GfErrType()>> recoveries{
+      [&recovered] {
+        recovered++;
+        return GF_NOERR;
+      },
+      [&recovered] {
+        recovered++;
+        return GF_NOTCON;
+      },
+      [&recovered] {
+        recovered++;
+        return GF_TIMEOUT;
+      }};
+
+  EXPECT_EQ(GF_NOTCON,
+            ThinClientPoolHADM::recoverInterest(threadPool, recoveries));
+  EXPECT_EQ(3u, recovered);
+}
+
+TEST(InterestRecoveryTest, waitsForEveryRecoveryBeforeRethrowing) {
+  ThreadPool threadPool(2);
+  std::atomic<bool> finished{false};
+
+  std::vector<std::function<GfErrType()>> recoveries{
+      []() -> GfErrType { throw std::runtime_error("recovery failed"); },
+      [&finished] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        finished = true;
+        return GF_NOERR;
+      }};
+
+  EXPECT_THROW(ThinClientPoolHADM::recoverInterest(threadPool, recoveries),
+               std::runtime_error);
+  EXPECT_TRUE(finished);
+}
+
+TEST(InterestRecoveryTest, recoversSingleRegionOnCallingThread) {
+  ThreadPool threadPool(1);
+  std::thread::id recoveredOn;
+
+  std::vector<std::function<GfErrType()>> recoveries{[&recoveredOn] {
+    recoveredOn = std::this_thread::get_id();
+    return GF_NOERR;
+  }};
+
+  EXPECT_EQ(GF_NOERR,
+            ThinClientPoolHADM::recoverInterest(threadPool, recoveries));
+  EXPECT_EQ(std::this_thread::get_id(), recoveredOn);
+}
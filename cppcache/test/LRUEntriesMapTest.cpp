@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "RegionInternal.hpp"
+#include "RegionStats.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::Region;
+using apache::geode::client::RegionInternal;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+constexpr uint32_t kEntriesLimit = 100;
+constexpr int kHotKeys = 50;
+constexpr int kScanKeys = 10 * kEntriesLimit;
+
+std::shared_ptr<Region> createRegion(Cache& cache, bool admissionEnabled) {
+  return cache.createRegionFactory(RegionShortcut::LOCAL)
+      .setLruEntriesLimit(kEntriesLimit)
+      .setLruAdmissionEnabled(admissionEnabled)
+      .create("region");
+}
+
+// Reads the hot keys repeatedly, then puts a run of keys that are never
+// read again. Returns how many hot keys are still cached.
+int hotKeysAfterScan(Region& region) {
+  for (int i = 0; i < kHotKeys; i++) {
+    region.put("hot-" + std::to_string(i), "value");
+  }
+  for (int round = 0; round < 10; round++) {
+    for (int i = 0; i < kHotKeys; i++) {
+      region.get("hot-" + std::to_string(i));
+    }
+  }
+
+  for (int i = 0; i < kScanKeys; i++) {
+    region.put("scan-" + std::to_string(i), "value");
+  }
+
+  int cached = 0;
+  for (int i = 0; i < kHotKeys; i++) {
+    if (region.containsKey("hot-" + std::to_string(i))) {
+      cached++;
+    }
+  }
+  return cached;
+}
+
+}  // namespace
+
+TEST(LRUEntriesMapTest, scanEvictsHotEntriesWithoutAdmission) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = createRegion(cache, false);
+
+  EXPECT_EQ(0, hotKeysAfterScan(*region));
+  EXPECT_EQ(kEntriesLimit, region->size());
+}
+
+TEST(LRUEntriesMapTest, scanDoesNotEvictHotEntriesWithAdmission) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = createRegion(cache, true);
+
+  EXPECT_EQ(kHotKeys, hotKeysAfterScan(*region));
+  EXPECT_EQ(kEntriesLimit, region->size());
+
+  auto stats = std::dynamic_pointer_cast<RegionInternal>(region)
+                   ->getRegionStats()
+                   ->getStat();
+  EXPECT_GT(stats->getInt("lruAdmissionRejects"), 0);
+}
+
+TEST(LRUEntriesMapTest, hitRatioIsComputedWhenRead) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = createRegion(cache, true);
+  auto stats = std::dynamic_pointer_cast<RegionInternal>(region)
+                   ->getRegionStats()
+                   ->getStat();
+
+  EXPECT_EQ(0.0, stats->getDouble("hitRatio"));
+
+  region->put("key", "value");
+  for (int i = 0; i < 3; i++) {
+    region->get("key");
+  }
+  EXPECT_EQ(nullptr, region->get("missing"));
+
+  EXPECT_EQ(0.75, stats->getDouble("hitRatio"));
+}
@@ -19,15 +19,64 @@
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/Cache.hpp>
+#include <geode/DataSerializable.hpp>
+#include <geode/Delta.hpp>
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
 
+#include "LocalRegion.hpp"
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheClosedException;
+using apache::geode::client::CacheEventFlags;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::DataInput;
+using apache::geode::client::DataOutput;
+using apache::geode::client::DataSerializable;
+using apache::geode::client::Delta;
+using apache::geode::client::LocalRegion;
+using apache::geode::client::Region;
 using apache::geode::client::RegionAttributesFactory;
 using apache::geode::client::RegionShortcut;
 
+namespace {
+
+class DeltaCounter : public DataSerializable, public Delta {
+ public:
+  explicit DeltaCounter(int32_t value) : value_(value) {}
+
+  int32_t value() const { return value_; }
+
+  bool hasDelta() const override { return false; }
+  void toDelta(DataOutput&) const override {}
+  void fromDelta(DataInput& input) override { value_ += input.readInt32(); }
+  std::shared_ptr<Delta> clone() const override {
+    return std::make_shared<DeltaCounter>(value_);
+  }
+
+  void toData(DataOutput&) const override {}
+  void fromData(DataInput&) override {}
+
+ private:
+  int32_t value_;
+};
+
+// Applies a delta the way a server notification does.
+void applyDelta(Region& region, const std::string& key, uint8_t increment) {
+  const uint8_t delta[] = {0, 0, 0, increment};
+  auto input = region.getCache().createDataInput(delta, sizeof(delta));
+
+  std::shared_ptr<Cacheable> value;
+  std::shared_ptr<Cacheable> oldValue;
+  EXPECT_EQ(GF_NOERR, dynamic_cast<LocalRegion&>(region).putNoThrow(
+                          CacheableKey::create(key), value, nullptr, oldValue,
+                          -1, CacheEventFlags::NOTIFICATION, nullptr, &input));
+}
+
+}  // namespace
+
 /**
  * Cache should close and throw exceptions on methods called after close.
  */
@@ -77,3 +126,38 @@ TEST(LocalRegionTest, subRegions) {
   auto subRegions3 = rootRegion3->subregions(true);
   EXPECT_EQ(0, subRegions3.size());
 }
+
+TEST(LocalRegionTest, appliesDeltaToUnsharedValueInPlace) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCloningEnabled(true)
+                    .create("region");
+
+  region->put("counter", std::make_shared<DeltaCounter>(1));
+  const auto before = region->get("counter").get();
+
+  applyDelta(*region, "counter", 2);
+
+  auto after = std::dynamic_pointer_cast<DeltaCounter>(region->get("counter"));
+  ASSERT_NE(nullptr, after);
+  EXPECT_EQ(before, after.get());
+  EXPECT_EQ(3, after->value());
+}
+
+TEST(LocalRegionTest, appliesDeltaToCopyOfSharedValue) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCloningEnabled(true)
+                    .create("region");
+
+  region->put("counter", std::make_shared<DeltaCounter>(1));
+  auto held = std::dynamic_pointer_cast<DeltaCounter>(region->get("counter"));
+
+  applyDelta(*region, "counter", 2);
+
+  auto after = std::dynamic_pointer_cast<DeltaCounter>(region->get("counter"));
+  ASSERT_NE(nullptr, after);
+  EXPECT_NE(held.get(), after.get());
+  EXPECT_EQ(1, held->value());
+  EXPECT_EQ(3, after->value());
+}
@@ -0,0 +1,66 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "MemoryAccounting.hpp"
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableBytes;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableStringArray;
+using apache::geode::client::MemoryAccounting;
+
+TEST(MemoryAccountingTest, allocationSizeIsAlignedAndLargeEnough) {
+  for (size_t size = 0; size < 256; size++) {
+    auto allocated = MemoryAccounting::allocationSize(size);
+    EXPECT_GE(allocated, size + sizeof(size_t));
+    EXPECT_EQ(0u, allocated % (2 * sizeof(void*)));
+  }
+  EXPECT_LT(MemoryAccounting::sharedAllocationSize(64),
+            MemoryAccounting::entryOverhead(64));
+}
+
+TEST(MemoryAccountingTest, residentSetSizeIsReported) {
+  EXPECT_GT(MemoryAccounting::residentSetSize(), 0);
+}
+
+TEST(MemoryAccountingTest, stringsCountHeapBufferOnlyWhenAllocated) {
+  auto shortString = CacheableString::create("a");
+  EXPECT_EQ(sizeof(CacheableString), shortString->objectSize());
+
+  auto longString = CacheableString::create(std::string(1000, 'a'));
+  EXPECT_GE(longString->objectSize(), sizeof(CacheableString) + 1000);
+}
+
+TEST(MemoryAccountingTest, arraysCountTheirElements) {
+  std::shared_ptr<Cacheable> bytes =
+      CacheableBytes::create(std::vector<int8_t>(1000));
+  EXPECT_GE(bytes->objectSize(), sizeof(CacheableBytes) + 1000);
+
+  std::vector<std::shared_ptr<CacheableString>> values{
+      CacheableString::create(std::string(1000, 'a')),
+      CacheableString::create(std::string(1000, 'b'))};
+  std::shared_ptr<Cacheable> strings = CacheableStringArray::create(values);
+  EXPECT_GE(strings->objectSize(), 2000u);
+}
@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxSchema.hpp>
+#include <geode/TypeRegistry.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxLocalWriter.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataOutput;
+using apache::geode::client::PdxLocalWriter;
+using apache::geode::client::PdxSchemaSerializable;
+using apache::geode::client::PdxSchemaWriter;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+using apache::geode::client::PdxWriterWithTypeCollector;
+using apache::geode::client::Serializable;
+
+namespace {
+
+class Order : public PdxSchemaSerializable<Order> {
+ public:
+  int32_t orderId = 0;
+  std::string name;
+  double amount = 0;
+  std::vector<int64_t> lines;
+  std::vector<std::string> tags;
+  bool shipped = false;
+
+  template <class Schema>
+  void pdxSchema(Schema& schema) {
+    schema.field("orderId", orderId)
+        .field("name", name)
+        .field("amount", amount)
+        .field("lines", lines)
+        .field("tags", tags)
+        .field("shipped", shipped);
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "PdxSchemaTest.Order";
+    return className;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<Order>();
+  }
+};
+
+std::shared_ptr<Order> makeOrder(size_t nameLength) {
+  auto order = std::make_shared<Order>();
+  order->orderId = 42;
+  order->name = std::string(nameLength, 'n');
+  order->amount = 12.5;
+  order->lines = {1, 2, 3};
+  order->tags = {"a", "bc"};
+  order->shipped = true;
+  return order;
+}
+
+// registers the type locally, as the server would, without a pool
+std::shared_ptr<PdxType> registerType(Cache& cache, const Order& order,
+                                      int32_t typeId) {
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto output = cache.createDataOutput();
+  PdxWriterWithTypeCollector collector(output, order.getClassName(), registry);
+  static_cast<const PdxSerializable&>(order).toData(collector);
+  auto type = collector.getPdxLocalType();
+  type->InitializeType();
+  type->setTypeId(typeId);
+  registry->addLocalPdxType(order.getClassName(), type);
+  registry->addPdxType(typeId, type);
+  return type;
+}
+
+std::vector<uint8_t> bytes(const DataOutput& output) {
+  return std::vector<uint8_t>(output.getBuffer(),
+                              output.getBuffer() + output.getBufferLength());
+}
+
+}  // namespace
+
+TEST(PdxSchemaTest, writesSameBytesAsPdxWriter) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto type = registerType(cache, *makeOrder(1), 7);
+
+  // short and long objects use one, two and four byte offsets
+  for (auto nameLength : {1, 300, 70000}) {
+    auto order = makeOrder(static_cast<size_t>(nameLength));
+
+    auto expected = cache.createDataOutput();
+    PdxLocalWriter writer(expected, type, registry);
+    static_cast<const PdxSerializable&>(*order).toData(writer);
+    writer.endObjectWriting();
+
+    auto actual = cache.createDataOutput();
+    PdxSchemaWriter schemaWriter(actual, 7);
+    order->toData(schemaWriter);
+    schemaWriter.end();
+
+    EXPECT_EQ(bytes(expected), bytes(actual)) << nameLength;
+  }
+
+  cache.close();
+}
+
+TEST(PdxSchemaTest, roundTripsThroughCachedTypeId) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  cache.getTypeRegistry().registerPdxType(Order::createDeserializable);
+  auto order = makeOrder(5);
+  registerType(cache, *order, 9);
+
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  EXPECT_EQ(-1, order->getCachedTypeId(registry->getGeneration()));
+
+  auto first = cache.createDataOutput();
+  first.writeObject(order);
+  EXPECT_EQ(9, order->getCachedTypeId(registry->getGeneration()));
+
+  auto second = cache.createDataOutput();
+  second.writeObject(order);
+  EXPECT_EQ(bytes(first), bytes(second));
+
+  auto input = cache.createDataInput(second.getBuffer(),
+                                     second.getBufferLength());
+  std::shared_ptr<Serializable> object;
+  input.readObject(object);
+  auto result = std::dynamic_pointer_cast<Order>(object);
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(order->orderId, result->orderId);
+  EXPECT_EQ(order->name, result->name);
+  EXPECT_EQ(order->amount, result->amount);
+  EXPECT_EQ(order->lines, result->lines);
+  EXPECT_EQ(order->tags, result->tags);
+  EXPECT_EQ(order->shipped, result->shipped);
+  EXPECT_EQ(second.getBufferLength(), input.getBytesRead());
+
+  cache.close();
+}
+
+TEST(PdxSchemaTest, clearForgetsCachedTypeId) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto order = makeOrder(5);
+  registerType(cache, *order, 11);
+
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto output = cache.createDataOutput();
+  output.writeObject(order);
+  EXPECT_EQ(11, order->getCachedTypeId(registry->getGeneration()));
+
+  registry->clear();
+  EXPECT_EQ(-1, order->getCachedTypeId(registry->getGeneration()));
+
+  cache.close();
+}
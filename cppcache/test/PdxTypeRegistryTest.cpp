@@ -0,0 +1,145 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+
+namespace {
+
+class TestablePdxTypeRegistry : public PdxTypeRegistry {
+ public:
+  explicit TestablePdxTypeRegistry(CacheImpl* cache) : PdxTypeRegistry(cache) {}
+
+  using PdxTypeRegistry::registerPdxType;
+};
+
+}  // namespace
+
+TEST(PdxTypeRegistryTest, findsTypesAddedAfterMiss) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+
+  EXPECT_EQ(nullptr, registry->getPdxType(5));
+  EXPECT_EQ(nullptr, registry->getLocalPdxType("Test"));
+  EXPECT_EQ(nullptr, registry->getMergedType(5));
+
+  auto type = std::make_shared<PdxType>(*registry, "Test", true);
+  registry->addPdxType(5, type);
+  registry->addLocalPdxType("Test", type);
+  registry->setMergedType(5, type);
+
+  EXPECT_EQ(type, registry->getPdxType(5));
+  EXPECT_EQ(type, registry->getLocalPdxType("Test"));
+  EXPECT_EQ(type, registry->getMergedType(5));
+
+  cache.close();
+}
+
+TEST(PdxTypeRegistryTest, clearForgetsCachedTypes) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+
+  auto type = std::make_shared<PdxType>(*registry, "Test", true);
+  registry->addPdxType(5, type);
+  registry->addLocalPdxType("Test", type);
+  EXPECT_EQ(type, registry->getPdxType(5));
+  EXPECT_EQ(type, registry->getLocalPdxType("Test"));
+
+  registry->clear();
+
+  EXPECT_EQ(nullptr, registry->getPdxType(5));
+  EXPECT_EQ(nullptr, registry->getLocalPdxType("Test"));
+
+  cache.close();
+}
+
+TEST(PdxTypeRegistryTest, countsCacheHitsAndMisses) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto registry = cacheImpl->getPdxTypeRegistry();
+  auto& stats = cacheImpl->getCachePerfStats();
+
+  registry->addPdxType(5, std::make_shared<PdxType>(*registry, "Test", true));
+
+  // 6 is remembered as missing; hits are reported with the next miss
+  registry->getPdxType(6);
+  auto hits = stats.getPdxTypeCacheHits();
+  auto misses = stats.getPdxTypeCacheMisses();
+
+  registry->getPdxType(5);
+  registry->getPdxType(5);
+  registry->getPdxType(5);
+  registry->getPdxType(6);
+  registry->getPdxType(7);
+
+  EXPECT_EQ(hits + 3, stats.getPdxTypeCacheHits());
+  EXPECT_EQ(misses + 2, stats.getPdxTypeCacheMisses());
+
+  cache.close();
+}
+
+TEST(PdxTypeRegistryTest, findsTypesRegisteredAfterMiss) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto registry = std::make_shared<TestablePdxTypeRegistry>(
+      CacheRegionHelper::getCacheImpl(&cache));
+
+  EXPECT_EQ(nullptr, registry->getPdxType(7));
+
+  auto type = std::make_shared<PdxType>(*registry, "Test", true);
+  int fetches = 0;
+  auto fetchTypeId = [&fetches] {
+    fetches++;
+    return 7;
+  };
+  EXPECT_EQ(7, registry->registerPdxType(type, fetchTypeId));
+  EXPECT_EQ(7, registry->registerPdxType(type, fetchTypeId));
+  EXPECT_EQ(1, fetches);
+
+  EXPECT_EQ(type, registry->getPdxType(7));
+
+  cache.close();
+}
+
+TEST(PdxTypeRegistryTest, cachesTypesPerRegistry) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto first = std::make_shared<PdxTypeRegistry>(cacheImpl);
+  auto second = std::make_shared<PdxTypeRegistry>(cacheImpl);
+
+  auto type = std::make_shared<PdxType>(*first, "Test", true);
+  first->addPdxType(5, type);
+  EXPECT_EQ(type, first->getPdxType(5));
+
+  EXPECT_EQ(nullptr, second->getPdxType(5));
+  EXPECT_EQ(type, first->getPdxType(5));
+  EXPECT_EQ(nullptr, second->getPdxType(5));
+
+  cache.close();
+}
@@ -0,0 +1,207 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/PoolFactory.hpp>
+#include <geode/PoolManager.hpp>
+
+#include "ThinClientPoolDM.hpp"
+
+using apache::geode::client::CacheFactory;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::PoolFactory;
+using apache::geode::client::ThinClientPoolDM;
+
+namespace {
+
+// A loopback port nothing listens on, so connections to it are refused.
+uint16_t closedPort() {
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      io_context, {boost::asio::ip::make_address("127.0.0.1"), 0});
+  return acceptor.local_endpoint().port();
+}
+
+// A loopback server that accepts connections but never answers the
+// handshake, so each connection attempt to it stays open until close().
+class SilentServer {
+ public:
+  SilentServer()
+      : acceptor_(io_context_,
+                  {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+    acceptor_.non_blocking(true);
+  }
+
+  uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+  // Accepts until count connections are open or timeout passes.
+  size_t awaitConnections(size_t count, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (sockets_.size() < count &&
+           std::chrono::steady_clock::now() < deadline) {
+      auto socket =
+          std::make_shared<boost::asio::ip::tcp::socket>(io_context_);
+      boost::system::error_code error;
+      acceptor_.accept(*socket, error);
+      if (error) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      } else {
+        sockets_.push_back(std::move(socket));
+      }
+    }
+    return sockets_.size();
+  }
+
+  // Refuses further connections and fails the handshakes in progress.
+  void close() {
+    acceptor_.close();
+    sockets_.clear();
+  }
+
+ private:
+  boost::asio::io_context io_context_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> sockets_;
+};
+
+}  // namespace
+
+TEST(PoolFactoryTest, prefillParallelismMustBePositive) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto poolFactory = cache.getPoolManager().createFactory();
+
+  EXPECT_THROW(poolFactory.setPrefillParallelism(0), IllegalArgumentException);
+  EXPECT_THROW(poolFactory.setPrefillParallelism(-1),
+               IllegalArgumentException);
+  EXPECT_NO_THROW(poolFactory.setPrefillParallelism(1));
+
+  cache.close();
+}
+
+TEST(PoolFactoryTest, prefillTimeoutMustNotBeNegative) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto poolFactory = cache.getPoolManager().createFactory();
+
+  EXPECT_THROW(poolFactory.setPrefillTimeout(std::chrono::milliseconds(-1)),
+               IllegalArgumentException);
+  EXPECT_NO_THROW(poolFactory.setPrefillTimeout(std::chrono::seconds(1)));
+  EXPECT_NO_THROW(
+      poolFactory.setPrefillTimeout(std::chrono::milliseconds::zero()));
+
+  cache.close();
+}
+
+TEST(PoolFactoryTest, createWaitsUpToPrefillTimeout) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  const auto timeout = std::chrono::milliseconds(500);
+
+  auto start = std::chrono::steady_clock::now();
+  auto pool = cache.getPoolManager()
+                  .createFactory()
+                  .addServer("127.0.0.1", closedPort())
+                  .setMinConnections(2)
+                  .setPrefillParallelism(2)
+                  .setPrefillTimeout(timeout)
+                  .create("pool");
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // No connection can be opened, so the pool is returned once the timeout
+  // passes, still short of its minimum connections.
+  EXPECT_LE(timeout, elapsed);
+  EXPECT_GT(timeout + std::chrono::seconds(5), elapsed);
+  EXPECT_EQ(2, pool->getPrefillParallelism());
+  EXPECT_EQ(timeout, pool->getPrefillTimeout());
+  EXPECT_EQ(std::chrono::nanoseconds::zero(),
+            std::dynamic_pointer_cast<ThinClientPoolDM>(pool)
+                ->getStats()
+                .getTimeToReady());
+
+  cache.close();
+}
+
+TEST(PoolFactoryTest, prefillOpensConnectionsInParallel) {
+  SilentServer server;
+  // the prefill helpers run on the cache's thread pool
+  auto cache = CacheFactory{}
+                   .set("log-level", "none")
+                   .set("max-fe-threads", "4")
+                   .create();
+
+  cache.getPoolManager()
+      .createFactory()
+      .addServer("127.0.0.1", server.port())
+      .setMinConnections(4)
+      .setPrefillParallelism(4)
+      .create("pool");
+
+  // None of the handshakes completes, so one connection at a time would
+  // leave a single one open.
+  EXPECT_EQ(4u, server.awaitConnections(4, std::chrono::seconds(10)));
+
+  server.close();
+  cache.close();
+}
+
+TEST(PoolFactoryTest, createDoesNotWaitByDefault) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+
+  auto start = std::chrono::steady_clock::now();
+  auto pool = cache.getPoolManager()
+                  .createFactory()
+                  .addServer("127.0.0.1", closedPort())
+                  .setMinConnections(2)
+                  .create("pool");
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_GT(std::chrono::milliseconds(500), elapsed);
+  EXPECT_EQ(PoolFactory::DEFAULT_PREFILL_PARALLELISM,
+            pool->getPrefillParallelism());
+  EXPECT_EQ(PoolFactory::DEFAULT_PREFILL_TIMEOUT, pool->getPrefillTimeout());
+
+  cache.close();
+}
+
+TEST(PoolFactoryTest, poolWithoutMinimumConnectionsIsReadyAtOnce) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+
+  auto pool = cache.getPoolManager()
+                  .createFactory()
+                  .addServer("127.0.0.1", closedPort())
+                  .setMinConnections(0)
+                  .setPrefillTimeout(std::chrono::seconds(10))
+                  .create("pool");
+
+  auto timeToReady = std::dynamic_pointer_cast<ThinClientPoolDM>(pool)
+                         ->getStats()
+                         .getTimeToReady();
+  EXPECT_LT(std::chrono::nanoseconds::zero(), timeToReady);
+  EXPECT_GT(std::chrono::seconds(10), timeToReady);
+
+  cache.close();
+}
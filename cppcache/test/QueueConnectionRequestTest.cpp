@@ -33,7 +33,11 @@ namespace geode {
 namespace client {
 
 class QueueConnectionRequestTest : public ::testing::Test,
-                                   public ByteArrayFixture {};
+                                   public ByteArrayFixture {
+ protected:
+  // every pool the tests before this one created bumped the sync counter
+  void SetUp() override { ClientProxyMembershipID::resetSyncCounter(); }
+};
 
 TEST_F(QueueConnectionRequestTest, testToData) {
   namespace bip = boost::asio::ip;
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include "ServerLoadSnapshot.hpp"
+
+using apache::geode::client::ServerLoadSnapshot;
+using apache::geode::client::ServerLocation;
+
+namespace {
+
+int32_t noLoad(const ServerLocation&) { return 0; }
+
+}  // namespace
+
+TEST(ServerLoadSnapshotTest, staleUntilFirstUpdate) {
+  ServerLoadSnapshot snapshot(std::chrono::milliseconds(1000), 1);
+  auto now = ServerLoadSnapshot::clock::now();
+
+  ServerLocation selected;
+  EXPECT_FALSE(snapshot.select({}, noLoad, selected));
+  EXPECT_TRUE(snapshot.claimRefresh(now));
+
+  snapshot.update({ServerLocation("a", 1)}, now);
+  EXPECT_TRUE(snapshot.select({}, noLoad, selected));
+  EXPECT_EQ(ServerLocation("a", 1), selected);
+}
+
+TEST(ServerLoadSnapshotTest, onlyOneCallerRefreshes) {
+  ServerLoadSnapshot snapshot(std::chrono::milliseconds(1000), 1);
+  auto now = ServerLoadSnapshot::clock::now();
+
+  EXPECT_TRUE(snapshot.claimRefresh(now));
+  EXPECT_FALSE(snapshot.claimRefresh(now));
+
+  snapshot.refreshFailed();
+  EXPECT_TRUE(snapshot.claimRefresh(now));
+}
+
+TEST(ServerLoadSnapshotTest, refreshesAfterMaxAge) {
+  ServerLoadSnapshot snapshot(std::chrono::milliseconds(1000), 1);
+  auto now = ServerLoadSnapshot::clock::now();
+
+  snapshot.update({ServerLocation("a", 1)}, now);
+  EXPECT_FALSE(snapshot.claimRefresh(now + std::chrono::milliseconds(999)));
+  EXPECT_TRUE(snapshot.claimRefresh(now + std::chrono::milliseconds(1000)));
+}
+
+TEST(ServerLoadSnapshotTest, skipsExcludedServers) {
+  ServerLoadSnapshot snapshot(std::chrono::milliseconds(1000), 1);
+  snapshot.update({ServerLocation("a", 1), ServerLocation("b", 2)});
+
+  ServerLocation selected;
+  for (int i = 0; i < 20; i++) {
+    EXPECT_TRUE(snapshot.select({ServerLocation("a", 1)}, noLoad, selected));
+    EXPECT_EQ(ServerLocation("b", 2), selected);
+  }
+
+  EXPECT_FALSE(snapshot.select({ServerLocation("a", 1), ServerLocation("b", 2)},
+                               noLoad, selected));
+}
+
+TEST(ServerLoadSnapshotTest, prefersLessLoadedServers) {
+  ServerLoadSnapshot snapshot(std::chrono::milliseconds(1000), 1);
+  snapshot.update({ServerLocation("idle", 1), ServerLocation("busy", 2)});
+
+  auto load = [](const ServerLocation& server) {
+    return server.getServerName() == "busy" ? 99 : 0;
+  };
+
+  std::map<std::string, int> picks;
+  ServerLocation selected;
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(snapshot.select({}, load, selected));
+    ++picks[selected.getServerName()];
+  }
+
+  EXPECT_GT(picks["idle"], 950);
+  EXPECT_GT(picks["busy"], 0);
+}
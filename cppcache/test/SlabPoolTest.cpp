@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "SlabPool.hpp"
+
+using apache::geode::client::SlabPool;
+using apache::geode::client::SlabPoolAllocator;
+
+TEST(SlabPoolTest, reusesFreedBlocks) {
+  auto pool = SlabPool::create();
+
+  auto first = pool->allocate(24);
+  EXPECT_GE(pool->blockSize(), 24u);
+  EXPECT_EQ(0u, pool->blockSize() % alignof(std::max_align_t));
+  pool->deallocate(first, 24);
+
+  auto second = pool->allocate(24);
+  EXPECT_EQ(first, second);
+  pool->deallocate(second, 24);
+
+  for (size_t i = 0; i <= SlabPool::MIN_BLOCKS_PER_SLAB; i++) {
+    pool->deallocate(pool->allocate(24), 24);
+  }
+  EXPECT_EQ(1u, pool->slabCount());
+}
+
+TEST(SlabPoolTest, otherSizesAreNotPooled) {
+  auto pool = SlabPool::create();
+  pool->deallocate(pool->allocate(16), 16);
+
+  auto large = pool->allocate(1024);
+  ASSERT_NE(nullptr, large);
+  pool->deallocate(large, 1024);
+
+  SlabPoolAllocator<int> allocator(pool.get());
+  auto array = allocator.allocate(100);
+  allocator.deallocate(array, 100);
+
+  EXPECT_EQ(16u, pool->blockSize());
+}
+
+TEST(SlabPoolTest, objectsOutliveOwner) {
+  auto pool = SlabPool::create();
+  auto value = std::allocate_shared<int64_t>(
+      SlabPoolAllocator<int64_t>(pool.get()), 42);
+  EXPECT_EQ(1u, pool->slabCount());
+
+  pool.reset();
+  EXPECT_EQ(42, *value);
+  value.reset();
+}
+
+TEST(SlabPoolTest, releasesEmptySlabs) {
+  auto pool = SlabPool::create();
+
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < 4 * SlabPool::MIN_BLOCKS_PER_SLAB; i++) {
+    blocks.push_back(pool->allocate(24));
+  }
+  EXPECT_LE(2u, pool->slabCount());
+
+  for (auto block : blocks) {
+    pool->deallocate(block, 24);
+  }
+  EXPECT_EQ(1u, pool->slabCount());
+}
+
+TEST(SlabPoolTest, reusesPartiallyUsedSlab) {
+  auto pool = SlabPool::create();
+
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < 4 * SlabPool::MIN_BLOCKS_PER_SLAB; i++) {
+    blocks.push_back(pool->allocate(24));
+  }
+  auto slabs = pool->slabCount();
+
+  // free every other block; no slab becomes empty
+  for (size_t i = 0; i < blocks.size(); i += 2) {
+    pool->deallocate(blocks[i], 24);
+  }
+  EXPECT_EQ(slabs, pool->slabCount());
+
+  for (size_t i = 0; i < blocks.size(); i += 2) {
+    blocks[i] = pool->allocate(24);
+  }
+  EXPECT_EQ(slabs, pool->slabCount());
+
+  for (auto block : blocks) {
+    pool->deallocate(block, 24);
+  }
+}
@@ -0,0 +1,162 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/filesystem.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "DnsResolver.hpp"
+#include "SslContext.hpp"
+#include "TcpSslConn.hpp"
+
+using apache::geode::client::DnsResolver;
+using apache::geode::client::SslContext;
+using apache::geode::client::SslException;
+using apache::geode::client::TcpSslConn;
+
+namespace {
+
+/**
+ * Writes a self-signed certificate and its private key to one PEM file,
+ * usable both as the server's key store and as the client's trust store.
+ */
+class SelfSignedCertificate {
+ public:
+  SelfSignedCertificate()
+      : path_(boost::filesystem::temp_directory_path() /
+              boost::filesystem::unique_path("ssl-context-test-%%%%%%.pem")) {
+    auto context = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    EVP_PKEY* key = nullptr;
+    EVP_PKEY_keygen_init(context);
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(context, NID_X9_62_prime256v1);
+    EVP_PKEY_keygen(context, &key);
+    EVP_PKEY_CTX_free(context);
+
+    auto certificate = X509_new();
+    X509_set_version(certificate, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 3600);
+    X509_set_pubkey(certificate, key);
+    auto name = X509_get_subject_name(certificate);
+    X509_NAME_add_entry_by_txt(
+        name, "CN", MBSTRING_ASC,
+        reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(certificate, name);
+    X509_sign(certificate, key, EVP_sha256());
+
+    auto file = std::fopen(path_.string().c_str(), "w");
+    PEM_write_X509(file, certificate);
+    PEM_write_PrivateKey(file, key, nullptr, nullptr, 0, nullptr, nullptr);
+    std::fclose(file);
+
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+  }
+
+  ~SelfSignedCertificate() { boost::filesystem::remove(path_); }
+
+  std::string path() const { return path_.string(); }
+
+ private:
+  boost::filesystem::path path_;
+};
+
+/**
+ * Accepts TLS connections on a loopback port and holds each one open until
+ * the client closes it.
+ */
+class TlsServer {
+ public:
+  explicit TlsServer(const std::string& keyStore)
+      : context_(boost::asio::ssl::context::tls_server),
+        acceptor_(io_context_,
+                  {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+    context_.use_certificate_chain_file(keyStore);
+    context_.use_private_key_file(keyStore, boost::asio::ssl::context::pem);
+    // TLS 1.2 hands out the session during the handshake; TLS 1.3 sends it
+    // afterwards, and the client only sees it once it reads.
+    SSL_CTX_set_max_proto_version(context_.native_handle(), TLS1_2_VERSION);
+  }
+
+  uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+  void serve(int connections) {
+    thread_ = std::thread([this, connections] {
+      for (int i = 0; i < connections; i++) {
+        boost::asio::ip::tcp::socket socket(io_context_);
+        acceptor_.accept(socket);
+        boost::asio::ssl::stream<boost::asio::ip::tcp::socket&> stream(
+            socket, context_);
+        boost::system::error_code error;
+        stream.handshake(boost::asio::ssl::stream_base::server, error);
+        char data;
+        boost::asio::read(stream, boost::asio::buffer(&data, 1), error);
+      }
+    });
+  }
+
+  void join() { thread_.join(); }
+
+ private:
+  boost::asio::io_context io_context_;
+  boost::asio::ssl::context context_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::thread thread_;
+};
+
+}  // namespace
+
+TEST(SslContextTest, missingTrustStoreThrowsSslException) {
+  EXPECT_THROW(SslContext("no-such-truststore.pem", "", ""), SslException);
+}
+
+TEST(SslContextTest, secondHandshakeResumesCachedSession) {
+  SelfSignedCertificate certificate;
+  TlsServer server(certificate.path());
+  server.serve(2);
+
+  SslContext sslContext(certificate.path(), "", "");
+  DnsResolver resolver(std::chrono::seconds(60), std::chrono::seconds(60));
+  auto endpoint = "127.0.0.1:" + std::to_string(server.port());
+
+  {
+    TcpSslConn first(endpoint, std::chrono::seconds(10), 65536, resolver,
+                     sslContext);
+    EXPECT_FALSE(first.isSessionReused());
+  }
+  {
+    TcpSslConn second(endpoint, std::chrono::seconds(10), 65536, resolver,
+                      sslContext);
+    EXPECT_TRUE(second.isSessionReused());
+  }
+
+  server.join();
+}
@@ -0,0 +1,72 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableString;
+using apache::geode::client::FunctionException;
+using apache::geode::client::StreamingResultCollector;
+
+TEST(StreamingResultCollectorTest, handsOverResultsAsAdded) {
+  std::vector<std::string> received;
+  StreamingResultCollector collector(
+      [&received](const std::shared_ptr<Cacheable>& result) {
+        received.push_back(result->toString());
+        return true;
+      });
+
+  collector.addResult(CacheableString::create("a"));
+  EXPECT_EQ(std::vector<std::string>({"a"}), received);
+
+  collector.addResult(CacheableString::create("b"));
+  collector.endResults();
+
+  EXPECT_EQ(std::vector<std::string>({"a", "b"}), received);
+  EXPECT_FALSE(collector.isCancelled());
+  EXPECT_TRUE(collector.getResult()->empty());
+}
+
+TEST(StreamingResultCollectorTest, handlerCancelsRemainingResults) {
+  int received = 0;
+  StreamingResultCollector collector(
+      [&received](const std::shared_ptr<Cacheable>&) {
+        return ++received < 2;
+      });
+
+  for (auto i = 0; i < 5; i++) {
+    collector.addResult(CacheableString::create("a"));
+  }
+
+  EXPECT_EQ(2, received);
+  EXPECT_TRUE(collector.isCancelled());
+}
+
+TEST(StreamingResultCollectorTest, getResultWaitsForEnd) {
+  StreamingResultCollector collector(
+      [](const std::shared_ptr<Cacheable>&) { return true; });
+
+  EXPECT_THROW(collector.getResult(std::chrono::milliseconds(1)),
+               FunctionException);
+}
@@ -0,0 +1,332 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "TcrEndpoint.hpp"
+#include "TcrMessage.hpp"
+#include "util/concurrent/binary_semaphore.hpp"
+
+namespace {
+
+using apache::geode::client::binary_semaphore;
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataInput;
+using apache::geode::client::TcrEndpoint;
+using apache::geode::client::TcrMessage;
+using apache::geode::client::TcrMessageReply;
+
+const uint8_t kDelta[] = {0};
+
+// An entry event for a key of /region, told apart by its value.
+class TestNotification : public TcrMessageReply {
+ public:
+  TestNotification(int32_t type, const std::string& key, int32_t value)
+      : TcrMessageReply(true, nullptr) {
+    m_msgType = type;
+    m_regionName = "/region";
+    m_key = CacheableString::create(key);
+    m_value = CacheableInt32::create(value);
+  }
+
+  void setCq(const std::string& cqName) {
+    m_hasCqsPart = true;
+    initCqMap();
+    (*m_cqs)[cqName] = m_msgType;
+  }
+
+  void setDelta(const CacheImpl& cacheImpl) {
+    m_delta.reset(
+        new DataInput(cacheImpl.createDataInput(kDelta, sizeof(kDelta))));
+  }
+};
+
+std::unique_ptr<TcrMessageReply> update(const std::string& key,
+                                        int32_t value) {
+  return std::unique_ptr<TcrMessageReply>(
+      new TestNotification(TcrMessage::LOCAL_UPDATE, key, value));
+}
+
+std::unique_ptr<TcrMessageReply> cqUpdate(const std::string& key,
+                                          int32_t value) {
+  auto msg = new TestNotification(TcrMessage::LOCAL_UPDATE, key, value);
+  msg->setCq("cq");
+  return std::unique_ptr<TcrMessageReply>(msg);
+}
+
+std::unique_ptr<TcrMessageReply> destroy(const std::string& key,
+                                         int32_t value) {
+  return std::unique_ptr<TcrMessageReply>(
+      new TestNotification(TcrMessage::LOCAL_DESTROY, key, value));
+}
+
+struct Semaphores {
+  binary_semaphore failover{false};
+  binary_semaphore cleanup{false};
+  binary_semaphore redundancy{false};
+};
+
+// Records the values of the notifications it applies, and the size of each
+// batch of CQ notifications. Applying them waits for release(), so that the
+// notifications delivered meanwhile queue up. Its CQs have a batch listener
+// once setCqBatchListener() is called.
+class TestableTcrEndpoint : private Semaphores, public TcrEndpoint {
+ public:
+  explicit TestableTcrEndpoint(CacheImpl* cacheImpl)
+      : TcrEndpoint("localhost:40404", cacheImpl, failover, cleanup,
+                    redundancy, nullptr, false),
+        released_(false),
+        cqBatchListener_(false),
+        conflated_(0) {}
+
+  ~TestableTcrEndpoint() override {
+    release();
+    stopNotificationDispatcher();
+  }
+
+  using TcrEndpoint::deliverNotification;
+  using TcrEndpoint::startNotificationDispatcher;
+  using TcrEndpoint::stopNotificationDispatcher;
+
+  void release() {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    released_ = true;
+    condition_.notify_all();
+  }
+
+  void awaitApplied(size_t count) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    condition_.wait(lock, [&] { return applied_.size() >= count; });
+  }
+
+  std::vector<int32_t> applied() {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    return applied_;
+  }
+
+  std::vector<size_t> cqBatches() {
+    std::lock_guard<decltype(mutex_)> guard(mutex_);
+    return cqBatches_;
+  }
+
+  int conflated() const { return conflated_; }
+
+  void setCqBatchListener() { cqBatchListener_ = true; }
+
+ protected:
+  void dispatchNotification(TcrMessageReply& msg) override {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    record(msg);
+    condition_.notify_all();
+    condition_.wait(lock, [this] { return released_; });
+  }
+
+  void dispatchCqNotifications(const std::vector<TcrMessage*>& msgs) override {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    for (auto msg : msgs) {
+      record(*msg);
+    }
+    cqBatches_.push_back(msgs.size());
+    condition_.notify_all();
+    condition_.wait(lock, [this] { return released_; });
+  }
+
+  bool hasCqBatchListener(const TcrMessage&) override {
+    return cqBatchListener_;
+  }
+
+  void handleConflatedNotification() override { conflated_++; }
+
+ private:
+  void record(const TcrMessage& msg) {
+    applied_.push_back(
+        std::dynamic_pointer_cast<CacheableInt32>(msg.getValue())->value());
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool released_;
+  std::vector<int32_t> applied_;
+  std::vector<size_t> cqBatches_;
+  std::atomic<bool> cqBatchListener_;
+  std::atomic<int> conflated_;
+};
+
+class TcrEndpointTest : public ::testing::Test {
+ protected:
+  TcrEndpointTest()
+      : cache_(CacheFactory{}
+                   .set("log-level", "none")
+                   .set("client-conflate-events-queue-size", "4")
+                   .create()),
+        cacheImpl_(CacheRegionHelper::getCacheImpl(&cache_)),
+        endpoint_(cacheImpl_) {}
+
+  Cache cache_;
+  CacheImpl* cacheImpl_;
+  TestableTcrEndpoint endpoint_;
+};
+
+TEST_F(TcrEndpointTest, appliesNotificationWithoutDispatcher) {
+  endpoint_.release();
+
+  endpoint_.deliverNotification(update("a", 1));
+
+  EXPECT_EQ(std::vector<int32_t>{1}, endpoint_.applied());
+}
+
+TEST_F(TcrEndpointTest, appliesCqNotificationWithoutBatchListener) {
+  endpoint_.release();
+
+  endpoint_.deliverNotification(cqUpdate("a", 1));
+
+  EXPECT_EQ(std::vector<int32_t>{1}, endpoint_.applied());
+  EXPECT_TRUE(endpoint_.cqBatches().empty());
+}
+
+TEST_F(TcrEndpointTest, startsDispatcherForCqBatchListener) {
+  endpoint_.setCqBatchListener();
+  endpoint_.release();
+  endpoint_.deliverNotification(update("x", 0));
+  ASSERT_EQ(std::vector<int32_t>{0}, endpoint_.applied());
+
+  endpoint_.deliverNotification(cqUpdate("a", 1));
+  endpoint_.awaitApplied(2);
+
+  EXPECT_EQ(std::vector<size_t>{1}, endpoint_.cqBatches());
+}
+
+TEST_F(TcrEndpointTest, conflatesPendingUpdates) {
+  endpoint_.startNotificationDispatcher(true);
+  endpoint_.deliverNotification(update("a", 1));
+  endpoint_.awaitApplied(1);
+
+  endpoint_.deliverNotification(update("a", 2));
+  endpoint_.deliverNotification(update("b", 3));
+  endpoint_.deliverNotification(update("a", 4));
+  endpoint_.release();
+  endpoint_.awaitApplied(3);
+  endpoint_.stopNotificationDispatcher();
+
+  EXPECT_EQ((std::vector<int32_t>{1, 3, 4}), endpoint_.applied());
+  EXPECT_EQ(1, endpoint_.conflated());
+}
+
+TEST_F(TcrEndpointTest, batchesCqNotificationsWithoutConflating) {
+  endpoint_.startNotificationDispatcher(false);
+  endpoint_.deliverNotification(update("x", 0));
+  endpoint_.awaitApplied(1);
+
+  endpoint_.deliverNotification(cqUpdate("a", 1));
+  endpoint_.deliverNotification(cqUpdate("a", 2));
+  endpoint_.deliverNotification(update("b", 3));
+  endpoint_.deliverNotification(update("b", 4));
+  endpoint_.release();
+  endpoint_.awaitApplied(5);
+  endpoint_.stopNotificationDispatcher();
+
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 2, 3, 4}), endpoint_.applied());
+  EXPECT_EQ(std::vector<size_t>{2}, endpoint_.cqBatches());
+  EXPECT_EQ(0, endpoint_.conflated());
+}
+
+TEST_F(TcrEndpointTest, keepsDeltasAndDestroys) {
+  endpoint_.startNotificationDispatcher(true);
+  endpoint_.deliverNotification(update("x", 0));
+  endpoint_.awaitApplied(1);
+
+  auto delta = update("a", 1);
+  static_cast<TestNotification&>(*delta).setDelta(*cacheImpl_);
+  endpoint_.deliverNotification(std::move(delta));
+  endpoint_.deliverNotification(update("a", 2));
+  endpoint_.deliverNotification(update("a", 3));
+  endpoint_.deliverNotification(destroy("a", 4));
+  endpoint_.deliverNotification(update("a", 5));
+  endpoint_.release();
+  endpoint_.awaitApplied(5);
+  endpoint_.stopNotificationDispatcher();
+
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 3, 4, 5}), endpoint_.applied());
+  EXPECT_EQ(1, endpoint_.conflated());
+}
+
+TEST_F(TcrEndpointTest, readerWaitsWhileQueueIsFull) {
+  endpoint_.startNotificationDispatcher(true);
+  endpoint_.deliverNotification(update("a", 1));
+  endpoint_.awaitApplied(1);
+
+  endpoint_.deliverNotification(update("b", 2));
+  endpoint_.deliverNotification(update("c", 3));
+  endpoint_.deliverNotification(update("d", 4));
+  endpoint_.deliverNotification(update("e", 5));
+
+  std::atomic<bool> delivered{false};
+  std::thread reader([&] {
+    endpoint_.deliverNotification(update("f", 6));
+    delivered = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(delivered);
+
+  // an update replacing a pending one takes no room in the queue
+  endpoint_.deliverNotification(update("b", 7));
+
+  endpoint_.release();
+  reader.join();
+  endpoint_.awaitApplied(6);
+  endpoint_.stopNotificationDispatcher();
+
+  EXPECT_EQ((std::vector<int32_t>{1, 3, 4, 5, 7, 6}), endpoint_.applied());
+}
+
+TEST_F(TcrEndpointTest, dropsQueuedNotificationsWhenStopped) {
+  endpoint_.startNotificationDispatcher(true);
+  endpoint_.deliverNotification(update("a", 1));
+  endpoint_.awaitApplied(1);
+
+  endpoint_.deliverNotification(update("b", 2));
+  endpoint_.deliverNotification(update("c", 3));
+
+  std::thread stopper([&] { endpoint_.stopNotificationDispatcher(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  endpoint_.release();
+  stopper.join();
+
+  EXPECT_EQ(std::vector<int32_t>{1}, endpoint_.applied());
+}
+
+}  // namespace
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PoolFactory.hpp>
+#include <geode/PoolManager.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "TcrMessage.hpp"
+#include "ThinClientPoolDM.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataOutput;
+using apache::geode::client::FanOutWork;
+using apache::geode::client::TcrMessage;
+using apache::geode::client::TcrMessagePing;
+using apache::geode::client::TcrMessageReply;
+using apache::geode::client::ThinClientPoolDM;
+
+namespace {
+
+const std::chrono::milliseconds kFreeConnectionTimeout{500};
+
+// A loopback port nothing listens on, so connections to it are refused.
+uint16_t closedPort() {
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      io_context, {boost::asio::ip::make_address("127.0.0.1"), 0});
+  return acceptor.local_endpoint().port();
+}
+
+class TestWork : public FanOutWork {
+ public:
+  TestWork(Cache& cache, ThinClientPoolDM* pool, bool cancelled)
+      : FanOutWork(nullptr, false, false),
+        request_(std::unique_ptr<DataOutput>(new DataOutput(
+            CacheRegionHelper::getCacheImpl(&cache)->createDataOutput()))),
+        reply_(true, pool),
+        cancelled_(cancelled) {}
+
+  std::vector<GfErrType> errors;
+
+ protected:
+  TcrMessage& request() override { return request_; }
+  TcrMessageReply& reply() override { return reply_; }
+  bool isCancelled() override { return cancelled_; }
+
+  GfErrType complete(GfErrType error) override {
+    errors.push_back(error);
+    return GF_MSG;
+  }
+
+ private:
+  TcrMessagePing request_;
+  TcrMessageReply reply_;
+  bool cancelled_;
+};
+
+}  // namespace
+
+class ThinClientPoolDMTest : public ::testing::Test {
+ protected:
+  ThinClientPoolDMTest()
+      : cache_(CacheFactory{}.set("log-level", "none").create()) {
+    pool_ = std::dynamic_pointer_cast<ThinClientPoolDM>(
+        cache_.getPoolManager()
+            .createFactory()
+            .addServer("127.0.0.1", closedPort())
+            .setMinConnections(0)
+            .setRetryAttempts(0)
+            .setFreeConnectionTimeout(kFreeConnectionTimeout)
+            .create("pool"));
+  }
+
+  ~ThinClientPoolDMTest() override { cache_.close(); }
+
+  Cache cache_;
+  std::shared_ptr<ThinClientPoolDM> pool_;
+};
+
+TEST_F(ThinClientPoolDMTest, fanOutCompletesEveryWorkOnce) {
+  TestWork first(cache_, pool_.get(), false);
+  TestWork second(cache_, pool_.get(), false);
+
+  pool_->sendFanOut({&first, &second});
+
+  ASSERT_EQ(1u, first.errors.size());
+  EXPECT_NE(GF_NOERR, first.errors[0]);
+  EXPECT_EQ(GF_MSG, first.getResult());
+  ASSERT_EQ(1u, second.errors.size());
+  EXPECT_NE(GF_NOERR, second.errors[0]);
+  EXPECT_EQ(GF_MSG, second.getResult());
+}
+
+TEST_F(ThinClientPoolDMTest, fanOutWaitsForAConnectionOncePerWork) {
+  TestWork first(cache_, pool_.get(), false);
+  TestWork second(cache_, pool_.get(), false);
+
+  auto start = std::chrono::steady_clock::now();
+  pool_->sendFanOut({&first, &second});
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // a second wait for either work would take four timeouts
+  EXPECT_LT(elapsed, 3 * kFreeConnectionTimeout);
+  EXPECT_EQ(GF_MSG, first.getResult());
+  EXPECT_EQ(GF_MSG, second.getResult());
+}
+
+TEST_F(ThinClientPoolDMTest, fanOutSkipsCancelledWork) {
+  TestWork cancelled(cache_, pool_.get(), true);
+
+  pool_->sendFanOut({&cancelled});
+
+  EXPECT_TRUE(cancelled.errors.empty());
+  EXPECT_EQ(GF_NOERR, cancelled.getResult());
+}
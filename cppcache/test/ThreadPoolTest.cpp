@@ -20,13 +20,16 @@
 #include <condition_variable>
 #include <deque>
 #include <mutex>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "ThreadPool.hpp"
 
 using apache::geode::client::Callable;
+using apache::geode::client::PooledWork;
 using apache::geode::client::ThreadPool;
 
 class TestCallable : public Callable {
@@ -54,3 +57,104 @@ TEST(ThreadPoolTest, callableIsCalled) {
 
   ASSERT_EQ(1, c->called_);
 }
+
+class ValueWork : public PooledWork<int> {
+ public:
+  explicit ValueWork(int value) : value_(value) {}
+
+ protected:
+  int execute() override { return value_; }
+
+ private:
+  int value_;
+};
+
+class FanOutWork : public PooledWork<int> {
+ public:
+  FanOutWork(ThreadPool& threadPool, int width)
+      : threadPool_(threadPool), width_(width) {}
+
+ protected:
+  int execute() override {
+    std::vector<std::shared_ptr<ValueWork>> workers;
+    for (int i = 1; i <= width_; i++) {
+      auto worker = std::make_shared<ValueWork>(i);
+      threadPool_.perform(worker);
+      workers.push_back(worker);
+    }
+
+    int sum = 0;
+    for (auto& worker : workers) {
+      sum += worker->getResult();
+    }
+    return sum;
+  }
+
+ private:
+  ThreadPool& threadPool_;
+  int width_;
+};
+
+class ThrowingWork : public PooledWork<int> {
+ protected:
+  int execute() override { throw std::runtime_error("failed"); }
+};
+
+TEST(ThreadPoolTest, pooledWorkReturnsResults) {
+  ThreadPool threadPool(4);
+
+  std::vector<std::shared_ptr<ValueWork>> workers;
+  for (int i = 0; i < 1000; i++) {
+    auto worker = std::make_shared<ValueWork>(i);
+    threadPool.perform(worker);
+    workers.push_back(worker);
+  }
+
+  int expected = 0;
+  for (auto& worker : workers) {
+    ASSERT_EQ(expected++, worker->getResult());
+  }
+}
+
+TEST(ThreadPoolTest, nestedFanOutDoesNotDeadlock) {
+  ThreadPool threadPool(1);
+
+  std::vector<std::shared_ptr<FanOutWork>> workers;
+  for (int i = 0; i < 8; i++) {
+    auto worker = std::make_shared<FanOutWork>(threadPool, 10);
+    threadPool.perform(worker);
+    workers.push_back(worker);
+  }
+
+  for (auto& worker : workers) {
+    ASSERT_EQ(55, worker->getResult());
+  }
+}
+
+TEST(ThreadPoolTest, pooledWorkRunsInlineWithoutWorkers) {
+  ThreadPool threadPool(0);
+
+  auto worker = std::make_shared<ValueWork>(42);
+  threadPool.perform(worker);
+
+  ASSERT_EQ(42, worker->getResult());
+}
+
+TEST(ThreadPoolTest, pooledWorkRunsInlineAfterShutDown) {
+  ThreadPool threadPool(2);
+  threadPool.shutDown();
+
+  auto worker = std::make_shared<ValueWork>(42);
+  threadPool.perform(worker);
+
+  ASSERT_EQ(42, worker->getResult());
+}
+
+TEST(ThreadPoolTest, pooledWorkRethrowsFromGetResult) {
+  ThreadPool threadPool(1);
+
+  auto worker = std::make_shared<ThrowingWork>();
+  threadPool.perform(worker);
+
+  ASSERT_THROW(worker->getResult(), std::runtime_error);
+}
@@ -0,0 +1,192 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "MapEntryImpl.hpp"
+#include "MapSegment.hpp"
+#include "RegionInternal.hpp"
+#include "TombstoneList.hpp"
+#include "VersionTag.hpp"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::EntryFactory;
+using apache::geode::client::MapEntryImpl;
+using apache::geode::client::MapSegment;
+using apache::geode::client::RegionInternal;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::TombstoneList;
+using apache::geode::client::VersionTag;
+
+class TombstoneListTest : public ::testing::Test {
+ protected:
+  TombstoneListTest()
+      : cache_(CacheFactory{}
+                   .set("log-level", "none")
+                   .set("tombstone-timeout", "2000ms")
+                   .create()),
+        cacheImpl_(CacheRegionHelper::getCacheImpl(&cache_)),
+        region_(cache_.createRegionFactory(RegionShortcut::LOCAL)
+                    .create("region")),
+        entryFactory_(true),
+        destroyTrackers_(0) {
+    segment_.open(dynamic_cast<RegionInternal*>(region_.get()),
+                  &entryFactory_, &cacheImpl_->getExpiryTaskManager(), 16,
+                  &destroyTrackers_, true);
+  }
+
+  std::shared_ptr<VersionTag> tag(int32_t entryVersion, uint16_t member,
+                                  int32_t regionVersion) {
+    return std::make_shared<VersionTag>(
+        entryVersion, static_cast<int16_t>(0), regionVersion, member,
+        static_cast<uint16_t>(0), *cacheImpl_->getMemberListForVersionStamp());
+  }
+
+  // Destroys a key the segment has never seen, leaving a tombstone.
+  void destroy(const std::string& key, uint16_t member = 1,
+               int32_t regionVersion = 1) {
+    std::shared_ptr<Cacheable> oldValue;
+    std::shared_ptr<MapEntryImpl> entry;
+    bool isEntryFound = false;
+    segment_.remove(CacheableKey::create(key), oldValue, entry, -1,
+                    tag(1, member, regionVersion), true, isEntryFound);
+  }
+
+  bool isTombstone(const std::string& key) {
+    std::shared_ptr<MapEntryImpl> entry;
+    bool result = false;
+    segment_.isTombstone(CacheableKey::create(key), entry, result);
+    return result;
+  }
+
+  bool contains(const std::string& key) {
+    return segment_.containsKey(CacheableKey::create(key));
+  }
+
+  TombstoneList& tombstones() { return segment_.getTombstoneList(); }
+
+  Cache cache_;
+  CacheImpl* cacheImpl_;
+  std::shared_ptr<apache::geode::client::Region> region_;
+  EntryFactory entryFactory_;
+  std::atomic<int32_t> destroyTrackers_;
+  MapSegment segment_;
+};
+
+TEST_F(TombstoneListTest, expiresGenerationsInOrder) {
+  destroy("old");
+  // the generations span a tenth of the tombstone timeout
+  std::this_thread::sleep_for(std::chrono::milliseconds(250));
+  destroy("new");
+
+  TombstoneList::clock::time_point first;
+  ASSERT_TRUE(tombstones().next_generation(first));
+  EXPECT_EQ(0u, tombstones().expire(100, first - std::chrono::milliseconds(1)));
+  EXPECT_TRUE(isTombstone("old"));
+
+  EXPECT_EQ(1u, tombstones().expire(100, first));
+  EXPECT_FALSE(isTombstone("old"));
+  EXPECT_TRUE(isTombstone("new"));
+
+  TombstoneList::clock::time_point second;
+  ASSERT_TRUE(tombstones().next_generation(second));
+  EXPECT_GT(second, first);
+  EXPECT_EQ(1u, tombstones().expire(100, second));
+  EXPECT_FALSE(isTombstone("new"));
+  EXPECT_FALSE(tombstones().next_generation(second));
+}
+
+TEST_F(TombstoneListTest, expiresUpToLimit) {
+  destroy("a");
+  destroy("b");
+  destroy("c");
+
+  TombstoneList::clock::time_point at;
+  ASSERT_TRUE(tombstones().next_generation(at));
+  EXPECT_EQ(2u, tombstones().expire(2, at));
+  EXPECT_EQ(1u, tombstones().expire(2, at));
+  EXPECT_FALSE(isTombstone("a"));
+  EXPECT_FALSE(isTombstone("b"));
+  EXPECT_FALSE(isTombstone("c"));
+}
+
+TEST_F(TombstoneListTest, reapsByGcVersion) {
+  destroy("member1-v1", 1, 1);
+  destroy("member1-v2", 1, 2);
+  destroy("member1-v3", 1, 3);
+  destroy("member2-v1", 2, 1);
+
+  std::map<uint16_t, int64_t> gcVersions{{1, 2}};
+  segment_.reapTombstones(gcVersions);
+
+  EXPECT_FALSE(isTombstone("member1-v1"));
+  EXPECT_FALSE(isTombstone("member1-v2"));
+  EXPECT_TRUE(isTombstone("member1-v3"));
+  EXPECT_TRUE(isTombstone("member2-v1"));
+}
+
+TEST_F(TombstoneListTest, recreatingEntryErasesTombstone) {
+  destroy("key");
+  destroy("other");
+
+  std::shared_ptr<MapEntryImpl> entry;
+  bool result = false;
+  segment_.isTombstone(CacheableKey::create("key"), entry, result);
+  ASSERT_TRUE(result);
+  std::weak_ptr<MapEntryImpl> tombstoneEntry = entry;
+  entry.reset();
+
+  std::shared_ptr<Cacheable> oldValue;
+  bool isUpdate = false;
+  segment_.put(CacheableKey::create("key"), CacheableString::create("value"),
+               entry, oldValue, -1, 0, isUpdate, tag(2, 1, 2));
+  EXPECT_FALSE(isTombstone("key"));
+  EXPECT_TRUE(contains("key"));
+
+  // the erased tombstone left its generation, releasing its entry
+  EXPECT_TRUE(tombstoneEntry.expired());
+  TombstoneList::clock::time_point at;
+  ASSERT_TRUE(tombstones().next_generation(at));
+  EXPECT_EQ(1u, tombstones().expire(100, at));
+  EXPECT_FALSE(isTombstone("other"));
+  EXPECT_TRUE(contains("key"));
+  EXPECT_FALSE(tombstones().next_generation(at));
+}
+
+}  // namespace
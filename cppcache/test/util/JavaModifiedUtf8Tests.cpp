@@ -51,3 +51,48 @@ TEST(JavaModifiedUtf8Tests, DecodeStringWithInlineNullChar) {
       JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35);
   EXPECT_EQ(expected, actual);
 }
+
+TEST(JavaModifiedUtf8Tests, EncodedLengthUtf16MixedLongerThanVector) {
+  auto utf16 = std::u16string(u"You had me at meat tornadö! ࠸ ");
+  utf16.push_back(0);
+  utf16.append(u"You had me at meat tornado!");
+
+  size_t expected = 0;
+  for (auto c : utf16) {
+    expected += (c == 0 || (c >= 0x80 && c < 0x800)) ? 2 : c < 0x80 ? 1 : 3;
+  }
+
+  EXPECT_EQ(expected, JavaModifiedUtf8::encodedLength(utf16));
+}
+
+TEST(JavaModifiedUtf8Tests, EncodedLengthFromUtf8WithInlineNullChar) {
+  auto utf8 = std::string("You had me at");
+  utf8.push_back(0);
+  utf8.append("meat tornado!");
+
+  EXPECT_EQ(28, JavaModifiedUtf8::encodedLength(utf8));
+}
+
+TEST(JavaModifiedUtf8Tests, FromAsciiStringIsUnchanged) {
+  const auto ascii = std::string("You had me at meat tornado!");
+  EXPECT_EQ(ascii, JavaModifiedUtf8::fromString(ascii));
+}
+
+TEST(JavaModifiedUtf8Tests, FromUtf16EncodesInlineNullChar) {
+  auto utf16 = std::u16string(u"You had me at");
+  utf16.push_back(0);
+  utf16.append(u"meat tornadö!");
+
+  auto expected = std::string("You had me at\xC0\x80meat tornad\xC3\xB6!");
+  EXPECT_EQ(expected, JavaModifiedUtf8::fromString(utf16));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeRoundTripsFromString) {
+  auto utf16 = std::u16string(u"You had me at meat tornado! ");
+  utf16.push_back(0);
+  utf16.append(u"meat tornadö! ࠸ \U000F0000 and more ASCII after");
+
+  auto jmutf8 = JavaModifiedUtf8::fromString(utf16);
+  EXPECT_EQ(utf16, JavaModifiedUtf8::decode(
+                       jmutf8.data(), static_cast<uint16_t>(jmutf8.length())));
+}
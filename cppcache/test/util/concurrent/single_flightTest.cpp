@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/single_flight.hpp"
+
+using apache::geode::client::single_flight;
+
+namespace {
+
+void waitForWaiters(const single_flight<std::string, int>& flights,
+                    const std::string& key, size_t count) {
+  while (flights.waiters(key) < count) {
+    std::this_thread::yield();
+  }
+}
+
+}  // namespace
+
+TEST(single_flightTest, concurrentCallersShareOneCall) {
+  single_flight<std::string, int> flights;
+  std::atomic<int> calls(0);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+
+  auto leader = std::async(std::launch::async, [&] {
+    bool shared;
+    auto result = flights.run(
+        "key",
+        [&] {
+          ++calls;
+          released.wait();
+          return 42;
+        },
+        shared);
+    EXPECT_FALSE(shared);
+    return result;
+  });
+
+  while (calls == 0) {
+    std::this_thread::yield();
+  }
+
+  std::vector<std::future<int>> followers;
+  for (int i = 0; i < 4; i++) {
+    followers.push_back(std::async(std::launch::async, [&] {
+      bool shared;
+      auto result = flights.run(
+          "key",
+          [&] {
+            ++calls;
+            return 0;
+          },
+          shared);
+      EXPECT_TRUE(shared);
+      return result;
+    }));
+  }
+
+  waitForWaiters(flights, "key", followers.size());
+  release.set_value();
+
+  EXPECT_EQ(42, leader.get());
+  for (auto& follower : followers) {
+    EXPECT_EQ(42, follower.get());
+  }
+  EXPECT_EQ(1, calls);
+  EXPECT_EQ(0u, flights.waiters("key"));
+}
+
+TEST(single_flightTest, sequentialCallsAreNotShared) {
+  single_flight<std::string, int> flights;
+  bool shared;
+
+  EXPECT_EQ(1, flights.run("key", [] { return 1; }, shared));
+  EXPECT_FALSE(shared);
+  EXPECT_EQ(2, flights.run("key", [] { return 2; }, shared));
+  EXPECT_FALSE(shared);
+}
+
+TEST(single_flightTest, waitersRunTheirOwnCallWhenLeaderThrows) {
+  single_flight<std::string, int> flights;
+  std::promise<void> started;
+  std::promise<void> release;
+  auto released = release.get_future().share();
+
+  auto leader = std::async(std::launch::async, [&] {
+    bool shared;
+    return flights.run(
+        "key",
+        [&]() -> int {
+          started.set_value();
+          released.wait();
+          throw std::runtime_error("failed");
+        },
+        shared);
+  });
+  started.get_future().wait();
+
+  auto follower = std::async(std::launch::async, [&] {
+    bool shared;
+    auto result = flights.run("key", [] { return 7; }, shared);
+    EXPECT_FALSE(shared);
+    return result;
+  });
+
+  waitForWaiters(flights, "key", 1);
+  release.set_value();
+
+  EXPECT_THROW(leader.get(), std::runtime_error);
+  EXPECT_EQ(7, follower.get());
+}
@@ -41,3 +41,18 @@ TEST(string, geodeHash) {
 
   EXPECT_EQ(701776767, hash(str));
 }
+
+TEST(string, geodeHashOfLongStrings) {
+  auto&& hash = geode_hash<std::string>{};
+  auto&& utf16Hash = geode_hash<std::u16string>{};
+
+  auto ascii = std::string("You had me at meat tornado! You had me at meat.");
+  EXPECT_EQ(utf16Hash(u"You had me at meat tornado! You had me at meat."),
+            hash(ascii));
+
+  auto mixed = ascii + u8"tornad\u00F6!\U000F0000" + ascii;
+  EXPECT_EQ(utf16Hash(u"You had me at meat tornado! You had me at meat."
+                      u"tornad\u00F6!\U000F0000"
+                      u"You had me at meat tornado! You had me at meat."),
+            hash(mixed));
+}
@@ -0,0 +1,91 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/hash.hpp"
+
+using apache::geode::client::java_hash;
+using apache::geode::client::java_hash_reverse;
+
+namespace {
+
+int32_t naiveJavaHash(int32_t h, const std::vector<int8_t>& bytes) {
+  for (auto b : bytes) {
+    h = static_cast<int32_t>(31u * static_cast<uint32_t>(h) +
+                             static_cast<uint32_t>(b));
+  }
+  return h;
+}
+
+std::vector<int8_t> makeBytes(size_t length) {
+  std::vector<int8_t> bytes(length);
+  for (size_t i = 0; i < length; i++) {
+    bytes[i] = static_cast<int8_t>(i * 37 + 11);
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEST(hashTest, javaHashOfEmptyRangeIsSeed) {
+  EXPECT_EQ(1, java_hash(1, static_cast<const int8_t*>(nullptr), 0));
+  EXPECT_EQ(17, java_hash_reverse(17, nullptr, 0));
+}
+
+TEST(hashTest, javaHashMatchesArraysHashCode) {
+  // java.util.Arrays.hashCode(new byte[]{1, 2, 3, -1})
+  const int8_t bytes[] = {1, 2, 3, -1};
+  EXPECT_EQ(955326, java_hash(1, bytes, sizeof(bytes)));
+}
+
+TEST(hashTest, javaHashMatchesNaiveForAllTailLengths) {
+  for (size_t length = 0; length < 40; length++) {
+    auto bytes = makeBytes(length);
+    EXPECT_EQ(naiveJavaHash(1, bytes), java_hash(1, bytes.data(), length))
+        << "length " << length;
+  }
+}
+
+TEST(hashTest, javaHashReverseMatchesNaiveForAllTailLengths) {
+  for (size_t length = 0; length < 40; length++) {
+    auto bytes = makeBytes(length);
+    auto reversed = std::vector<int8_t>(bytes.rbegin(), bytes.rend());
+    EXPECT_EQ(naiveJavaHash(1, reversed),
+              java_hash_reverse(1, bytes.data(), length))
+        << "length " << length;
+  }
+}
+
+TEST(hashTest, javaHashUtf16MatchesNaiveForAllTailLengths) {
+  for (size_t length = 0; length < 70; length++) {
+    std::u16string units;
+    int32_t expected = 0;
+    for (size_t i = 0; i < length; i++) {
+      auto c = static_cast<char16_t>(i % 3 == 0 ? 0xffff - i : 0x41 + i);
+      units.push_back(c);
+      expected = static_cast<int32_t>(31u * static_cast<uint32_t>(expected) +
+                                      static_cast<uint32_t>(c));
+    }
+    EXPECT_EQ(expected, java_hash(0, units.data(), units.length()))
+        << "length " << length;
+  }
+}